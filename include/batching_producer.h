@@ -0,0 +1,142 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include "mpmc_queue.h"
+
+// 여러 항목을 큐 슬롯 하나로 전달하기 위한 묶음
+// 소비자는 Pop으로 묶음 하나를 받아 앞의 _count개 항목을 처리한다.
+template <typename T, size_t Capacity>
+struct Batch
+{
+    size_t _count;
+    T _items[Capacity];
+};
+
+// 생산자 스레드 하나가 소유하는 묶음 전송 프런트엔드
+// 항목을 지역 버퍼에 모았다가 아래 조건 중 하나를 만족하면 한 번의 Push로 전달한다.
+// - 모은 항목 수가 BatchSize에 도달
+// - 첫 항목 이후 최대 지연 시간이 지난 뒤 들어온 첫 Push (Push마다 시각을 한 번 읽어 확인)
+// - Flush() 호출 또는 객체 소멸 (스레드 지역 객체로 두면 스레드 종료 시 전달됨)
+// 전송 속도가 낮은 생산자는 유휴 시점에 Flush()를 직접 호출해야 지연 상한이 지켜진다.
+// 소멸 시 큐가 가득 차 _shutdown_timeout 안에 전달하지 못하면 남은 묶음은 버린다 (소비자가 없어도 멈추지 않음).
+// 항목을 잃으면 안 되는 경우 소멸 전에 FlushFor()의 결과를 확인한다.
+template <typename T, size_t BatchSize, size_t QueueSize>
+class BatchingProducer
+{
+public:
+    using BatchType = Batch<T, BatchSize>;
+    using QueueType = MPMCQueue<BatchType, QueueSize>;
+    using Clock = std::chrono::steady_clock;
+
+    BatchingProducer(QueueType& _queue, Clock::duration _max_delay, Clock::duration _shutdown_timeout = std::chrono::milliseconds(100));
+    ~BatchingProducer();
+
+    BatchingProducer(BatchingProducer&&) = delete;
+    BatchingProducer(const BatchingProducer&) = delete;
+    BatchingProducer& operator=(BatchingProducer&&) = delete;
+    BatchingProducer& operator=(const BatchingProducer&) = delete;
+
+    // 버퍼가 가득 찼는데 큐도 가득 차 전달하지 못하면 false 반환 (항목은 추가되지 않음)
+    bool Push(const T& _item) noexcept;
+
+    // 모은 항목을 즉시 전달 (비어 있으면 true, 큐가 가득 차면 false)
+    bool Flush() noexcept;
+
+    // 큐에 공간이 생기길 최대 _timeout 동안 기다리며 Flush를 재시도 (시간 안에 전달하지 못하면 false)
+    bool FlushFor(Clock::duration _timeout) noexcept;
+
+    size_t GetPendingCount() const { return m_batch._count; }
+
+private:
+    QueueType& m_queue;
+    const Clock::duration m_max_delay;
+    const Clock::duration m_shutdown_timeout;
+    Clock::time_point m_deadline;
+    BatchType m_batch;
+};
+
+// ============================================================
+// 구현
+template <typename T, size_t BatchSize, size_t QueueSize>
+BatchingProducer<T, BatchSize, QueueSize>::BatchingProducer(QueueType& _queue, Clock::duration _max_delay, Clock::duration _shutdown_timeout)
+    : m_queue(_queue),
+      m_max_delay(_max_delay),
+      m_shutdown_timeout(_shutdown_timeout),
+      m_deadline(),
+      m_batch()
+{
+    static_assert(BatchSize > 0, "묶음 크기는 0보다 커야 함");
+    static_assert(std::is_nothrow_copy_assignable_v<T>, "T는 예외 없이 복사 대입할 수 있어야 함");
+}
+
+template <typename T, size_t BatchSize, size_t QueueSize>
+BatchingProducer<T, BatchSize, QueueSize>::~BatchingProducer()
+{
+    // 소비자가 큐를 비울 때까지 제한 시간 동안만 재시도하고, 그래도 가득 차 있으면 남은 묶음을 버린다
+    FlushFor(m_shutdown_timeout);
+}
+
+template <typename T, size_t BatchSize, size_t QueueSize>
+bool BatchingProducer<T, BatchSize, QueueSize>::Push(const T& _item) noexcept
+{
+    if (m_batch._count == BatchSize && false == Flush())
+    {
+        return false;
+    }
+
+    const Clock::time_point _now = Clock::now();
+
+    if (m_batch._count == 0)
+    {
+        // 묶음의 첫 항목 시점부터 지연 시간을 잰다
+        m_deadline = _now + m_max_delay;
+    }
+
+    m_batch._items[m_batch._count++] = _item;
+
+    if (m_batch._count == BatchSize || _now >= m_deadline)
+    {
+        // 실패하면 다음 Push 또는 Flush에서 다시 시도
+        Flush();
+    }
+
+    return true;
+}
+
+template <typename T, size_t BatchSize, size_t QueueSize>
+bool BatchingProducer<T, BatchSize, QueueSize>::Flush() noexcept
+{
+    if (m_batch._count == 0)
+    {
+        return true;
+    }
+
+    if (false == m_queue.Push(m_batch))
+    {
+        return false;
+    }
+
+    m_batch._count = 0;
+    return true;
+}
+
+template <typename T, size_t BatchSize, size_t QueueSize>
+bool BatchingProducer<T, BatchSize, QueueSize>::FlushFor(Clock::duration _timeout) noexcept
+{
+    const Clock::time_point _give_up_time = Clock::now() + _timeout;
+
+    while (false == Flush())
+    {
+        if (Clock::now() >= _give_up_time)
+        {
+            return false;
+        }
+
+        std::this_thread::yield();
+    }
+
+    return true;
+}
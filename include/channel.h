@@ -0,0 +1,474 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "mpmc_queue.h"
+
+// MPMCQueue 위에 만든 Go 스타일 채널
+// MakeChannel()로 Sender/Receiver 한 쌍을 만들고, 핸들은 복사해서 여러 스레드에 나눠 준다.
+// - 마지막 Sender가 소멸하면 채널이 닫힌다. Receiver는 남은 항목을 모두 받은 뒤에 Closed를 본다.
+// - 마지막 Receiver가 소멸하면 이후 보내기는 Closed를 반환한다.
+// - Select()는 여러 Receiver 중 먼저 항목이 들어온 채널 하나를 처리하며,
+//   모두 비어 있으면 공유 대기자 하나에 잠든다 (채널을 번갈아 폴링하지 않음).
+//
+// 잠들기와 깨우기는 QueueNotifier와 같은 펜스 쌍으로 순서를 맞춘다.
+// 보내는 쪽: Push -> seq_cst 펜스 -> 대기자 수 확인
+// 받는 쪽:   대기자 등록 -> seq_cst 펜스 -> 채널 재확인
+// 대기자가 없으면 보내기 경로는 Push와 펜스, 원자 변수 읽기 하나로 끝난다.
+namespace lfq
+{
+    enum class ChannelStatus
+    {
+        Ok,
+        Empty,  // 받을 항목이 없음
+        Full,   // 큐가 가득 참
+        Closed, // 받기: 모든 Sender가 사라지고 항목도 모두 받음 / 보내기: 모든 Receiver가 사라짐
+    };
+
+    // Select()가 모든 채널이 닫혔을 때 반환하는 값
+    constexpr size_t SELECT_CLOSED = static_cast<size_t>(-1);
+
+    // Select()/Receive()를 호출한 스레드가 잠드는 곳
+    // 스레드마다 하나를 두고 여러 채널의 대기자 목록에 동시에 등록한다.
+    class ChannelWaiter
+    {
+    public:
+        void Reset()
+        {
+            std::lock_guard<std::mutex> _lock(m_mutex);
+            m_signaled = false;
+        }
+
+        void Wake()
+        {
+            {
+                std::lock_guard<std::mutex> _lock(m_mutex);
+                m_signaled = true;
+            }
+
+            m_condition.notify_one();
+        }
+
+        void Wait()
+        {
+            std::unique_lock<std::mutex> _lock(m_mutex);
+            m_condition.wait(_lock, [this]() { return m_signaled; });
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        bool m_signaled = false;
+    };
+
+    // 채널의 타입과 무관한 부분: 핸들 참조 수, 닫힘 상태, 대기자 목록
+    class ChannelCore
+    {
+    public:
+        ChannelCore() = default;
+
+        ChannelCore(ChannelCore&&) = delete;
+        ChannelCore(const ChannelCore&) = delete;
+        ChannelCore& operator=(ChannelCore&&) = delete;
+        ChannelCore& operator=(const ChannelCore&) = delete;
+
+        void AddSender() noexcept { m_sender_count.fetch_add(1, std::memory_order_relaxed); }
+        void AddReceiver() noexcept { m_receiver_count.fetch_add(1, std::memory_order_relaxed); }
+
+        // 마지막 Sender가 사라지면 채널을 닫고 잠든 Receiver를 모두 깨운다.
+        // acq_rel 감소로 다른 Sender들의 앞선 Push가 닫힘 표시보다 먼저 보이게 한다.
+        void ReleaseSender()
+        {
+            if (m_sender_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                m_closed.store(true, std::memory_order_release);
+                WakeWaiters();
+            }
+        }
+
+        void ReleaseReceiver() noexcept { m_receiver_count.fetch_sub(1, std::memory_order_release); }
+
+        bool IsClosed() const noexcept { return m_closed.load(std::memory_order_acquire); }
+        bool HasReceiver() const noexcept { return m_receiver_count.load(std::memory_order_acquire) != 0; }
+
+        void AddWaiter(ChannelWaiter* _waiter)
+        {
+            std::lock_guard<std::mutex> _lock(m_waiter_mutex);
+            m_waiters.push_back(_waiter);
+            m_waiter_count.store(m_waiters.size(), std::memory_order_relaxed);
+        }
+
+        void RemoveWaiter(ChannelWaiter* _waiter)
+        {
+            std::lock_guard<std::mutex> _lock(m_waiter_mutex);
+            m_waiters.erase(std::find(m_waiters.begin(), m_waiters.end(), _waiter));
+            m_waiter_count.store(m_waiters.size(), std::memory_order_relaxed);
+        }
+
+        // 보내는 쪽: Push 또는 닫힘 표시 직후 호출
+        // 깨어난 대기자가 다른 채널을 처리할 수도 있으므로 하나만 깨우지 않고 모두 깨운다.
+        void WakeWaiters()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (m_waiter_count.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+
+            std::lock_guard<std::mutex> _lock(m_waiter_mutex);
+            for (ChannelWaiter* _waiter : m_waiters)
+            {
+                _waiter->Wake();
+            }
+        }
+
+    private:
+        std::atomic<size_t> m_sender_count{1};
+        std::atomic<size_t> m_receiver_count{1};
+        std::atomic<bool> m_closed{false};
+
+        // 보내는 쪽이 매번 읽으므로 참조 수와 다른 캐시 라인에 둔다.
+        alignas(lfq::CACHE_LINE_SIZE) std::atomic<size_t> m_waiter_count{0};
+        std::mutex m_waiter_mutex;
+        std::vector<ChannelWaiter*> m_waiters;
+    };
+
+    template <typename T, size_t Size>
+    struct ChannelState
+    {
+        ChannelCore _core;
+        MPMCQueue<T, Size> _queue;
+    };
+}
+
+template <typename T, size_t Size>
+class Sender
+{
+public:
+    using StateType = lfq::ChannelState<T, Size>;
+
+    explicit Sender(std::shared_ptr<StateType> _state) noexcept : m_state(std::move(_state)) {}
+    ~Sender() { Release(); }
+
+    Sender(const Sender& _other) noexcept : m_state(_other.m_state)
+    {
+        if (nullptr != m_state)
+        {
+            m_state->_core.AddSender();
+        }
+    }
+
+    Sender(Sender&& _other) noexcept = default;
+
+    Sender& operator=(Sender _other)
+    {
+        Release();
+        m_state = std::move(_other.m_state);
+        return *this;
+    }
+
+    // 큐가 가득 차면 Full, 모든 Receiver가 사라졌거나 Reset/이동으로 빈 핸들이면 Closed 반환
+    lfq::ChannelStatus TrySend(const T& _item)
+    {
+        if (nullptr == m_state || false == m_state->_core.HasReceiver())
+        {
+            return lfq::ChannelStatus::Closed;
+        }
+
+        if (false == m_state->_queue.Push(_item))
+        {
+            return lfq::ChannelStatus::Full;
+        }
+
+        m_state->_core.WakeWaiters();
+        return lfq::ChannelStatus::Ok;
+    }
+
+    lfq::ChannelStatus TrySend(T&& _item)
+    {
+        if (nullptr == m_state || false == m_state->_core.HasReceiver())
+        {
+            return lfq::ChannelStatus::Closed;
+        }
+
+        if (false == m_state->_queue.Push(std::move(_item)))
+        {
+            return lfq::ChannelStatus::Full;
+        }
+
+        m_state->_core.WakeWaiters();
+        return lfq::ChannelStatus::Ok;
+    }
+
+    // 큐에 자리가 날 때까지 양보하며 재시도 (모든 Receiver가 사라지면 false)
+    bool Send(const T& _item)
+    {
+        lfq::ChannelStatus _status;
+        while ((_status = TrySend(_item)) == lfq::ChannelStatus::Full)
+        {
+            std::this_thread::yield();
+        }
+
+        return _status == lfq::ChannelStatus::Ok;
+    }
+
+    // 이 핸들을 즉시 놓는다 (마지막 Sender였다면 채널이 닫힘)
+    void Reset()
+    {
+        Release();
+        m_state.reset();
+    }
+
+private:
+    void Release()
+    {
+        if (nullptr != m_state)
+        {
+            m_state->_core.ReleaseSender();
+        }
+    }
+
+    std::shared_ptr<StateType> m_state;
+};
+
+template <typename T, size_t Size>
+class Receiver
+{
+public:
+    using StateType = lfq::ChannelState<T, Size>;
+    using ItemType = T;
+
+    explicit Receiver(std::shared_ptr<StateType> _state) noexcept : m_state(std::move(_state)) {}
+    ~Receiver() { Release(); }
+
+    Receiver(const Receiver& _other) noexcept : m_state(_other.m_state)
+    {
+        if (nullptr != m_state)
+        {
+            m_state->_core.AddReceiver();
+        }
+    }
+
+    Receiver(Receiver&& _other) noexcept = default;
+
+    Receiver& operator=(Receiver _other)
+    {
+        Release();
+        m_state = std::move(_other.m_state);
+        return *this;
+    }
+
+    // 닫힌 채널이라도 남은 항목이 있으면 Ok를 반환하고, 모두 받은 뒤에만 Closed를 반환한다.
+    // Reset/이동으로 빈 핸들이면 Closed를 반환한다.
+    lfq::ChannelStatus TryReceive(T& _item) noexcept
+    {
+        if (nullptr == m_state)
+        {
+            return lfq::ChannelStatus::Closed;
+        }
+
+        if (true == m_state->_queue.Pop(_item))
+        {
+            return lfq::ChannelStatus::Ok;
+        }
+
+        if (false == m_state->_core.IsClosed())
+        {
+            return lfq::ChannelStatus::Empty;
+        }
+
+        // 닫힘을 본 뒤에는 모든 Sender의 Push가 보이므로 한 번 더 확인하면 충분하다.
+        return true == m_state->_queue.Pop(_item) ? lfq::ChannelStatus::Ok : lfq::ChannelStatus::Closed;
+    }
+
+    // 항목이 올 때까지 잠든다. 채널이 닫히고 모두 받았거나 빈 핸들이면 false
+    bool Receive(T& _item);
+
+    void Reset()
+    {
+        Release();
+        m_state.reset();
+    }
+
+    // 빈 핸들에서는 호출하지 않는다 (Select에 빈 Receiver를 넘기지 않는다)
+    lfq::ChannelCore& GetCore() noexcept { return m_state->_core; }
+
+private:
+    void Release() noexcept
+    {
+        if (nullptr != m_state)
+        {
+            m_state->_core.ReleaseReceiver();
+        }
+    }
+
+    std::shared_ptr<StateType> m_state;
+};
+
+template <typename T, size_t Size>
+std::pair<Sender<T, Size>, Receiver<T, Size>> MakeChannel()
+{
+    auto _state = std::make_shared<lfq::ChannelState<T, Size>>();
+    return {Sender<T, Size>(_state), Receiver<T, Size>(_state)};
+}
+
+namespace lfq
+{
+    // Select()의 경우 하나: Receiver에서 항목을 받으면 _handler(T&&)를 호출
+    template <typename T, size_t Size, typename Handler>
+    class ReceiveCase
+    {
+    public:
+        ReceiveCase(Receiver<T, Size>& _receiver, Handler _handler) : m_receiver(_receiver), m_handler(std::move(_handler)) {}
+
+        ChannelStatus TryRun()
+        {
+            T _item{};
+            const ChannelStatus _status = m_receiver.TryReceive(_item);
+
+            if (_status == ChannelStatus::Ok)
+            {
+                m_handler(std::move(_item));
+            }
+
+            return _status;
+        }
+
+        ChannelCore& GetCore() noexcept { return m_receiver.GetCore(); }
+
+    private:
+        Receiver<T, Size>& m_receiver;
+        Handler m_handler;
+    };
+
+    // 아직 처리할 경우를 찾지 못했음
+    constexpr size_t SELECT_NONE = static_cast<size_t>(-2);
+
+    // 잠들기 전에 양보하며 다시 확인하는 횟수
+    constexpr size_t SELECT_SPIN_COUNT = 16;
+
+    template <typename CaseTuple, size_t... Indices>
+    ChannelStatus TryRunCase(CaseTuple& _cases, size_t _index, std::index_sequence<Indices...>)
+    {
+        ChannelStatus _status = ChannelStatus::Empty;
+        (void)((Indices == _index ? (_status = std::get<Indices>(_cases).TryRun(), true) : false) || ...);
+        return _status;
+    }
+
+    // 모든 경우를 한 번씩 시도한다. 시작 위치를 호출마다 돌려 앞쪽 채널만 처리되는 것을 막는다.
+    template <typename CaseTuple, size_t... Indices>
+    size_t SweepCases(CaseTuple& _cases, size_t _start, std::index_sequence<Indices...> _sequence)
+    {
+        constexpr size_t CaseCount = sizeof...(Indices);
+        size_t _closed_count = 0;
+
+        for (size_t _offset = 0; _offset < CaseCount; ++_offset)
+        {
+            const size_t _index = (_start + _offset) % CaseCount;
+            const ChannelStatus _status = TryRunCase(_cases, _index, _sequence);
+
+            if (_status == ChannelStatus::Ok)
+            {
+                return _index;
+            }
+
+            if (_status == ChannelStatus::Closed)
+            {
+                ++_closed_count;
+            }
+        }
+
+        return _closed_count == CaseCount ? SELECT_CLOSED : SELECT_NONE;
+    }
+
+    template <typename CaseTuple, size_t... Indices>
+    size_t SelectCases(CaseTuple& _cases, std::index_sequence<Indices...> _sequence)
+    {
+        constexpr size_t CaseCount = sizeof...(Indices);
+        thread_local size_t t_next_start = 0;
+        thread_local ChannelWaiter t_waiter;
+
+        ChannelCore* const _cores[CaseCount] = {&std::get<Indices>(_cases).GetCore()...};
+        const size_t _start = t_next_start++;
+
+        while (true)
+        {
+            // 연속 전송 중에는 잠들고 깨어나는 비용이 더 크므로 잠들기 전에 잠시 양보하며 다시 확인한다.
+            size_t _result = SweepCases(_cases, _start, _sequence);
+            for (size_t _spin = 0; _spin < SELECT_SPIN_COUNT && _result == SELECT_NONE; ++_spin)
+            {
+                std::this_thread::yield();
+                _result = SweepCases(_cases, _start, _sequence);
+            }
+
+            if (_result != SELECT_NONE)
+            {
+                return _result;
+            }
+
+            // 모든 채널에 대기자를 등록한 뒤 다시 확인해야 등록 전에 들어온 항목을 놓치지 않는다.
+            t_waiter.Reset();
+            for (ChannelCore* _core : _cores)
+            {
+                _core->AddWaiter(&t_waiter);
+            }
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            _result = SweepCases(_cases, _start, _sequence);
+            if (_result == SELECT_NONE)
+            {
+                t_waiter.Wait();
+            }
+
+            for (ChannelCore* _core : _cores)
+            {
+                _core->RemoveWaiter(&t_waiter);
+            }
+
+            if (_result != SELECT_NONE)
+            {
+                return _result;
+            }
+        }
+    }
+}
+
+template <typename T, size_t Size, typename Handler>
+lfq::ReceiveCase<T, Size, std::decay_t<Handler>> OnReceive(Receiver<T, Size>& _receiver, Handler&& _handler)
+{
+    return lfq::ReceiveCase<T, Size, std::decay_t<Handler>>(_receiver, std::forward<Handler>(_handler));
+}
+
+// 여러 Receiver 중 항목이 있는 채널 하나를 골라 해당 핸들러를 실행하고 그 경우의 순서(0부터)를 반환한다.
+// 모두 비어 있으면 잠들고, 모든 채널이 닫히고 비었으면 lfq::SELECT_CLOSED를 반환한다.
+// 사용 예: Select(OnReceive(_orders, [](Order&& _order) { ... }), OnReceive(_ticks, [](int _tick) { ... }));
+template <typename... Cases>
+size_t Select(Cases&&... _cases)
+{
+    static_assert(sizeof...(Cases) > 0, "Select에는 경우가 하나 이상 필요함");
+
+    auto _case_tuple = std::forward_as_tuple(_cases...);
+    return lfq::SelectCases(_case_tuple, std::index_sequence_for<Cases...>{});
+}
+
+template <typename T, size_t Size>
+bool Receiver<T, Size>::Receive(T& _item)
+{
+    if (nullptr == m_state)
+    {
+        return false;
+    }
+
+    return Select(OnReceive(*this, [&_item](T&& _received) { _item = std::move(_received); })) != lfq::SELECT_CLOSED;
+}
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include "define.h"
+#include "mpmc_queue.h"
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324) // 구조체가 alignas로 패딩됨
+#endif
+
+// 키마다 최신 값 하나만 유지하는 conflating 큐 (시세처럼 마지막 값만 의미 있는 갱신용)
+// 생산자는 키 K의 seqlock 슬롯에 값을 덮어쓰고, K가 clean → dirty로 바뀔 때만 K를 준비 링에 넣는다.
+// 소비자는 링에서 키를 꺼내 그 시점의 최신 값을 읽는다.
+// 따라서 링의 깊이는 갱신 속도와 관계없이 키 수를 넘지 않고, 느린 소비자도 오래된 값을 차례로 처리하지 않는다.
+//
+// - Update: 여러 스레드에서 호출 가능. 같은 키를 여러 생산자가 갱신하면 슬롯 쓰기 권한을 CAS로 얻는다.
+// - Pop: 여러 스레드에서 호출 가능. 값을 읽기 전에 dirty를 내리므로 읽는 도중의 갱신은 키를 다시 넣는다.
+//   이 경우 같은 값을 두 번 받을 수 있지만 최신 값을 놓치지는 않는다.
+//
+// Value는 trivially copyable이어야 하며, 슬롯에는 atomic word 단위로 복사해 찢어진 읽기를 seqlock으로 걸러낸다.
+// 키 수가 많으면 객체가 크므로 std::make_unique로 생성한다.
+template <typename Value, size_t KeyCount>
+class ConflatingQueue
+{
+public:
+    ConflatingQueue();
+    ~ConflatingQueue() = default;
+
+    ConflatingQueue(ConflatingQueue&&) = delete;
+    ConflatingQueue(const ConflatingQueue&) = delete;
+    ConflatingQueue& operator=(ConflatingQueue&&) = delete;
+    ConflatingQueue& operator=(const ConflatingQueue&) = delete;
+
+    // 여러 스레드에서 안전 호출 가능
+    // 키가 clean → dirty로 바뀌어 준비 링에 넣었으면 true를 반환한다. 범위를 벗어난 키는 무시하고 false를 반환한다.
+    bool Update(size_t _key, const Value& _value) noexcept;
+
+    // 여러 스레드에서 안전 호출 가능
+    // 갱신된 키 하나와 그 최신 값을 꺼낸다. 갱신된 키가 없으면 false를 반환한다.
+    bool Pop(size_t& _key, Value& _value) noexcept;
+
+    // 키의 현재 값을 읽는다 (한 번도 갱신하지 않은 키는 값 초기화된 Value)
+    void Read(size_t _key, Value& _value) const noexcept;
+
+    bool IsEmpty() const { return m_ready->IsEmpty(); }
+    size_t GetPendingCount() const { return m_ready->GetSize(); }
+    constexpr size_t GetKeyCount() const { return KeyCount; }
+
+private:
+    static_assert(std::is_trivially_copyable_v<Value>, "Value는 trivially copyable이어야 함");
+    static_assert(KeyCount >= 1 && KeyCount <= 0xffffffffu, "키는 32비트로 표현할 수 있어야 함");
+
+    static constexpr size_t WORD_COUNT = (sizeof(Value) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    // 모든 키가 동시에 dirty여도 넣을 수 있는 준비 링
+    static constexpr size_t READY_SIZE = lfq::GetNextPowerOfTwo(KeyCount < 2 ? 2 : KeyCount);
+    using ReadyRing = MPMCQueue<std::uint32_t, READY_SIZE>;
+
+    struct alignas(lfq::CACHE_LINE_SIZE) Slot
+    {
+        // 홀수: 쓰는 중, 짝수: 안정된 값. 쓸 때마다 2씩 증가
+        std::atomic<std::uint32_t> _sequence{0};
+
+        // 준비 링에 들어 있거나 들어갈 예정이면 true
+        std::atomic<bool> _dirty{false};
+
+        std::atomic<std::uint64_t> _words[WORD_COUNT];
+    };
+
+    Slot m_slots[KeyCount];
+    std::unique_ptr<ReadyRing> m_ready;
+};
+
+// ============================================================
+// 구현
+template <typename Value, size_t KeyCount>
+ConflatingQueue<Value, KeyCount>::ConflatingQueue() : m_ready(std::make_unique<ReadyRing>())
+{
+    for (Slot& _slot : m_slots)
+    {
+        for (auto& _word : _slot._words)
+        {
+            _word.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename Value, size_t KeyCount>
+bool ConflatingQueue<Value, KeyCount>::Update(size_t _key, const Value& _value) noexcept
+{
+    if (_key >= KeyCount)
+    {
+        return false;
+    }
+
+    Slot& _slot = m_slots[_key];
+
+    std::uint64_t _buffer[WORD_COUNT] = {};
+    std::memcpy(_buffer, &_value, sizeof(Value));
+
+    // 짝수 sequence를 홀수로 바꿔 쓰기 권한을 얻는다 (같은 키의 다른 생산자와 경쟁)
+    std::uint32_t _sequence = _slot._sequence.load(std::memory_order_relaxed);
+    while (true)
+    {
+        if ((_sequence & 1) != 0)
+        {
+            std::this_thread::yield();
+            _sequence = _slot._sequence.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        // acquire: 앞선 생산자의 값 쓰기가 이번 쓰기보다 앞서게 한다
+        if (_slot._sequence.compare_exchange_weak(_sequence, _sequence + 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+
+    // 홀수 sequence가 값 쓰기보다 먼저 보이게 한다
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i = 0; i < WORD_COUNT; ++i)
+    {
+        _slot._words[i].store(_buffer[i], std::memory_order_relaxed);
+    }
+
+    // 값을 공개하고 쓰기 권한을 반납
+    _slot._sequence.store(_sequence + 2, std::memory_order_release);
+
+    // clean → dirty 전환을 처음 관측한 생산자만 키를 넣는다.
+    // acq_rel: Pop이 dirty를 내린 뒤의 값 쓰기는 다음 Pop에서 반드시 보인다.
+    if (true == _slot._dirty.exchange(true, std::memory_order_acq_rel))
+    {
+        return false;
+    }
+
+    // 링은 모든 키를 담을 수 있으므로 실패하지 않지만, Pop이 슬롯을 비우는 중이면 재시도한다
+    while (false == m_ready->Push(static_cast<std::uint32_t>(_key)))
+    {
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+template <typename Value, size_t KeyCount>
+bool ConflatingQueue<Value, KeyCount>::Pop(size_t& _key, Value& _value) noexcept
+{
+    std::uint32_t _ready_key = 0;
+    if (false == m_ready->Pop(_ready_key))
+    {
+        return false;
+    }
+
+    // 값을 읽기 전에 dirty를 내려, 읽는 도중의 갱신이 키를 다시 넣게 한다
+    m_slots[_ready_key]._dirty.exchange(false, std::memory_order_acq_rel);
+
+    _key = _ready_key;
+    Read(_key, _value);
+    return true;
+}
+
+template <typename Value, size_t KeyCount>
+void ConflatingQueue<Value, KeyCount>::Read(size_t _key, Value& _value) const noexcept
+{
+    const Slot& _slot = m_slots[_key];
+    std::uint64_t _buffer[WORD_COUNT];
+
+    while (true)
+    {
+        const std::uint32_t _before = _slot._sequence.load(std::memory_order_acquire);
+        if ((_before & 1) != 0)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        for (size_t i = 0; i < WORD_COUNT; ++i)
+        {
+            _buffer[i] = _slot._words[i].load(std::memory_order_relaxed);
+        }
+
+        // 값 읽기가 두 번째 sequence 읽기보다 먼저 끝나게 한다
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (_slot._sequence.load(std::memory_order_relaxed) == _before)
+        {
+            break;
+        }
+    }
+
+    std::memcpy(&_value, _buffer, sizeof(Value));
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -11,4 +11,28 @@ namespace lfq
     // 벤치마크 설정
     constexpr size_t QUEUE_SIZE = 8192;
     constexpr size_t OPERATIONS_PER_THREAD = 10'000'000;
+
+    // _value 이상인 가장 작은 2의 거듭제곱
+    constexpr size_t GetNextPowerOfTwo(size_t _value)
+    {
+        size_t _result = 1;
+        while (_result < _value)
+        {
+            _result <<= 1;
+        }
+
+        return _result;
+    }
+
+    // 모니터링용 크기: 호출자는 tail, head 순서로 인덱스를 relaxed로 읽어 배리어 없이 넘긴다.
+    // 두 인덱스를 읽는 사이에 값이 바뀔 수 있으므로 [0, _capacity] 범위로 자른 근사값이며 흐름 제어에 쓰면 안 된다.
+    constexpr size_t ClampApproximateSize(size_t _head, size_t _tail, size_t _capacity)
+    {
+        if (_tail <= _head)
+        {
+            return 0;
+        }
+
+        return _tail - _head < _capacity ? _tail - _head : _capacity;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,284 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "define.h"
+#include "thread_registry.h"
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324) // 구조체가 alignas로 패딩됨
+#endif
+
+namespace lfq
+{
+    // 결합기 통계: 한 번 잠금을 잡을 때 평균 몇 개의 요청을 처리했는지 확인하는 용도
+    struct CombinerStats
+    {
+        std::uint64_t _pass_count = 0;
+        std::uint64_t _request_count = 0;
+    };
+}
+
+// Flat Combining Multi Producer Multi Consumer Queue
+// 스레드마다 발행 레코드를 두고 요청(Push/Pop)을 적어 놓으면, 결합기 잠금을 잡은 스레드 하나가
+// 모든 레코드를 한 번 훑으며 요청을 순차 링 버퍼에 적용한다.
+// 링과 인덱스는 결합기 한 코어의 캐시에만 머무르고, 다른 스레드는 자기 레코드만 기다리므로
+// 스레드가 많을 때 m_tail/m_head에 대한 CAS 실패 경쟁이 사라진다. 스레드가 적으면 MPMCQueue보다 느리다.
+//
+// 레코드 번호는 ThreadRegistry가 나눠 주며, 번호를 받지 못한 스레드는 잠금을 잡고 직접 처리한다.
+// MPMCQueue와 같은 Push/Pop 인터페이스라 벤치마크에서 그대로 바꿔 쓸 수 있다.
+// 객체가 크므로 std::make_unique로 생성한다.
+template <typename T, size_t Size>
+class FlatCombiningQueue
+{
+public:
+    FlatCombiningQueue();
+    ~FlatCombiningQueue() = default;
+
+    FlatCombiningQueue(FlatCombiningQueue&&) = delete;
+    FlatCombiningQueue(const FlatCombiningQueue&) = delete;
+    FlatCombiningQueue& operator=(FlatCombiningQueue&&) = delete;
+    FlatCombiningQueue& operator=(const FlatCombiningQueue&) = delete;
+
+    // 여러 스레드에서 안전 호출 가능
+    bool Push(const T& _item) noexcept;
+    bool Push(T&& _item) noexcept;
+    bool Pop(T& _item) noexcept;
+
+    bool IsEmpty() const { return GetApproximateSize() == 0; }
+    size_t GetSize() const { return GetApproximateSize(); }
+    size_t GetApproximateSize() const noexcept;
+    constexpr size_t GetCapacity() const { return Size; }
+
+    lfq::CombinerStats GetCombinerStats() const noexcept;
+
+private:
+    static_assert(std::is_nothrow_move_assignable_v<T>, "T는 예외 없이 이동 대입할 수 있어야 함");
+
+    enum Request : std::uint32_t
+    {
+        REQUEST_NONE = 0,
+        REQUEST_PUSH,
+        REQUEST_POP
+    };
+
+    // 스레드 하나의 발행 레코드. 요청을 적은 스레드와 결합기만 접근한다.
+    struct alignas(lfq::CACHE_LINE_SIZE) Record
+    {
+        // REQUEST_NONE으로 돌아오면 _result와 (Pop이면) _item이 채워져 있다
+        std::atomic<std::uint32_t> _request{REQUEST_NONE};
+        bool _result = false;
+        T _item{};
+    };
+
+    // 요청을 레코드에 적고 처리될 때까지 기다린다 (직접 결합하거나 다른 결합기가 처리)
+    bool Execute(std::uint32_t _request, T& _item) noexcept;
+
+    // 번호를 받지 못한 스레드는 잠금을 잡고 요청을 직접 처리한 뒤 다른 요청도 결합한다
+    bool ExecuteDirect(std::uint32_t _request, T& _item) noexcept;
+
+    bool TryLock() noexcept;
+    void Unlock() noexcept { m_locked.store(false, std::memory_order_release); }
+
+    // 잠금을 잡은 상태에서 대기 중인 모든 요청을 적용한다
+    void Combine() noexcept;
+    bool Apply(std::uint32_t _request, T& _item) noexcept;
+
+    Record m_records[lfq::MAX_REGISTERED_THREAD_COUNT];
+
+    // 요청을 낸 적이 있는 레코드 번호의 상한 (결합기가 훑는 범위)
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<size_t> m_record_count;
+
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<bool> m_locked;
+
+    // 아래는 결합기만 쓴다. 크기 조회용으로 인덱스만 atomic이다.
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<size_t> m_head;
+    std::atomic<size_t> m_tail;
+    std::atomic<std::uint64_t> m_pass_count;
+    std::atomic<std::uint64_t> m_request_count;
+    T m_buffer[Size];
+};
+
+// ============================================================
+// 구현
+template <typename T, size_t Size>
+FlatCombiningQueue<T, Size>::FlatCombiningQueue()
+    : m_record_count(0), m_locked(false), m_head(0), m_tail(0), m_pass_count(0), m_request_count(0)
+{
+    static_assert(Size >= 2, "큐 크기는 2 이상이어야 함");
+    static_assert((Size & (Size - 1)) == 0, "FlatCombiningQueue - 큐 사이즈가 2의 제곱이어야 함");
+}
+
+template <typename T, size_t Size>
+bool FlatCombiningQueue<T, Size>::Push(const T& _item) noexcept
+{
+    static_assert(std::is_nothrow_copy_constructible_v<T>, "T는 예외 없이 복사할 수 있어야 함");
+
+    T _copy(_item);
+    return Execute(REQUEST_PUSH, _copy);
+}
+
+template <typename T, size_t Size>
+bool FlatCombiningQueue<T, Size>::Push(T&& _item) noexcept
+{
+    return Execute(REQUEST_PUSH, _item);
+}
+
+template <typename T, size_t Size>
+bool FlatCombiningQueue<T, Size>::Pop(T& _item) noexcept
+{
+    return Execute(REQUEST_POP, _item);
+}
+
+template <typename T, size_t Size>
+bool FlatCombiningQueue<T, Size>::Execute(std::uint32_t _request, T& _item) noexcept
+{
+    const size_t _index = ThreadRegistry::GetThreadIndex();
+    if (_index == lfq::INVALID_THREAD_INDEX)
+    {
+        return ExecuteDirect(_request, _item);
+    }
+
+    // 결합기가 이 레코드를 훑도록 범위를 넓힌다
+    size_t _record_count = m_record_count.load(std::memory_order_relaxed);
+    while (_record_count <= _index &&
+           false == m_record_count.compare_exchange_weak(_record_count, _index + 1, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+
+    Record& _record = m_records[_index];
+    if (_request == REQUEST_PUSH)
+    {
+        _record._item = std::move(_item);
+    }
+
+    // release: 요청 항목이 결합기에게 보인다
+    _record._request.store(_request, std::memory_order_release);
+
+    while (true)
+    {
+        // acquire: 결합기가 적은 결과와 항목을 읽는다
+        if (_record._request.load(std::memory_order_acquire) == REQUEST_NONE)
+        {
+            break;
+        }
+
+        if (true == TryLock())
+        {
+            // 결합기가 되면 자기 요청도 이번 패스에서 처리된다
+            Combine();
+            Unlock();
+            break;
+        }
+
+        std::this_thread::yield();
+    }
+
+    // Pop이 성공했거나 Push가 실패했으면 레코드의 항목을 호출자에게 돌려준다
+    if ((_request == REQUEST_POP) == _record._result)
+    {
+        _item = std::move(_record._item);
+    }
+
+    return _record._result;
+}
+
+template <typename T, size_t Size>
+bool FlatCombiningQueue<T, Size>::ExecuteDirect(std::uint32_t _request, T& _item) noexcept
+{
+    while (false == TryLock())
+    {
+        std::this_thread::yield();
+    }
+
+    const bool _result = Apply(_request, _item);
+    Combine();
+    Unlock();
+    return _result;
+}
+
+template <typename T, size_t Size>
+bool FlatCombiningQueue<T, Size>::TryLock() noexcept
+{
+    // 잠금이 풀렸을 때만 exchange를 시도해 캐시 라인 독점을 줄인다
+    return false == m_locked.load(std::memory_order_relaxed) &&
+           false == m_locked.exchange(true, std::memory_order_acquire);
+}
+
+template <typename T, size_t Size>
+void FlatCombiningQueue<T, Size>::Combine() noexcept
+{
+    const size_t _record_count = m_record_count.load(std::memory_order_acquire);
+    std::uint64_t _request_count = 0;
+
+    for (size_t i = 0; i < _record_count; ++i)
+    {
+        Record& _record = m_records[i];
+        const std::uint32_t _request = _record._request.load(std::memory_order_acquire);
+        if (_request == REQUEST_NONE)
+        {
+            continue;
+        }
+
+        _record._result = Apply(_request, _record._item);
+
+        // release: 결과를 공개하고 레코드를 요청한 스레드에게 돌려준다
+        _record._request.store(REQUEST_NONE, std::memory_order_release);
+        ++_request_count;
+    }
+
+    m_pass_count.store(m_pass_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    m_request_count.store(m_request_count.load(std::memory_order_relaxed) + _request_count, std::memory_order_relaxed);
+}
+
+template <typename T, size_t Size>
+bool FlatCombiningQueue<T, Size>::Apply(std::uint32_t _request, T& _item) noexcept
+{
+    const size_t _head = m_head.load(std::memory_order_relaxed);
+    const size_t _tail = m_tail.load(std::memory_order_relaxed);
+
+    if (_request == REQUEST_PUSH)
+    {
+        if (_tail - _head >= Size)
+        {
+            return false;
+        }
+
+        m_buffer[_tail & (Size - 1)] = std::move(_item);
+        m_tail.store(_tail + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    if (_head == _tail)
+    {
+        return false;
+    }
+
+    _item = std::move(m_buffer[_head & (Size - 1)]);
+    m_head.store(_head + 1, std::memory_order_relaxed);
+    return true;
+}
+
+template <typename T, size_t Size>
+size_t FlatCombiningQueue<T, Size>::GetApproximateSize() const noexcept
+{
+    const size_t _tail = m_tail.load(std::memory_order_relaxed);
+    const size_t _head = m_head.load(std::memory_order_relaxed);
+
+    return lfq::ClampApproximateSize(_head, _tail, Size);
+}
+
+template <typename T, size_t Size>
+lfq::CombinerStats FlatCombiningQueue<T, Size>::GetCombinerStats() const noexcept
+{
+    return lfq::CombinerStats{m_pass_count.load(std::memory_order_relaxed), m_request_count.load(std::memory_order_relaxed)};
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "define.h"
+#include "mpmc_queue.h"
+
+namespace lfq
+{
+    // MPMCQueue 슬롯(generation 8바이트 + 데이터)이 캐시 라인 하나에 들어가도록 정한 기본 저장 공간
+    constexpr size_t INLINE_JOB_CAPACITY = CACHE_LINE_SIZE - 2 * sizeof(void*);
+    constexpr size_t INLINE_JOB_ALIGNMENT = alignof(void*);
+
+    // 호출 가능한 F를 Capacity 바이트의 InlineJob에 담을 수 있는지 판단
+    template <typename F, size_t Capacity>
+    struct FitsInlineJob : std::bool_constant<sizeof(F) <= Capacity &&
+                                              alignof(F) <= INLINE_JOB_ALIGNMENT &&
+                                              std::is_nothrow_move_constructible_v<F> &&
+                                              std::is_invocable_r_v<void, F&>>
+    {
+    };
+}
+
+// 힙 할당 없는 move 전용 작업 래퍼 (std::function<void()> 대체)
+// 캡처를 고정 크기 내부 버퍼에 직접 생성하고, 함수 테이블 포인터 하나로 호출/이동/소멸을 처리한다.
+// 이동이 noexcept이므로 MPMCQueue의 Push(T&&)/Pop 조건을 만족하며, 기본 크기에서 슬롯 하나가 캐시 라인 하나다.
+// 캡처가 버퍼보다 크거나 정렬이 크거나 예외 없이 이동할 수 없으면 컴파일 오류가 난다.
+//
+// trivially copyable 캡처는 이동을 memcpy로, 소멸을 생략한다.
+template <size_t Capacity = lfq::INLINE_JOB_CAPACITY>
+class InlineJob
+{
+public:
+    InlineJob() noexcept = default;
+    ~InlineJob() { Reset(); }
+
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineJob>>>
+    InlineJob(F&& _function) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F&&>);
+
+    InlineJob(InlineJob&& _other) noexcept { MoveFrom(_other); }
+    InlineJob& operator=(InlineJob&& _other) noexcept;
+
+    InlineJob(const InlineJob&) = delete;
+    InlineJob& operator=(const InlineJob&) = delete;
+
+    // 빈 작업을 호출하면 아무것도 하지 않는다
+    void operator()()
+    {
+        if (nullptr != m_table)
+        {
+            m_table->_invoke(m_storage);
+        }
+    }
+
+    explicit operator bool() const noexcept { return nullptr != m_table; }
+
+    // 캡처를 소멸시키고 빈 작업으로 만든다
+    void Reset() noexcept;
+
+private:
+    struct FunctionTable
+    {
+        void (*_invoke)(void* _storage);
+
+        // nullptr이면 memcpy로 이동하고 소멸을 생략한다
+        void (*_move)(void* _destination, void* _source) noexcept;
+        void (*_destroy)(void* _storage) noexcept;
+    };
+
+    template <typename F>
+    static constexpr bool IS_TRIVIAL = std::is_trivially_copyable_v<F> && std::is_trivially_destructible_v<F>;
+
+    template <typename F>
+    static const FunctionTable* GetTable() noexcept;
+
+    void MoveFrom(InlineJob& _other) noexcept;
+
+    alignas(lfq::INLINE_JOB_ALIGNMENT) unsigned char m_storage[Capacity];
+    const FunctionTable* m_table = nullptr;
+};
+
+// ============================================================
+// 구현
+template <size_t Capacity>
+template <typename F>
+const typename InlineJob<Capacity>::FunctionTable* InlineJob<Capacity>::GetTable() noexcept
+{
+    static constexpr FunctionTable TABLE = {
+        [](void* _storage) { (*std::launder(static_cast<F*>(_storage)))(); },
+        IS_TRIVIAL<F> ? nullptr : +[](void* _destination, void* _source) noexcept
+        {
+            F* _function = std::launder(static_cast<F*>(_source));
+            ::new (_destination) F(std::move(*_function));
+            _function->~F();
+        },
+        IS_TRIVIAL<F> ? nullptr : +[](void* _storage) noexcept { std::launder(static_cast<F*>(_storage))->~F(); }};
+
+    return &TABLE;
+}
+
+template <size_t Capacity>
+template <typename F, typename>
+InlineJob<Capacity>::InlineJob(F&& _function) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F&&>)
+{
+    using Function = std::decay_t<F>;
+
+    static_assert(sizeof(Function) <= Capacity, "캡처가 InlineJob 저장 공간보다 큼 - 캡처를 줄이거나 Capacity를 키워야 함");
+    static_assert(alignof(Function) <= lfq::INLINE_JOB_ALIGNMENT, "캡처의 정렬 요구가 InlineJob 저장 공간보다 큼");
+    static_assert(std::is_nothrow_move_constructible_v<Function>, "캡처는 예외 없이 이동할 수 있어야 함");
+    static_assert(std::is_invocable_r_v<void, Function&>, "인자 없이 호출할 수 있어야 함");
+
+    ::new (static_cast<void*>(m_storage)) Function(std::forward<F>(_function));
+    m_table = GetTable<Function>();
+}
+
+template <size_t Capacity>
+InlineJob<Capacity>& InlineJob<Capacity>::operator=(InlineJob&& _other) noexcept
+{
+    if (this != &_other)
+    {
+        Reset();
+        MoveFrom(_other);
+    }
+
+    return *this;
+}
+
+template <size_t Capacity>
+void InlineJob<Capacity>::Reset() noexcept
+{
+    if (nullptr == m_table)
+    {
+        return;
+    }
+
+    if (nullptr != m_table->_destroy)
+    {
+        m_table->_destroy(m_storage);
+    }
+
+    m_table = nullptr;
+}
+
+template <size_t Capacity>
+void InlineJob<Capacity>::MoveFrom(InlineJob& _other) noexcept
+{
+    if (nullptr == _other.m_table)
+    {
+        return;
+    }
+
+    if (nullptr == _other.m_table->_move)
+    {
+        std::memcpy(m_storage, _other.m_storage, Capacity);
+    }
+    else
+    {
+        _other.m_table->_move(m_storage, _other.m_storage);
+    }
+
+    // 원본은 빈 작업이 되어 슬롯에 캡처가 남지 않는다
+    m_table = _other.m_table;
+    _other.m_table = nullptr;
+}
+
+static_assert(sizeof(InlineJob<>) + sizeof(size_t) <= lfq::CACHE_LINE_SIZE, "기본 InlineJob 슬롯이 캐시 라인 하나를 넘음");
+
+// 작업을 InlineJob으로 만들어 큐에 넣는다. 큐가 가득 차면 false를 반환한다.
+template <size_t Capacity, size_t Size, typename F>
+bool SubmitJob(MPMCQueue<InlineJob<Capacity>, Size>& _queue, F&& _function)
+{
+    return _queue.Push(InlineJob<Capacity>(std::forward<F>(_function)));
+}
+
+// 작업 하나를 꺼내 실행한다. 큐가 비어 있으면 false를 반환한다.
+template <size_t Capacity, size_t Size>
+bool ExecuteJob(MPMCQueue<InlineJob<Capacity>, Size>& _queue)
+{
+    InlineJob<Capacity> _job;
+    if (false == _queue.Pop(_job))
+    {
+        return false;
+    }
+
+    _job();
+    return true;
+}
+
+// 작업을 최대 _max_count개까지 꺼내 실행하고 실행한 수를 반환한다.
+template <size_t Capacity, size_t Size>
+size_t ExecuteJobs(MPMCQueue<InlineJob<Capacity>, Size>& _queue, size_t _max_count)
+{
+    InlineJob<Capacity> _job;
+    size_t _executed_count = 0;
+
+    while (_executed_count < _max_count && true == _queue.Pop(_job))
+    {
+        _job();
+        ++_executed_count;
+    }
+
+    return _executed_count;
+}
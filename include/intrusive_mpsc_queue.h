@@ -0,0 +1,144 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <thread>
+#include <type_traits>
+
+namespace lfq
+{
+    // IntrusiveMPSCQueue에 넣을 타입이 상속하는 링크 필드
+    // 큐에 들어 있는 동안에는 큐가 _next를 사용하므로 다른 큐에 동시에 넣을 수 없다.
+    struct MPSCNode
+    {
+        std::atomic<MPSCNode*> _next{nullptr};
+    };
+}
+
+// 크기 제한이 없는 intrusive Multi Producer Single Consumer 큐 (Vyukov 방식)
+// 원소가 링크 필드(lfq::MPSCNode)를 직접 가지므로 Push는 메모리를 할당하지 않고,
+// 빈 큐는 포인터 두 개(head, tail)만 차지한다. 액터 메일박스처럼 수가 많고 대부분 비어 있는 큐에 사용한다.
+//
+// - Push: 여러 스레드에서 호출 가능. tail에 exchange 한 번과 store 한 번으로 끝나는 wait-free 연산
+// - Pop/Drain: 소유자 스레드 하나만 호출. 마지막 원소를 꺼낼 때만 tail에 CAS를 사용
+//
+// 큐는 원소의 수명을 관리하지 않는다. Pop이 반환한 원소는 호출자가 소유하며 바로 재사용하거나 해제할 수 있다.
+// head와 tail은 빈 큐의 크기를 줄이기 위해 같은 캐시 라인에 둔다.
+template <typename T>
+class IntrusiveMPSCQueue
+{
+    static_assert(std::is_base_of_v<lfq::MPSCNode, T>, "T는 lfq::MPSCNode를 상속해야 함");
+
+public:
+    IntrusiveMPSCQueue() = default;
+    ~IntrusiveMPSCQueue() = default;
+
+    IntrusiveMPSCQueue(IntrusiveMPSCQueue&&) = delete;
+    IntrusiveMPSCQueue(const IntrusiveMPSCQueue&) = delete;
+    IntrusiveMPSCQueue& operator=(IntrusiveMPSCQueue&&) = delete;
+    IntrusiveMPSCQueue& operator=(const IntrusiveMPSCQueue&) = delete;
+
+    // 여러 스레드에서 안전 호출 가능
+    // 큐가 비어 있던 상태에서 넣었으면 true를 반환한다.
+    // 액터 런타임은 true일 때만 소유자를 실행 큐에 올리면 된다.
+    bool Push(T* _item) noexcept
+    {
+        lfq::MPSCNode* const _node = _item;
+        _node->_next.store(nullptr, std::memory_order_relaxed);
+
+        // acquire: 마지막 원소를 꺼낸 Pop의 head 정리가 아래 head 저장보다 앞서게 한다
+        // release: 원소 내용을 다음 원소를 연결받는 쪽(Pop)에게 공개한다
+        lfq::MPSCNode* const _previous = m_tail.exchange(_node, std::memory_order_acq_rel);
+
+        if (nullptr == _previous)
+        {
+            // 빈 큐: 소비자가 볼 첫 원소로 공개
+            m_head.store(_node, std::memory_order_release);
+            return true;
+        }
+
+        // 이전 tail은 이 연결을 보기 전까지 Pop이 반환하지 않으므로 안전하게 쓸 수 있다
+        _previous->_next.store(_node, std::memory_order_release);
+        return false;
+    }
+
+    // 소유자 스레드에서만 호출하는 함수
+    // 큐가 비어 있으면 nullptr를 반환한다.
+    // 다른 스레드의 Push가 tail 교환과 연결 사이에 있으면 연결이 끝날 때까지 양보하며 기다린다.
+    T* Pop() noexcept
+    {
+        lfq::MPSCNode* _node = m_head.load(std::memory_order_acquire);
+
+        if (nullptr == _node)
+        {
+            if (nullptr == m_tail.load(std::memory_order_acquire))
+            {
+                return nullptr; // Empty
+            }
+
+            // 빈 큐에 Push한 스레드가 아직 head를 저장하지 않음
+            while (nullptr == (_node = m_head.load(std::memory_order_acquire)))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        lfq::MPSCNode* _next = _node->_next.load(std::memory_order_acquire);
+
+        if (nullptr == _next)
+        {
+            // 마지막 원소로 보이면 tail을 비우고 큐를 빈 상태로 되돌린다.
+            // head를 먼저 비워야 CAS 뒤에 빈 큐에 Push한 스레드의 head 저장을 덮어쓰지 않는다.
+            m_head.store(nullptr, std::memory_order_relaxed);
+
+            lfq::MPSCNode* _expected = _node;
+            if (true == m_tail.compare_exchange_strong(_expected, nullptr, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return static_cast<T*>(_node);
+            }
+
+            // 그 사이 다른 Push가 tail을 교환했으므로 연결될 때까지 기다린다
+            while (nullptr == (_next = _node->_next.load(std::memory_order_acquire)))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        // head는 tail이 빈 동안에만 Push가 쓰므로 여기서는 소비자만 갱신한다
+        m_head.store(_next, std::memory_order_relaxed);
+        return static_cast<T*>(_node);
+    }
+
+    // 소유자 스레드에서만 호출하는 함수
+    // 원소를 최대 _max_count개 꺼내 _handler(T*)를 호출하고 처리한 개수를 반환한다.
+    // 원소는 꺼낸 뒤에 넘기므로 _handler 안에서 해제하거나 다시 Push해도 된다.
+    template <typename Handler>
+    size_t Drain(Handler&& _handler, size_t _max_count = std::numeric_limits<size_t>::max())
+    {
+        size_t _count = 0;
+
+        while (_count < _max_count)
+        {
+            T* const _item = Pop();
+            if (nullptr == _item)
+            {
+                break;
+            }
+
+            _handler(_item);
+            ++_count;
+        }
+
+        return _count;
+    }
+
+    bool IsEmpty() const noexcept
+    {
+        return nullptr == m_tail.load(std::memory_order_acquire);
+    }
+
+private:
+    std::atomic<lfq::MPSCNode*> m_head{nullptr}; // 소비자가 다음에 꺼낼 원소
+    std::atomic<lfq::MPSCNode*> m_tail{nullptr}; // 마지막으로 넣은 원소 (빈 큐면 nullptr)
+};
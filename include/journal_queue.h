@@ -0,0 +1,594 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include "define.h"
+#include "mapped_file.h"
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324) // 구조체가 alignas로 패딩됨
+#endif
+
+namespace lfq
+{
+    enum class JournalSyncMode
+    {
+        None,         // 동기화하지 않음. 프로세스가 죽어도 페이지 캐시에 남지만 전원 장애에는 잃을 수 있다
+        GroupCommit,  // Push 여러 개를 모아 한 번에 동기화. Push는 동기화를 기다리지 않고 반환한다
+        EveryPush     // Push마다 자기 슬롯을 동기화한 뒤 반환
+    };
+
+    // 저널 큐의 내구성 정책
+    // GroupCommit은 마지막 동기화 뒤 _batch_count개의 Push가 쌓이거나 _interval_us가 지나면 Push하던 스레드가 동기화한다.
+    // 시간 조건은 Push할 때만 확인하므로, 멈춘 생산자의 마지막 항목은 다음 Push나 Sync/Close에서 내려 쓴다.
+    struct JournalSyncPolicy
+    {
+        JournalSyncMode _mode = JournalSyncMode::GroupCommit;
+        size_t _batch_count = 256;
+        std::uint64_t _interval_us = 1000;
+    };
+
+    // 파일을 열 때 복구한 결과
+    struct JournalRecoveryStats
+    {
+        size_t _recovered_count = 0;        // 다시 꺼낼 수 있게 된 항목 수
+        size_t _checksum_failure_count = 0; // 공개됐지만 체크섬이 맞지 않아 버린 항목 수
+        size_t _hole_count = 0;             // 예약만 되고 공개되지 않은 자리 수
+    };
+
+    // 저널 파일 머리말. 슬롯은 JOURNAL_HEADER_SIZE부터 이어진다.
+    // 커밋 지점은 Sync가 데이터를 내려 쓴 뒤에 기록하므로 커밋 지점 앞의 내용은 모두 저장 장치에 있다.
+    struct JournalFileHeader
+    {
+        char _magic[8];
+        std::uint32_t _version;
+        std::uint32_t _slot_size;
+        std::uint32_t _item_size;
+        std::uint32_t _reserved;
+        std::uint64_t _capacity;
+        std::uint64_t _committed_head;  // 이 위치 앞의 항목은 모두 꺼내졌음
+        std::uint64_t _committed_tail;  // 이 위치 앞의 항목은 모두 저장 장치에 있음
+    };
+
+    constexpr char JOURNAL_MAGIC[8] = {'L', 'F', 'Q', 'J', 'R', 'N', 'L', '\0'};
+    constexpr std::uint32_t JOURNAL_VERSION = 1;
+
+    // 머리말 갱신이 슬롯 페이지를 건드리지 않도록 한 페이지를 통째로 쓴다
+    constexpr size_t JOURNAL_HEADER_SIZE = 4096;
+
+    static_assert(sizeof(JournalFileHeader) <= JOURNAL_HEADER_SIZE);
+
+    // 항목 위치와 바이트로 계산하는 32비트 FNV-1a 체크섬
+    // 위치를 섞으므로 이전 바퀴에 쓰인 같은 내용의 항목과도 구별된다.
+    inline std::uint32_t ComputeJournalChecksum(std::uint64_t _position, const void* _data, size_t _size) noexcept
+    {
+        std::uint32_t _hash = 2166136261u;
+
+        for (size_t i = 0; i < sizeof(_position); ++i)
+        {
+            _hash = (_hash ^ static_cast<std::uint32_t>((_position >> (i * 8)) & 0xffu)) * 16777619u;
+        }
+
+        const unsigned char* const _bytes = static_cast<const unsigned char*>(_data);
+        for (size_t i = 0; i < _size; ++i)
+        {
+            _hash = (_hash ^ _bytes[i]) * 16777619u;
+        }
+
+        return _hash;
+    }
+}
+
+// 메모리 매핑 파일에 저장되는 Multi Producer Multi Consumer 저널 큐
+// MPMCQueue와 같은 generation 슬롯 프로토콜을 파일 안의 슬롯에서 그대로 수행하고,
+// 슬롯마다 항목 위치를 섞은 체크섬을 함께 기록한다.
+//
+// - 열기: 파일이 없으면 만들고, 있으면 모든 슬롯의 generation을 훑어 공개된 항목을 찾아 head/tail을 다시 만든다.
+//         체크섬이 틀린 항목과 공개되지 않은 자리는 버리고 남은 항목을 순서대로 앞으로 당긴다.
+//         머리말의 커밋 head보다 앞선 항목은 이미 꺼내진 것으로 보고 건너뛴다.
+// - 내구성: JournalSyncPolicy로 고른다. Sync는 바뀐 슬롯 범위를 msync로 내려 쓴 뒤 머리말의 커밋 지점을 갱신한다.
+// - 전달 보장: 마지막 동기화 뒤에 꺼낸 항목은 장애 뒤 다시 나올 수 있다 (at-least-once).
+// - 동기화 실패: msync가 실패하면 HasSyncError()가 다시 Open할 때까지 true로 남는다.
+//   실패한 그룹은 미동기화 수에서 빠지지 않으므로 다음 Push나 Sync가 다시 동기화를 시도한다.
+//
+// T는 파일에 그대로 저장되므로 trivially copyable이어야 하며, 파일은 같은 T와 Size로만 다시 열 수 있다.
+template <typename T, size_t Size>
+class JournalQueue
+{
+public:
+    JournalQueue() = default;
+    ~JournalQueue() { Close(); }
+
+    JournalQueue(JournalQueue&&) = delete;
+    JournalQueue(const JournalQueue&) = delete;
+    JournalQueue& operator=(JournalQueue&&) = delete;
+    JournalQueue& operator=(const JournalQueue&) = delete;
+
+    // 저널 파일을 열어 복구하거나 새로 만든다. 형식이 다른 파일은 건드리지 않고 false를 반환한다.
+    // 다른 스레드가 큐를 쓰지 않을 때 호출한다.
+    bool Open(const std::string& _path, const lfq::JournalSyncPolicy& _policy = {});
+
+    // 남은 변경을 동기화하고 파일을 닫는다. 다른 스레드가 큐를 쓰지 않을 때 호출한다.
+    void Close() noexcept;
+
+    // 여러 스레드에서 안전 호출 가능
+    // 가득 차면 false. 항목을 넣은 뒤 이 호출이 맡은 동기화가 실패해도 false이며, 이때는 HasSyncError()가 true다
+    // (항목은 큐에 남아 있지만 저장 장치에 있다는 보장이 없다).
+    bool Push(const T& _item) noexcept;
+    bool Pop(T& _item) noexcept;
+
+    // 그룹 커밋: 호출 전에 반환된 Push와 Pop을 저장 장치까지 내려 쓴다
+    bool Sync() noexcept;
+
+    bool IsOpen() const noexcept { return m_file.IsOpen(); }
+    bool IsEmpty() const noexcept { return GetSize() == 0; }
+    size_t GetSize() const noexcept;
+    constexpr size_t GetCapacity() const noexcept { return Size; }
+
+    // 열린 뒤 동기화가 한 번이라도 실패했으면 true (다시 Open할 때까지 유지)
+    bool HasSyncError() const noexcept { return m_sync_failed.load(std::memory_order_acquire); }
+
+    // 마지막 Open의 복구 결과
+    lfq::JournalRecoveryStats GetRecoveryStats() const noexcept { return m_recovery_stats; }
+
+    // 열린 뒤 수행한 동기화 횟수 (EveryPush의 슬롯 동기화 포함, 그룹 크기 확인용)
+    std::uint64_t GetSyncCount() const noexcept { return m_sync_count.load(std::memory_order_relaxed); }
+
+    // 파일 크기와 슬롯 배치. 테스트와 도구가 파일을 직접 검사할 때 사용한다.
+    static constexpr size_t GetFileSize() noexcept { return lfq::JOURNAL_HEADER_SIZE + Size * sizeof(Slot); }
+    static constexpr size_t GetSlotOffset(std::uint64_t _position) noexcept
+    {
+        return lfq::JOURNAL_HEADER_SIZE + static_cast<size_t>(_position & (Size - 1)) * sizeof(Slot);
+    }
+
+private:
+    static_assert(Size >= 2, "큐 크기는 2 이상이어야 함");
+    static_assert((Size & (Size - 1)) == 0, "JournalQueue - 큐 사이즈가 2의 제곱이어야 함");
+    static_assert(std::is_trivially_copyable_v<T>, "JournalQueue - T는 파일에 그대로 저장되므로 trivially copyable이어야 함");
+    static_assert(alignof(T) <= lfq::CACHE_LINE_SIZE, "JournalQueue - T의 정렬이 캐시 라인보다 클 수 없음");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "파일 안의 generation은 lock-free atomic이어야 함");
+
+    // 파일 안의 슬롯. generation은 MPMCQueue와 같은 의미이며, 값이 위치 + 1이면 _data와 _checksum이 공개된 상태다.
+    struct alignas(lfq::CACHE_LINE_SIZE) Slot
+    {
+        std::atomic<std::uint64_t> _generation;
+        std::uint32_t _checksum;
+        std::uint32_t _reserved;
+        T _data;
+    };
+
+    Slot& GetSlot(std::uint64_t _position) noexcept
+    {
+        return *reinterpret_cast<Slot*>(m_file.GetData() + GetSlotOffset(_position));
+    }
+
+    lfq::JournalFileHeader& GetHeader() noexcept { return *reinterpret_cast<lfq::JournalFileHeader*>(m_file.GetData()); }
+
+    void Initialize() noexcept;
+    bool IsHeaderValid() noexcept;
+
+    // 모든 슬롯을 훑어 공개된 항목을 찾고, 남길 항목을 [head, tail)로 당겨 다시 기록한다
+    void Recover() noexcept;
+
+    // [_first, _last) 위치의 슬롯을 내려 쓴다
+    bool FlushPositions(std::uint64_t _first, std::uint64_t _last) noexcept;
+
+    bool SyncLocked() noexcept;
+    std::uint64_t GetElapsedUs() const noexcept;
+
+    MappedFile m_file;
+    lfq::JournalSyncPolicy m_policy;
+    lfq::JournalRecoveryStats m_recovery_stats;
+    std::chrono::steady_clock::time_point m_open_time;
+
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<std::uint64_t> m_head{0}; // 읽기 위치
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<std::uint64_t> m_tail{0}; // 쓰기 위치
+
+    // 그룹 커밋 상태. 동기화하는 스레드는 m_sync_mutex를 잡는다.
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<size_t> m_unsynced_count{0};
+    std::atomic<std::uint64_t> m_last_sync_us{0};
+    std::atomic<std::uint64_t> m_sync_count{0};
+    std::atomic<bool> m_sync_failed{false};
+    std::mutex m_sync_mutex;
+    std::uint64_t m_synced_head = 0;
+    std::uint64_t m_synced_tail = 0;
+};
+
+// ============================================================
+// 구현
+template <typename T, size_t Size>
+bool JournalQueue<T, Size>::Open(const std::string& _path, const lfq::JournalSyncPolicy& _policy)
+{
+    Close();
+
+    m_policy = _policy;
+    m_recovery_stats = {};
+
+    if (true == m_file.Open(_path, lfq::MappedFileMode::ReadWrite))
+    {
+        if (m_file.GetSize() != GetFileSize() || false == IsHeaderValid())
+        {
+            m_file.Close();
+            return false;
+        }
+
+        Recover();
+    }
+    else
+    {
+        // 비어 있지 않은 파일을 매핑하지 못했으면 내용을 지우지 않고 실패한다
+        std::error_code _error;
+        const std::uintmax_t _existing_size = std::filesystem::file_size(_path, _error);
+        if (!_error && _existing_size != 0)
+        {
+            return false;
+        }
+
+        if (false == m_file.Open(_path, lfq::MappedFileMode::Create, GetFileSize()))
+        {
+            return false;
+        }
+
+        Initialize();
+    }
+
+    m_open_time = std::chrono::steady_clock::now();
+    m_unsynced_count.store(0, std::memory_order_relaxed);
+    m_last_sync_us.store(0, std::memory_order_relaxed);
+    m_sync_count.store(0, std::memory_order_relaxed);
+    m_sync_failed.store(false, std::memory_order_relaxed);
+    return true;
+}
+
+template <typename T, size_t Size>
+void JournalQueue<T, Size>::Close() noexcept
+{
+    if (false == m_file.IsOpen())
+    {
+        return;
+    }
+
+    Sync();
+    m_file.Close();
+}
+
+template <typename T, size_t Size>
+void JournalQueue<T, Size>::Initialize() noexcept
+{
+    lfq::JournalFileHeader _header{};
+    std::memcpy(_header._magic, lfq::JOURNAL_MAGIC, sizeof(lfq::JOURNAL_MAGIC));
+    _header._version = lfq::JOURNAL_VERSION;
+    _header._slot_size = static_cast<std::uint32_t>(sizeof(Slot));
+    _header._item_size = static_cast<std::uint32_t>(sizeof(T));
+    _header._capacity = Size;
+    std::memcpy(&GetHeader(), &_header, sizeof(_header));
+
+    // 새 파일은 0으로 채워져 있으므로 generation만 MPMCQueue의 초기값으로 맞춘다
+    for (std::uint64_t i = 0; i < Size; ++i)
+    {
+        GetSlot(i)._generation.store(i, std::memory_order_relaxed);
+    }
+
+    m_head.store(0, std::memory_order_relaxed);
+    m_tail.store(0, std::memory_order_relaxed);
+    m_synced_head = 0;
+    m_synced_tail = 0;
+    m_file.Flush();
+}
+
+template <typename T, size_t Size>
+bool JournalQueue<T, Size>::IsHeaderValid() noexcept
+{
+    const lfq::JournalFileHeader& _header = GetHeader();
+
+    return std::memcmp(_header._magic, lfq::JOURNAL_MAGIC, sizeof(lfq::JOURNAL_MAGIC)) == 0 &&
+           _header._version == lfq::JOURNAL_VERSION &&
+           _header._slot_size == sizeof(Slot) &&
+           _header._item_size == sizeof(T) &&
+           _header._capacity == Size;
+}
+
+template <typename T, size_t Size>
+void JournalQueue<T, Size>::Recover() noexcept
+{
+    lfq::JournalFileHeader& _header = GetHeader();
+    const std::uint64_t _committed_head = _header._committed_head;
+
+    // 1) generation으로 공개된 항목의 위치 범위를 찾는다.
+    //    슬롯 i의 generation g는 g ≡ i (mod Size)이면 위치 g를 기다리는 빈 슬롯, g ≡ i + 1이면 위치 g - 1의 항목이다.
+    bool _found = false;
+    std::uint64_t _first_position = 0;
+    std::uint64_t _last_position = 0;
+
+    for (std::uint64_t i = 0; i < Size; ++i)
+    {
+        const std::uint64_t _generation = GetSlot(i)._generation.load(std::memory_order_relaxed);
+        if (_generation == 0 || ((_generation - 1) & (Size - 1)) != i)
+        {
+            continue;
+        }
+
+        const std::uint64_t _position = _generation - 1;
+        if (_position < _committed_head)
+        {
+            continue;
+        }
+
+        _first_position = true == _found && _first_position < _position ? _first_position : _position;
+        _last_position = true == _found && _last_position > _position ? _last_position : _position;
+        _found = true;
+    }
+
+    // 범위가 한 바퀴를 넘으면 파일이 손상된 것이므로 가장 최근 한 바퀴만 남긴다
+    if (true == _found && _last_position - _first_position >= Size)
+    {
+        _first_position = _last_position - (Size - 1);
+    }
+
+    // 2) 위치 순서대로 체크섬이 맞는 항목만 앞으로 당긴다.
+    //    목적지 위치는 항상 현재 위치 이하이고 한 바퀴 안의 위치는 서로 다른 슬롯이므로 아직 읽지 않은 슬롯을 덮어쓰지 않는다.
+    const std::uint64_t _base = true == _found ? _first_position
+                                               : (_header._committed_tail > _committed_head ? _header._committed_tail : _committed_head);
+    std::uint64_t _count = 0;
+
+    for (std::uint64_t _position = _base; true == _found && _position <= _last_position; ++_position)
+    {
+        Slot& _slot = GetSlot(_position);
+        if (_slot._generation.load(std::memory_order_relaxed) != _position + 1)
+        {
+            ++m_recovery_stats._hole_count;
+            continue;
+        }
+
+        if (_slot._checksum != lfq::ComputeJournalChecksum(_position, &_slot._data, sizeof(T)))
+        {
+            ++m_recovery_stats._checksum_failure_count;
+            continue;
+        }
+
+        const std::uint64_t _target_position = _base + _count;
+        if (_target_position != _position)
+        {
+            Slot& _target = GetSlot(_target_position);
+            std::memcpy(&_target._data, &_slot._data, sizeof(T));
+            _target._checksum = lfq::ComputeJournalChecksum(_target_position, &_target._data, sizeof(T));
+            _target._generation.store(_target_position + 1, std::memory_order_relaxed);
+        }
+
+        ++_count;
+    }
+
+    // 3) 나머지 슬롯은 다음 바퀴의 위치를 기다리는 빈 슬롯으로 되돌린다
+    for (std::uint64_t _position = _base + _count; _position < _base + Size; ++_position)
+    {
+        Slot& _slot = GetSlot(_position);
+        _slot._checksum = 0;
+        _slot._generation.store(_position, std::memory_order_relaxed);
+    }
+
+    _header._committed_head = _base;
+    _header._committed_tail = _base + _count;
+
+    m_head.store(_base, std::memory_order_relaxed);
+    m_tail.store(_base + _count, std::memory_order_relaxed);
+    m_synced_head = _base;
+    m_synced_tail = _base + _count;
+    m_recovery_stats._recovered_count = static_cast<size_t>(_count);
+    m_file.Flush();
+}
+
+template <typename T, size_t Size>
+bool JournalQueue<T, Size>::Push(const T& _item) noexcept
+{
+    std::uint64_t _tail = m_tail.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Slot& _slot = GetSlot(_tail);
+        const std::uint64_t _generation = _slot._generation.load(std::memory_order_acquire);
+
+        if (_generation == _tail)
+        {
+            if (m_tail.compare_exchange_weak(_tail, _tail + 1, std::memory_order_relaxed))
+            {
+                // 체크섬은 파일에 실제로 쓰인 바이트로 계산한다
+                _slot._data = _item;
+                _slot._checksum = lfq::ComputeJournalChecksum(_tail, &_slot._data, sizeof(T));
+                _slot._generation.store(_tail + 1, std::memory_order_release);
+                break;
+            }
+        }
+        else if (_generation < _tail)
+        {
+            const std::uint64_t _head = m_head.load(std::memory_order_acquire);
+            if (_tail >= _head + Size)
+            {
+                return false;
+            }
+
+            _tail = m_tail.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            _tail = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    if (m_policy._mode == lfq::JournalSyncMode::EveryPush)
+    {
+        // 자기 슬롯만 내려 쓰면 충분하다. 복구는 머리말이 아니라 generation을 기준으로 한다.
+        const bool _flushed = FlushPositions(_tail, _tail + 1);
+        m_sync_count.fetch_add(1, std::memory_order_relaxed);
+
+        if (false == _flushed)
+        {
+            m_sync_failed.store(true, std::memory_order_release);
+            return false;
+        }
+    }
+    else if (m_policy._mode == lfq::JournalSyncMode::GroupCommit)
+    {
+        const size_t _unsynced_count = m_unsynced_count.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        if (_unsynced_count >= m_policy._batch_count ||
+            GetElapsedUs() - m_last_sync_us.load(std::memory_order_relaxed) >= m_policy._interval_us)
+        {
+            // 이미 다른 스레드가 동기화 중이면 기다리지 않고 그 그룹이나 다음 그룹에 맡긴다
+            std::unique_lock<std::mutex> _lock(m_sync_mutex, std::try_to_lock);
+            if (true == _lock.owns_lock() && false == SyncLocked())
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template <typename T, size_t Size>
+bool JournalQueue<T, Size>::Pop(T& _item) noexcept
+{
+    std::uint64_t _head = m_head.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Slot& _slot = GetSlot(_head);
+        const std::uint64_t _generation = _slot._generation.load(std::memory_order_acquire);
+
+        if (_generation == _head + 1)
+        {
+            if (m_head.compare_exchange_weak(_head, _head + 1, std::memory_order_relaxed))
+            {
+                _item = _slot._data;
+                _slot._generation.store(_head + Size, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (_generation < _head + 1)
+        {
+            const std::uint64_t _tail = m_tail.load(std::memory_order_acquire);
+            if (_head >= _tail)
+            {
+                return false;
+            }
+
+            _head = m_head.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            _head = m_head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T, size_t Size>
+bool JournalQueue<T, Size>::Sync() noexcept
+{
+    if (false == m_file.IsOpen())
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> _lock(m_sync_mutex);
+    return SyncLocked();
+}
+
+template <typename T, size_t Size>
+bool JournalQueue<T, Size>::SyncLocked() noexcept
+{
+    // 내려 쓰기 전에 위치를 읽어 두어야 커밋 지점이 실제로 내려 쓴 내용을 넘지 않는다
+    const std::uint64_t _head = m_head.load(std::memory_order_acquire);
+    const std::uint64_t _reserved_tail = m_tail.load(std::memory_order_acquire);
+
+    // 커밋 tail은 공개가 끝난 연속 구간까지만 올린다. 공개된 슬롯의 generation은 위치보다 크다.
+    std::uint64_t _tail = m_synced_tail;
+    while (_tail < _reserved_tail && GetSlot(_tail)._generation.load(std::memory_order_acquire) > _tail)
+    {
+        ++_tail;
+    }
+
+    // 이 동기화가 덮는 Push 수. 성공한 뒤에만 빼므로 실패하면 다음 Push가 다시 동기화한다.
+    const size_t _covered_count = m_unsynced_count.load(std::memory_order_relaxed);
+
+    // 예약 구간 전체를 내려 써야 공개가 늦은 자리 뒤에서 이미 반환된 Push도 포함된다
+    bool _result = FlushPositions(m_synced_tail, _reserved_tail);
+    _result = FlushPositions(m_synced_head, _head) && _result;
+
+    if (true == _result)
+    {
+        lfq::JournalFileHeader& _header = GetHeader();
+        _header._committed_head = _head;
+        _header._committed_tail = _tail;
+        _result = m_file.Flush(0, sizeof(lfq::JournalFileHeader));
+
+        m_synced_head = _head;
+        m_synced_tail = _tail;
+    }
+
+    if (true == _result)
+    {
+        m_unsynced_count.fetch_sub(_covered_count, std::memory_order_relaxed);
+    }
+    else
+    {
+        m_sync_failed.store(true, std::memory_order_release);
+    }
+
+    m_last_sync_us.store(GetElapsedUs(), std::memory_order_relaxed);
+    m_sync_count.fetch_add(1, std::memory_order_relaxed);
+    return _result;
+}
+
+template <typename T, size_t Size>
+bool JournalQueue<T, Size>::FlushPositions(std::uint64_t _first, std::uint64_t _last) noexcept
+{
+    if (_last <= _first)
+    {
+        return true;
+    }
+
+    if (_last - _first >= Size)
+    {
+        return m_file.Flush(lfq::JOURNAL_HEADER_SIZE, Size * sizeof(Slot));
+    }
+
+    // 범위가 링 끝을 넘으면 두 구간으로 나눈다
+    const size_t _begin = static_cast<size_t>(_first & (Size - 1));
+    const size_t _end = _begin + static_cast<size_t>(_last - _first);
+    if (_end <= Size)
+    {
+        return m_file.Flush(GetSlotOffset(_begin), (_end - _begin) * sizeof(Slot));
+    }
+
+    return m_file.Flush(GetSlotOffset(_begin), (Size - _begin) * sizeof(Slot)) &&
+           m_file.Flush(lfq::JOURNAL_HEADER_SIZE, (_end - Size) * sizeof(Slot));
+}
+
+template <typename T, size_t Size>
+size_t JournalQueue<T, Size>::GetSize() const noexcept
+{
+    const std::uint64_t _head = m_head.load(std::memory_order_acquire);
+    const std::uint64_t _tail = m_tail.load(std::memory_order_acquire);
+
+    return _tail > _head ? static_cast<size_t>(_tail - _head) : 0;
+}
+
+template <typename T, size_t Size>
+std::uint64_t JournalQueue<T, Size>::GetElapsedUs() const noexcept
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_open_time).count());
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
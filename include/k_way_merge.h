@@ -0,0 +1,268 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "define.h"
+#include "spsc_queue.h"
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324) // 구조체가 alignas로 패딩됨
+#endif
+
+namespace lfq
+{
+    // 아직 워터마크를 알리지 않은 스트림의 하한 (이 스트림 때문에 병합이 멈춘다)
+    constexpr std::int64_t MERGE_NO_WATERMARK = std::numeric_limits<std::int64_t>::min();
+
+    // 닫힌 스트림의 워터마크. 이벤트 타임스탬프는 이 값보다 작아야 한다.
+    constexpr std::int64_t MERGE_STREAM_CLOSED = std::numeric_limits<std::int64_t>::max();
+
+    // 원소 값 자체를 타임스탬프로 쓰는 기본 키
+    struct EventTimestamp
+    {
+        std::int64_t operator()(std::int64_t _event) const noexcept { return _event; }
+    };
+}
+
+// 타임스탬프 순서 k-way 병합 소비자
+// 스트림마다 SPSC_Q 하나로 들어오는, 각자 타임스탬프가 감소하지 않는 이벤트 흐름을 전체 타임스탬프 순서로 내보낸다.
+// - 각 큐의 맨 앞은 peek()으로 보기만 하고, 패자 트리(loser tree)로 가장 작은 스트림을 고른다.
+//   이벤트 하나를 내보낼 때마다 그 스트림의 잎에서 뿌리까지만 다시 비교한다 (O(log k)).
+// - 처리기는 링 슬롯을 가리키는 참조를 받고, 돌아온 뒤에야 pop()하므로 중간 버퍼로 복사하지 않는다.
+// - 빈 스트림의 하한은 (마지막으로 내보낸 타임스탬프, provider가 알린 워터마크) 중 큰 값이다.
+//   조용한 스트림의 provider가 하트비트로 워터마크를 올리면 다른 스트림이 그 시각까지 진행한다.
+// - 트리의 키는 실제 하한보다 작을 수만 있으므로(하한은 줄지 않는다) 승자가 빈 스트림일 때만 키를 다시 읽는다.
+//
+// 같은 타임스탬프는 스트림 번호가 작은 쪽이 먼저 나간다.
+// 워터마크와 Close는 해당 스트림의 provider 스레드에서, 나머지는 consumer 스레드 하나에서만 호출한다.
+// 큐는 KWayMerge보다 오래 살아야 하며, consumer 외에는 큐에서 pop()하지 않아야 한다.
+template <typename KeyFunction = lfq::EventTimestamp>
+class KWayMerge
+{
+public:
+    // 스트림이 없거나 nullptr가 있으면 std::invalid_argument를 던진다
+    explicit KWayMerge(std::vector<SPSC_Q*> _streams, KeyFunction _key_function = KeyFunction());
+    ~KWayMerge() = default;
+
+    KWayMerge(KWayMerge&&) = delete;
+    KWayMerge(const KWayMerge&) = delete;
+    KWayMerge& operator=(KWayMerge&&) = delete;
+    KWayMerge& operator=(const KWayMerge&) = delete;
+
+    // provider 스레드에서 호출: 앞으로 push할 이벤트의 타임스탬프가 _timestamp 이상임을 알린다.
+    // 워터마크는 줄어들면 안 된다.
+    void PublishWatermark(size_t _stream_index, std::int64_t _timestamp) noexcept;
+    void CloseStream(size_t _stream_index) noexcept { PublishWatermark(_stream_index, lfq::MERGE_STREAM_CLOSED); }
+
+    // consumer 스레드에서 호출: 순서가 확정된 이벤트를 최대 _max_count개 내보낸다.
+    // _handler(size_t 스트림 번호, const std::int64_t& 이벤트)는 링 슬롯을 직접 읽는다.
+    // 0을 반환하면 어떤 스트림의 하한을 기다리는 중이거나(GetBlockingStream) 모든 스트림이 끝난 것이다.
+    template <typename Handler>
+    size_t Drain(Handler&& _handler, size_t _max_count = static_cast<size_t>(-1));
+
+    // 모든 스트림이 닫혔고 남은 이벤트를 모두 내보냈으면 true
+    bool IsFinished() const noexcept { return 0 == m_has_event[m_winner] && m_keys[m_winner] == lfq::MERGE_STREAM_CLOSED; }
+
+    // 병합을 막고 있는 스트림 번호 (막혀 있지 않거나 끝났으면 GetStreamCount())
+    size_t GetBlockingStream() const noexcept;
+
+    size_t GetStreamCount() const noexcept { return m_streams.size(); }
+
+private:
+    struct alignas(lfq::CACHE_LINE_SIZE) Watermark
+    {
+        std::atomic<std::int64_t> _timestamp{lfq::MERGE_NO_WATERMARK};
+    };
+
+    // 키가 같으면 번호가 작은 잎이 이긴다
+    bool IsLess(size_t _left, size_t _right) const noexcept
+    {
+        return m_keys[_left] < m_keys[_right] || (m_keys[_left] == m_keys[_right] && _left < _right);
+    }
+
+    // 스트림의 현재 하한을 다시 읽는다 (맨 앞 이벤트가 있으면 그 타임스탬프)
+    void RefreshKey(size_t _stream_index) noexcept;
+
+    // 잎 하나의 키가 바뀐 뒤 뿌리까지 다시 겨룬다
+    void Replay(size_t _leaf) noexcept;
+
+    std::vector<SPSC_Q*> m_streams;
+    std::unique_ptr<Watermark[]> m_watermarks;
+    KeyFunction m_key_function;
+
+    // 아래는 consumer만 쓴다. 잎 수는 스트림 수를 2의 제곱으로 올린 값이며 남는 잎은 닫힌 스트림이다.
+    size_t m_leaf_count;
+    std::vector<std::int64_t> m_keys;          // 잎별 하한
+    std::vector<std::uint8_t> m_has_event;     // 키가 맨 앞 이벤트의 타임스탬프이면 1
+    std::vector<std::int64_t> m_last_keys;     // 스트림별 마지막으로 내보낸 타임스탬프
+    std::vector<size_t> m_losers;              // 내부 노드별 패자 잎 (1번이 뿌리)
+    size_t m_winner;
+};
+
+// ============================================================
+// 구현
+template <typename KeyFunction>
+KWayMerge<KeyFunction>::KWayMerge(std::vector<SPSC_Q*> _streams, KeyFunction _key_function)
+    : m_streams(std::move(_streams)), m_key_function(std::move(_key_function)), m_leaf_count(1), m_winner(0)
+{
+    if (true == m_streams.empty())
+    {
+        throw std::invalid_argument("KWayMerge - 스트림이 하나 이상 있어야 함");
+    }
+
+    for (const SPSC_Q* _stream : m_streams)
+    {
+        if (nullptr == _stream)
+        {
+            throw std::invalid_argument("KWayMerge - 스트림 큐가 nullptr임");
+        }
+    }
+
+    while (m_leaf_count < m_streams.size())
+    {
+        m_leaf_count *= 2;
+    }
+
+    m_watermarks = std::make_unique<Watermark[]>(m_streams.size());
+    m_keys.assign(m_leaf_count, lfq::MERGE_STREAM_CLOSED);
+    m_has_event.assign(m_leaf_count, 0);
+    m_last_keys.assign(m_streams.size(), lfq::MERGE_NO_WATERMARK);
+    m_losers.assign(m_leaf_count, 0);
+
+    for (size_t i = 0; i < m_streams.size(); ++i)
+    {
+        RefreshKey(i);
+    }
+
+    // 아래에서 위로 겨뤄 내부 노드마다 패자를 남기고 승자를 올려 보낸다
+    std::vector<size_t> _winners(m_leaf_count * 2);
+    for (size_t i = 0; i < m_leaf_count; ++i)
+    {
+        _winners[m_leaf_count + i] = i;
+    }
+
+    for (size_t _node = m_leaf_count - 1; _node >= 1; --_node)
+    {
+        size_t _winner = _winners[_node * 2];
+        size_t _loser = _winners[_node * 2 + 1];
+        if (true == IsLess(_loser, _winner))
+        {
+            std::swap(_winner, _loser);
+        }
+
+        _winners[_node] = _winner;
+        m_losers[_node] = _loser;
+    }
+
+    // 잎이 하나면 _winners[1]이 그 잎이다
+    m_winner = _winners[1];
+}
+
+template <typename KeyFunction>
+void KWayMerge<KeyFunction>::PublishWatermark(size_t _stream_index, std::int64_t _timestamp) noexcept
+{
+    // consumer가 이 값을 acquire로 읽으면 그 전에 push한 이벤트도 peek()에 보인다
+    m_watermarks[_stream_index]._timestamp.store(_timestamp, std::memory_order_release);
+}
+
+template <typename KeyFunction>
+template <typename Handler>
+size_t KWayMerge<KeyFunction>::Drain(Handler&& _handler, size_t _max_count)
+{
+    size_t _drained_count = 0;
+
+    while (_drained_count < _max_count)
+    {
+        const size_t _stream_index = m_winner;
+
+        if (0 == m_has_event[_stream_index])
+        {
+            // 승자가 빈 스트림이면 하한이 올라갔는지 다시 읽고, 그대로면 기다려야 한다
+            const std::int64_t _old_key = m_keys[_stream_index];
+            RefreshKey(_stream_index);
+
+            if (0 == m_has_event[_stream_index] && m_keys[_stream_index] == _old_key)
+            {
+                break;
+            }
+
+            Replay(_stream_index);
+            continue;
+        }
+
+        // 다른 스트림의 키는 실제 하한 이하이므로 승자의 맨 앞 이벤트는 순서가 확정되었다
+        SPSC_Q& _stream = *m_streams[_stream_index];
+        _handler(_stream_index, *_stream.peek());
+
+        m_last_keys[_stream_index] = m_keys[_stream_index];
+        _stream.pop();
+
+        RefreshKey(_stream_index);
+        Replay(_stream_index);
+        ++_drained_count;
+    }
+
+    return _drained_count;
+}
+
+template <typename KeyFunction>
+size_t KWayMerge<KeyFunction>::GetBlockingStream() const noexcept
+{
+    if (0 == m_has_event[m_winner] && m_keys[m_winner] != lfq::MERGE_STREAM_CLOSED)
+    {
+        return m_winner;
+    }
+
+    return m_streams.size();
+}
+
+template <typename KeyFunction>
+void KWayMerge<KeyFunction>::RefreshKey(size_t _stream_index) noexcept
+{
+    const SPSC_Q& _stream = *m_streams[_stream_index];
+    const std::int64_t* _event = _stream.peek();
+
+    if (nullptr == _event)
+    {
+        // 워터마크를 읽은 뒤 다시 봐야, 워터마크보다 먼저 push된 이벤트를 놓치고 하한을 넘겨 잡지 않는다
+        const std::int64_t _watermark = m_watermarks[_stream_index]._timestamp.load(std::memory_order_acquire);
+        _event = _stream.peek();
+
+        if (nullptr == _event)
+        {
+            m_keys[_stream_index] = _watermark > m_last_keys[_stream_index] ? _watermark : m_last_keys[_stream_index];
+            m_has_event[_stream_index] = 0;
+            return;
+        }
+    }
+
+    m_keys[_stream_index] = m_key_function(*_event);
+    m_has_event[_stream_index] = 1;
+}
+
+template <typename KeyFunction>
+void KWayMerge<KeyFunction>::Replay(size_t _leaf) noexcept
+{
+    size_t _winner = _leaf;
+
+    for (size_t _node = (_leaf + m_leaf_count) / 2; _node >= 1; _node /= 2)
+    {
+        if (true == IsLess(m_losers[_node], _winner))
+        {
+            std::swap(m_losers[_node], _winner);
+        }
+    }
+
+    m_winner = _winner;
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
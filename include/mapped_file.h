@@ -0,0 +1,278 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace lfq
+{
+    enum class MappedFileMode
+    {
+        ReadOnly,   // 기존 파일 전체를 읽기 전용으로 매핑
+        ReadWrite,  // 기존 파일을 읽기/쓰기로 매핑 (크기를 주면 그 크기로 늘림)
+        Create      // 파일을 새로 만들거나 비우고 주어진 크기로 매핑
+    };
+}
+
+// 파일 하나를 메모리에 매핑하는 move 전용 핸들
+// 쓰기는 매핑된 메모리에 직접 하며, 커널이 알아서 파일에 반영한다.
+// 프로세스가 죽어도 이미 쓴 내용은 페이지 캐시에 남고, 전원 장애까지 견디려면 Flush를 호출한다.
+// 실패는 Open의 반환값으로만 알리며 예외를 던지지 않는다.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+
+    MappedFile(MappedFile&& _other) noexcept { Swap(_other); }
+    MappedFile& operator=(MappedFile&& _other) noexcept
+    {
+        if (this != &_other)
+        {
+            Close();
+            Swap(_other);
+        }
+
+        return *this;
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // ReadOnly와 크기 0의 ReadWrite는 파일 크기 그대로 매핑한다. 열려 있던 파일은 먼저 닫는다.
+    bool Open(const std::string& _path, lfq::MappedFileMode _mode, size_t _size = 0) noexcept;
+
+    // 바뀐 페이지를 저장 장치까지 내려 쓴다
+    bool Flush(size_t _offset, size_t _length) noexcept;
+    bool Flush() noexcept { return Flush(0, m_size); }
+
+    void Close() noexcept;
+
+    bool IsOpen() const noexcept { return nullptr != m_data; }
+    unsigned char* GetData() noexcept { return m_data; }
+    const unsigned char* GetData() const noexcept { return m_data; }
+    size_t GetSize() const noexcept { return m_size; }
+
+private:
+    void Swap(MappedFile& _other) noexcept
+    {
+        std::swap(m_data, _other.m_data);
+        std::swap(m_size, _other.m_size);
+#ifdef _WIN32
+        std::swap(m_file, _other.m_file);
+        std::swap(m_mapping, _other.m_mapping);
+#else
+        std::swap(m_fd, _other.m_fd);
+#endif
+    }
+
+    unsigned char* m_data = nullptr;
+    size_t m_size = 0;
+
+#ifdef _WIN32
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+#else
+    int m_fd = -1;
+#endif
+};
+
+// ============================================================
+// 구현
+#ifdef _WIN32
+inline bool MappedFile::Open(const std::string& _path, lfq::MappedFileMode _mode, size_t _size) noexcept
+{
+    Close();
+
+    const bool _writable = _mode != lfq::MappedFileMode::ReadOnly;
+    m_file = CreateFileA(_path.c_str(),
+                         _writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+                         FILE_SHARE_READ | FILE_SHARE_WRITE,
+                         nullptr,
+                         _mode == lfq::MappedFileMode::Create ? CREATE_ALWAYS : OPEN_EXISTING,
+                         FILE_ATTRIBUTE_NORMAL,
+                         nullptr);
+    if (m_file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER _file_size{};
+    GetFileSizeEx(m_file, &_file_size);
+
+    size_t _map_size = _size;
+    if (_mode == lfq::MappedFileMode::ReadOnly || _map_size == 0)
+    {
+        _map_size = static_cast<size_t>(_file_size.QuadPart);
+    }
+
+    if (_map_size == 0)
+    {
+        Close();
+        return false;
+    }
+
+    const std::uint64_t _map_size64 = _map_size;
+    m_mapping = CreateFileMappingA(m_file, nullptr, _writable ? PAGE_READWRITE : PAGE_READONLY,
+                                   static_cast<DWORD>(_map_size64 >> 32), static_cast<DWORD>(_map_size64 & 0xffffffffu), nullptr);
+    if (nullptr == m_mapping)
+    {
+        Close();
+        return false;
+    }
+
+    m_data = static_cast<unsigned char*>(MapViewOfFile(m_mapping, _writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, _map_size));
+    if (nullptr == m_data)
+    {
+        Close();
+        return false;
+    }
+
+    m_size = _map_size;
+    return true;
+}
+
+inline bool MappedFile::Flush(size_t _offset, size_t _length) noexcept
+{
+    if (nullptr == m_data || _offset >= m_size)
+    {
+        return false;
+    }
+
+    if (_length > m_size - _offset)
+    {
+        _length = m_size - _offset;
+    }
+
+    return FALSE != FlushViewOfFile(m_data + _offset, _length) && FALSE != FlushFileBuffers(m_file);
+}
+
+inline void MappedFile::Close() noexcept
+{
+    if (nullptr != m_data)
+    {
+        UnmapViewOfFile(m_data);
+        m_data = nullptr;
+    }
+
+    if (nullptr != m_mapping)
+    {
+        CloseHandle(m_mapping);
+        m_mapping = nullptr;
+    }
+
+    if (m_file != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(m_file);
+        m_file = INVALID_HANDLE_VALUE;
+    }
+
+    m_size = 0;
+}
+#else
+inline bool MappedFile::Open(const std::string& _path, lfq::MappedFileMode _mode, size_t _size) noexcept
+{
+    Close();
+
+    int _flags = O_RDONLY;
+    if (_mode == lfq::MappedFileMode::ReadWrite)
+    {
+        _flags = O_RDWR;
+    }
+    else if (_mode == lfq::MappedFileMode::Create)
+    {
+        _flags = O_RDWR | O_CREAT | O_TRUNC;
+    }
+
+    m_fd = open(_path.c_str(), _flags | O_CLOEXEC, 0644);
+    if (m_fd < 0)
+    {
+        return false;
+    }
+
+    struct stat _status{};
+    if (fstat(m_fd, &_status) != 0)
+    {
+        Close();
+        return false;
+    }
+
+    size_t _map_size = _size;
+    if (_mode == lfq::MappedFileMode::ReadOnly || _map_size == 0)
+    {
+        _map_size = static_cast<size_t>(_status.st_size);
+    }
+    else if (static_cast<size_t>(_status.st_size) < _map_size && ftruncate(m_fd, static_cast<off_t>(_map_size)) != 0)
+    {
+        Close();
+        return false;
+    }
+
+    if (_map_size == 0)
+    {
+        Close();
+        return false;
+    }
+
+    const int _protection = _mode == lfq::MappedFileMode::ReadOnly ? PROT_READ : (PROT_READ | PROT_WRITE);
+    void* _data = mmap(nullptr, _map_size, _protection, MAP_SHARED, m_fd, 0);
+    if (_data == MAP_FAILED)
+    {
+        Close();
+        return false;
+    }
+
+    m_data = static_cast<unsigned char*>(_data);
+    m_size = _map_size;
+    return true;
+}
+
+inline bool MappedFile::Flush(size_t _offset, size_t _length) noexcept
+{
+    if (nullptr == m_data || _offset >= m_size)
+    {
+        return false;
+    }
+
+    if (_length > m_size - _offset)
+    {
+        _length = m_size - _offset;
+    }
+
+    // msync는 페이지 경계에서 시작해야 한다
+    const size_t _page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t _aligned_offset = _offset / _page_size * _page_size;
+
+    return msync(m_data + _aligned_offset, _length + (_offset - _aligned_offset), MS_SYNC) == 0;
+}
+
+inline void MappedFile::Close() noexcept
+{
+    if (nullptr != m_data)
+    {
+        munmap(m_data, m_size);
+        m_data = nullptr;
+    }
+
+    if (m_fd >= 0)
+    {
+        close(m_fd);
+        m_fd = -1;
+    }
+
+    m_size = 0;
+}
+#endif
@@ -1,15 +1,32 @@
+#pragma once
+
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
 #include "define.h"
 
+#ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable: 4324)
+#endif
+
+namespace lfq
+{
+    // generation과 값을 atomic word 하나에 함께 담는 슬롯을 사용할지 결정
+    // 32비트 이하의 trivially copyable 타입이면 기본으로 사용하며,
+    // 특정 타입에서 일반 슬롯을 강제하려면 false로 특수화한다.
+    template <typename T>
+    struct UsePackedSlot : std::bool_constant<std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(std::uint32_t)>
+    {
+    };
+}
 
 // Multi Producer Multi Consumer Lock-Free Queue
 // 여러 스레드에서 동시에 push/pop 작업을 수행하는 큐
 // CAS(Compare-And-Swap) 연산 사용
-template <typename T, size_t Size>
+template <typename T, size_t Size, bool PackedSlot = lfq::UsePackedSlot<T>::value>
 class MPMCQueue
 {
 public:
@@ -28,6 +45,7 @@ public:
 
     bool IsEmpty() const;
     size_t GetSize() const;
+    size_t GetApproximateSize() const noexcept;
     constexpr size_t GetCapacity() const { return Size; }
 
 private:
@@ -49,8 +67,8 @@ private:
 
 // ============================================================
 // 구현
-template <typename T, size_t Size>
-MPMCQueue<T, Size>::MPMCQueue() : m_head(0), m_tail(0)
+template <typename T, size_t Size, bool PackedSlot>
+MPMCQueue<T, Size, PackedSlot>::MPMCQueue() : m_head(0), m_tail(0)
 {
     static_assert(Size >= 2, "큐 크기는 2 이상이어야 함");
     static_assert((Size & (Size - 1)) == 0, "MPMCQueue - 큐 사이즈가 2의 제곱이어야 함");
@@ -63,8 +81,8 @@ MPMCQueue<T, Size>::MPMCQueue() : m_head(0), m_tail(0)
 }
 
 // lvalue 참조 버전 Push 구현 (Tail에 추가)
-template <typename T, size_t Size>
-bool MPMCQueue<T, Size>::Push(const T& _item) noexcept
+template <typename T, size_t Size, bool PackedSlot>
+bool MPMCQueue<T, Size, PackedSlot>::Push(const T& _item) noexcept
 {
     static_assert(std::is_nothrow_copy_assignable_v<T>, "T는 예외 없이 복사 대입할 수 있어야 함");
 
@@ -118,8 +136,8 @@ bool MPMCQueue<T, Size>::Push(const T& _item) noexcept
 }
 
 // (rvalue 참조 버전) Push 구현 (Tail에 추가)
-template <typename T, size_t Size>
-bool MPMCQueue<T, Size>::Push(T&& _item) noexcept
+template <typename T, size_t Size, bool PackedSlot>
+bool MPMCQueue<T, Size, PackedSlot>::Push(T&& _item) noexcept
 {
     static_assert(std::is_nothrow_move_assignable_v<T>, "T는 예외 없이 이동 대입할 수 있어야 함");
 
@@ -173,8 +191,8 @@ bool MPMCQueue<T, Size>::Push(T&& _item) noexcept
 }
 
 // Pop 구현 (Head에서 제거)
-template <typename T, size_t Size>
-bool MPMCQueue<T, Size>::Pop(T& _item) noexcept
+template <typename T, size_t Size, bool PackedSlot>
+bool MPMCQueue<T, Size, PackedSlot>::Pop(T& _item) noexcept
 {
     static_assert(std::is_nothrow_move_assignable_v<T>, "T는 예외 없이 이동 대입할 수 있어야 함");
 
@@ -222,8 +240,190 @@ bool MPMCQueue<T, Size>::Pop(T& _item) noexcept
     }
 }
 
+template <typename T, size_t Size, bool PackedSlot>
+bool MPMCQueue<T, Size, PackedSlot>::IsEmpty() const
+{
+    size_t _head = m_head.load(std::memory_order_acquire);
+    size_t _tail = m_tail.load(std::memory_order_acquire);
+    return _tail <= _head;
+}
+
+template <typename T, size_t Size, bool PackedSlot>
+size_t MPMCQueue<T, Size, PackedSlot>::GetSize() const
+{
+    size_t _head = m_head.load(std::memory_order_acquire);
+    size_t _tail = m_tail.load(std::memory_order_acquire);
+
+    if (_tail >= _head)
+    {
+        return _tail - _head;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+template <typename T, size_t Size, bool PackedSlot>
+size_t MPMCQueue<T, Size, PackedSlot>::GetApproximateSize() const noexcept
+{
+    const size_t _tail = m_tail.load(std::memory_order_relaxed);
+    const size_t _head = m_head.load(std::memory_order_relaxed);
+
+    return lfq::ClampApproximateSize(_head, _tail, Size);
+}
+
+// ============================================================
+// 작은 trivially copyable 타입용 특수화
+// 슬롯의 atomic word 하나에 상위 32비트 generation과 하위 32비트 값을 함께 담는다.
+// Push는 데이터 쓰기와 generation 공개가 한 번의 release store로 끝나고,
+// Pop은 generation을 확인한 acquire load에서 값까지 함께 읽는다.
+// generation은 32비트로 잘리므로 비교는 부호 있는 차이로 수행한다.
+template <typename T, size_t Size>
+class MPMCQueue<T, Size, true>
+{
+public:
+    MPMCQueue();
+    ~MPMCQueue() = default;
+
+    MPMCQueue(MPMCQueue&&) = delete;
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(MPMCQueue&&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    // 여러 스레드에서 안전 호출 가능
+    bool Push(const T& _item) noexcept;
+    bool Push(T&& _item) noexcept { return Push(static_cast<const T&>(_item)); }
+    bool Pop(T& _item) noexcept;
+
+    bool IsEmpty() const;
+    size_t GetSize() const;
+    size_t GetApproximateSize() const noexcept;
+    constexpr size_t GetCapacity() const { return Size; }
+
+private:
+    // 거짓 공유 방지를 위해 일반 슬롯과 동일하게 캐시 라인 단위로 정렬
+    struct alignas(lfq::CACHE_LINE_SIZE) Slot
+    {
+        std::atomic<std::uint64_t> _word;
+    };
+
+    static std::uint64_t Pack(size_t _generation, const T& _item) noexcept
+    {
+        std::uint32_t _bits = 0;
+        std::memcpy(&_bits, &_item, sizeof(T));
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(_generation)) << 32) | _bits;
+    }
+
+    // 슬롯 generation과 기대값의 차이 (0: 일치, 음수: 이전 바퀴, 양수: 다음 바퀴)
+    static std::int32_t CompareGeneration(std::uint64_t _word, size_t _expected) noexcept
+    {
+        return static_cast<std::int32_t>(static_cast<std::uint32_t>(_word >> 32) - static_cast<std::uint32_t>(_expected));
+    }
+
+    Slot m_buffer[Size];
+
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<size_t> m_head; // 읽기 인덱스
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<size_t> m_tail; // 쓰기 인덱스
+};
+
+template <typename T, size_t Size>
+MPMCQueue<T, Size, true>::MPMCQueue() : m_head(0), m_tail(0)
+{
+    static_assert(Size >= 2, "큐 크기는 2 이상이어야 함");
+    static_assert((Size & (Size - 1)) == 0, "MPMCQueue - 큐 사이즈가 2의 제곱이어야 함");
+    static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(std::uint32_t), "T는 32비트 이하의 trivially copyable 타입이어야 함");
+
+    for (size_t i = 0; i < Size; ++i)
+    {
+        m_buffer[i]._word.store(static_cast<std::uint64_t>(i) << 32, std::memory_order_relaxed);
+    }
+}
+
+template <typename T, size_t Size>
+bool MPMCQueue<T, Size, true>::Push(const T& _item) noexcept
+{
+    size_t _tail = m_tail.load(std::memory_order_relaxed); // Write Index
+
+    while (true)
+    {
+        Slot& _slot = m_buffer[_tail & (Size - 1)];
+        const std::int32_t _difference = CompareGeneration(_slot._word.load(std::memory_order_acquire), _tail);
+
+        if (_difference == 0)
+        {
+            if (m_tail.compare_exchange_weak(_tail, _tail + 1, std::memory_order_relaxed))
+            {
+                // 값과 generation을 한 번에 공개
+                _slot._word.store(Pack(_tail + 1, _item), std::memory_order_release);
+                return true;
+            }
+        }
+        else if (_difference < 0)
+        {
+            // 이전 바퀴의 값이 아직 소비되지 않음
+            size_t _head = m_head.load(std::memory_order_acquire);
+
+            if (_tail >= _head + Size)
+            {
+                return false; // 큐가 가득 참
+            }
+
+            _tail = m_tail.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            // 다른 스레드가 이미 이 위치에 Push 진행 중
+            _tail = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T, size_t Size>
+bool MPMCQueue<T, Size, true>::Pop(T& _item) noexcept
+{
+    size_t _head = m_head.load(std::memory_order_relaxed); // Read Index
+
+    while (true)
+    {
+        Slot& _slot = m_buffer[_head & (Size - 1)];
+        const std::uint64_t _word = _slot._word.load(std::memory_order_acquire);
+        const std::int32_t _difference = CompareGeneration(_word, _head + 1);
+
+        if (_difference == 0)
+        {
+            if (m_head.compare_exchange_weak(_head, _head + 1, std::memory_order_relaxed))
+            {
+                // generation이 _head + 1인 동안 슬롯은 바뀌지 않으므로 앞서 읽은 word의 값을 사용
+                const std::uint32_t _bits = static_cast<std::uint32_t>(_word);
+                std::memcpy(&_item, &_bits, sizeof(T));
+
+                // 다음 바퀴의 Push가 사용할 수 있도록 generation 갱신
+                _slot._word.store(static_cast<std::uint64_t>(static_cast<std::uint32_t>(_head + Size)) << 32, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (_difference < 0)
+        {
+            // 큐가 비었거나 Push가 진행 중임
+            size_t _tail = m_tail.load(std::memory_order_acquire);
+
+            if (_head >= _tail)
+            {
+                return false; // Empty
+            }
+
+            _head = m_head.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            _head = m_head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
 template <typename T, size_t Size>
-bool MPMCQueue<T, Size>::IsEmpty() const
+bool MPMCQueue<T, Size, true>::IsEmpty() const
 {
     size_t _head = m_head.load(std::memory_order_acquire);
     size_t _tail = m_tail.load(std::memory_order_acquire);
@@ -231,7 +431,7 @@ bool MPMCQueue<T, Size>::IsEmpty() const
 }
 
 template <typename T, size_t Size>
-size_t MPMCQueue<T, Size>::GetSize() const
+size_t MPMCQueue<T, Size, true>::GetSize() const
 {
     size_t _head = m_head.load(std::memory_order_acquire);
     size_t _tail = m_tail.load(std::memory_order_acquire);
@@ -246,4 +446,15 @@ size_t MPMCQueue<T, Size>::GetSize() const
     }
 }
 
+template <typename T, size_t Size>
+size_t MPMCQueue<T, Size, true>::GetApproximateSize() const noexcept
+{
+    const size_t _tail = m_tail.load(std::memory_order_relaxed);
+    const size_t _head = m_head.load(std::memory_order_relaxed);
+
+    return lfq::ClampApproximateSize(_head, _tail, Size);
+}
+
+#ifdef _MSC_VER
 #pragma warning(pop)
+#endif
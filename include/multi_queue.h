@@ -0,0 +1,460 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "define.h"
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324) // 구조체가 alignas로 패딩됨
+#endif
+
+namespace lfq
+{
+    // 비어 있는 힙의 최솟값 표시
+    constexpr std::uint64_t EMPTY_PRIORITY = std::numeric_limits<std::uint64_t>::max();
+
+    // 스레드별 xorshift64* 난수. 큐를 고르는 데만 쓰므로 품질보다 속도를 우선한다.
+    inline std::uint64_t GetThreadRandom() noexcept
+    {
+        // 0이 아닌 홀수 두 개의 곱이므로 초기 상태는 0이 될 수 없다
+        thread_local std::uint64_t t_state = (std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1) * 0x9E3779B97F4A7C15ull;
+
+        t_state ^= t_state >> 12;
+        t_state ^= t_state << 25;
+        t_state ^= t_state >> 27;
+        return t_state * 0x2545F4914F6CDD1Dull;
+    }
+
+    // MultiQueue 항목. 우선순위 값이 작을수록 먼저 나간다 (마감 시각을 그대로 쓸 수 있다).
+    template <typename T>
+    struct PriorityEntry
+    {
+        std::uint64_t _priority;
+        T _item;
+    };
+}
+
+// Relaxed Multi Producer Multi Consumer 우선순위 큐 (MultiQueue)
+// 잠금을 따로 가진 힙 여러 개로 이루어지며, 힙 개수는 보통 스레드 수의 2~4배로 잡는다.
+// - Push: 임의의 힙 하나에 넣는다. 잠금을 바로 잡지 못하면 다른 힙을 고른다.
+// - Pop: 임의의 힙 두 개의 최솟값을 비교해 더 작은 쪽에서 꺼낸다.
+// 전체 최솟값 대신 "거의 최솟값"을 꺼내는 대가로 단일 힙의 잠금 경쟁이 사라진다.
+// 꺼낸 항목보다 작은 항목 수(순위 오차)의 기댓값은 힙 개수에 비례한다.
+//
+// 각 힙의 최솟값을 atomic으로 공개하므로 Pop은 잠금 없이 두 힙을 비교한 뒤 고른 힙만 잠근다.
+// 힙은 필요한 만큼 커지며, 메모리 할당에 실패하면 Push가 std::bad_alloc을 던진다.
+// 스레드별 삽입/삭제 버퍼가 필요하면 MultiQueueHandle을 사용한다.
+template <typename T>
+class MultiQueue
+{
+public:
+    using Entry = lfq::PriorityEntry<T>;
+
+    explicit MultiQueue(size_t _queue_count);
+    ~MultiQueue() = default;
+
+    MultiQueue(MultiQueue&&) = delete;
+    MultiQueue(const MultiQueue&) = delete;
+    MultiQueue& operator=(MultiQueue&&) = delete;
+    MultiQueue& operator=(const MultiQueue&) = delete;
+
+    // 여러 스레드에서 안전 호출 가능
+    void Push(std::uint64_t _priority, const T& _item);
+    bool Pop(std::uint64_t& _priority, T& _item) noexcept;
+
+    // 묶음 연산: 임의의 힙 하나를 한 번 잠그고 여러 항목을 넣거나 꺼낸다.
+    // PopBatch는 고른 힙에서 작은 순서대로 최대 _max_count개를 꺼내 _entries에 오름차순으로 채운다.
+    void PushBatch(const Entry* _entries, size_t _count);
+    size_t PopBatch(Entry* _entries, size_t _max_count) noexcept;
+
+    bool IsEmpty() const noexcept { return GetApproximateSize() == 0; }
+    size_t GetApproximateSize() const noexcept;
+    size_t GetQueueCount() const noexcept { return m_queue_count; }
+
+private:
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>, "T는 예외 없이 이동할 수 있어야 함");
+
+    struct alignas(lfq::CACHE_LINE_SIZE) LocalHeap
+    {
+        std::atomic<bool> _locked{false};
+        std::atomic<std::uint64_t> _top_priority{lfq::EMPTY_PRIORITY};  // 잠금 없이 비교하는 최솟값
+        std::atomic<size_t> _size{0};
+        std::vector<Entry> _entries;  // 최소 힙 (잠금을 잡은 스레드만 접근)
+    };
+
+    // 잠금을 잡은 동안만 살아 있는 가드. 풀기 전에 힙의 최솟값과 크기를 다시 공개한다 (예외로 빠져나가도 마찬가지).
+    class HeapLock
+    {
+    public:
+        explicit HeapLock(LocalHeap& _heap) noexcept : m_heap(_heap) {}
+        ~HeapLock()
+        {
+            Publish(m_heap);
+            m_heap._locked.store(false, std::memory_order_release);
+        }
+
+        HeapLock(const HeapLock&) = delete;
+        HeapLock& operator=(const HeapLock&) = delete;
+
+    private:
+        LocalHeap& m_heap;
+    };
+
+    static bool IsLater(const Entry& _left, const Entry& _right) noexcept { return _left._priority > _right._priority; }
+
+    static bool TryLock(LocalHeap& _heap) noexcept;
+    static void Lock(LocalHeap& _heap) noexcept;
+
+    // 잠금을 잡은 상태에서 최솟값과 크기를 공개한다
+    static void Publish(LocalHeap& _heap) noexcept;
+
+    // 잠금을 잡은 상태에서 최솟값 하나를 꺼낸다
+    static void PopLocked(LocalHeap& _heap, std::uint64_t& _priority, T& _item) noexcept;
+
+    // 잠금을 잡을 수 있는 임의의 힙을 고른다
+    LocalHeap& LockRandomHeap() noexcept;
+
+    // 두 임의 힙 중 최솟값이 작은 쪽을 잠근다. 모든 힙이 비어 보이면 nullptr을 반환한다.
+    LocalHeap* LockBetterHeap() noexcept;
+
+    LocalHeap& GetRandomHeap() noexcept { return m_heaps[static_cast<size_t>(lfq::GetThreadRandom() % m_queue_count)]; }
+
+    const size_t m_queue_count;
+    std::unique_ptr<LocalHeap[]> m_heaps;
+};
+
+// 스레드 하나가 소유하는 MultiQueue 프런트엔드 (삽입/삭제 버퍼)
+// - Push: 삽입 버퍼에 모았다가 가득 차면 PushBatch로 임의의 힙 하나에 한 번에 넣는다.
+// - Pop: 삭제 버퍼가 비면 PopBatch로 고른 힙의 작은 항목 여러 개를 가져오고,
+//        삭제 버퍼의 맨 앞과 삽입 버퍼의 최솟값 중 작은 쪽을 반환한다.
+// 잠금 횟수가 버퍼 크기만큼 줄어드는 대신, 버퍼에 있는 항목은 다른 스레드에게 보이지 않으므로 순위 오차가 커진다.
+// 소멸하거나 Flush를 호출하면 두 버퍼의 항목을 모두 큐에 돌려놓는다.
+// 소멸 중 힙을 늘리다 std::bad_alloc(또는 T 복사 예외)이 나면 예외를 삼키고 아직 넣지 못한 항목은 버린다.
+template <typename T>
+class MultiQueueHandle
+{
+public:
+    using Entry = lfq::PriorityEntry<T>;
+
+    MultiQueueHandle(MultiQueue<T>& _queue, size_t _insert_buffer_size = 16, size_t _delete_buffer_size = 16);
+    ~MultiQueueHandle();
+
+    MultiQueueHandle(MultiQueueHandle&&) = delete;
+    MultiQueueHandle(const MultiQueueHandle&) = delete;
+    MultiQueueHandle& operator=(MultiQueueHandle&&) = delete;
+    MultiQueueHandle& operator=(const MultiQueueHandle&) = delete;
+
+    void Push(std::uint64_t _priority, const T& _item);
+    bool Pop(std::uint64_t& _priority, T& _item) noexcept;
+
+    // 버퍼에 남은 항목을 모두 큐에 넣는다
+    void Flush();
+
+    size_t GetBufferedCount() const noexcept { return m_insert_buffer.size() + (m_delete_buffer.size() - m_delete_index); }
+
+private:
+    MultiQueue<T>& m_queue;
+    const size_t m_insert_buffer_size;
+    const size_t m_delete_buffer_size;
+
+    std::vector<Entry> m_insert_buffer;
+    std::vector<Entry> m_delete_buffer;  // 오름차순, m_delete_index부터 남아 있음
+    size_t m_delete_index = 0;
+};
+
+// ============================================================
+// 구현
+template <typename T>
+MultiQueue<T>::MultiQueue(size_t _queue_count)
+    : m_queue_count(_queue_count < 2 ? 2 : _queue_count),
+      m_heaps(std::make_unique<LocalHeap[]>(m_queue_count))
+{
+}
+
+template <typename T>
+bool MultiQueue<T>::TryLock(LocalHeap& _heap) noexcept
+{
+    return false == _heap._locked.load(std::memory_order_relaxed) &&
+           false == _heap._locked.exchange(true, std::memory_order_acquire);
+}
+
+template <typename T>
+void MultiQueue<T>::Lock(LocalHeap& _heap) noexcept
+{
+    while (false == TryLock(_heap))
+    {
+        std::this_thread::yield();
+    }
+}
+
+template <typename T>
+void MultiQueue<T>::Publish(LocalHeap& _heap) noexcept
+{
+    _heap._top_priority.store(true == _heap._entries.empty() ? lfq::EMPTY_PRIORITY : _heap._entries.front()._priority, std::memory_order_relaxed);
+    _heap._size.store(_heap._entries.size(), std::memory_order_relaxed);
+}
+
+template <typename T>
+void MultiQueue<T>::PopLocked(LocalHeap& _heap, std::uint64_t& _priority, T& _item) noexcept
+{
+    std::pop_heap(_heap._entries.begin(), _heap._entries.end(), IsLater);
+
+    Entry& _entry = _heap._entries.back();
+    _priority = _entry._priority;
+    _item = std::move(_entry._item);
+    _heap._entries.pop_back();
+}
+
+template <typename T>
+typename MultiQueue<T>::LocalHeap& MultiQueue<T>::LockRandomHeap() noexcept
+{
+    while (true)
+    {
+        LocalHeap& _heap = GetRandomHeap();
+        if (true == TryLock(_heap))
+        {
+            return _heap;
+        }
+    }
+}
+
+template <typename T>
+typename MultiQueue<T>::LocalHeap* MultiQueue<T>::LockBetterHeap() noexcept
+{
+    // 두 힙이 모두 비어 보이는 일이 몇 번 반복되면 전체를 훑어 정말 비었는지 확인한다
+    constexpr size_t EmptyRetryCount = 4;
+
+    for (size_t _empty_count = 0; _empty_count < EmptyRetryCount;)
+    {
+        LocalHeap& _first = GetRandomHeap();
+        LocalHeap& _second = GetRandomHeap();
+        const std::uint64_t _first_priority = _first._top_priority.load(std::memory_order_relaxed);
+        const std::uint64_t _second_priority = _second._top_priority.load(std::memory_order_relaxed);
+
+        if (_first_priority == lfq::EMPTY_PRIORITY && _second_priority == lfq::EMPTY_PRIORITY)
+        {
+            ++_empty_count;
+            continue;
+        }
+
+        LocalHeap& _better = _first_priority <= _second_priority ? _first : _second;
+        if (false == TryLock(_better))
+        {
+            continue;
+        }
+
+        // 비교한 뒤 다른 스레드가 비웠을 수 있다
+        if (false == _better._entries.empty())
+        {
+            return &_better;
+        }
+
+        _better._locked.store(false, std::memory_order_release);
+    }
+
+    for (size_t i = 0; i < m_queue_count; ++i)
+    {
+        LocalHeap& _heap = m_heaps[i];
+        if (_heap._top_priority.load(std::memory_order_relaxed) == lfq::EMPTY_PRIORITY)
+        {
+            continue;
+        }
+
+        Lock(_heap);
+        if (false == _heap._entries.empty())
+        {
+            return &_heap;
+        }
+
+        _heap._locked.store(false, std::memory_order_release);
+    }
+
+    return nullptr;
+}
+
+template <typename T>
+void MultiQueue<T>::Push(std::uint64_t _priority, const T& _item)
+{
+    LocalHeap& _heap = LockRandomHeap();
+    HeapLock _lock(_heap);
+
+    _heap._entries.push_back(Entry{_priority, _item});
+    std::push_heap(_heap._entries.begin(), _heap._entries.end(), IsLater);
+}
+
+template <typename T>
+bool MultiQueue<T>::Pop(std::uint64_t& _priority, T& _item) noexcept
+{
+    LocalHeap* const _heap = LockBetterHeap();
+    if (nullptr == _heap)
+    {
+        return false;
+    }
+
+    HeapLock _lock(*_heap);
+    PopLocked(*_heap, _priority, _item);
+    return true;
+}
+
+template <typename T>
+void MultiQueue<T>::PushBatch(const Entry* _entries, size_t _count)
+{
+    if (_count == 0)
+    {
+        return;
+    }
+
+    LocalHeap& _heap = LockRandomHeap();
+    HeapLock _lock(_heap);
+
+    for (size_t i = 0; i < _count; ++i)
+    {
+        _heap._entries.push_back(_entries[i]);
+        std::push_heap(_heap._entries.begin(), _heap._entries.end(), IsLater);
+    }
+
+}
+
+template <typename T>
+size_t MultiQueue<T>::PopBatch(Entry* _entries, size_t _max_count) noexcept
+{
+    if (_max_count == 0)
+    {
+        return 0;
+    }
+
+    LocalHeap* const _heap = LockBetterHeap();
+    if (nullptr == _heap)
+    {
+        return 0;
+    }
+
+    HeapLock _lock(*_heap);
+
+    size_t _count = 0;
+    while (_count < _max_count && false == _heap->_entries.empty())
+    {
+        PopLocked(*_heap, _entries[_count]._priority, _entries[_count]._item);
+        ++_count;
+    }
+
+    return _count;
+}
+
+template <typename T>
+size_t MultiQueue<T>::GetApproximateSize() const noexcept
+{
+    size_t _size = 0;
+    for (size_t i = 0; i < m_queue_count; ++i)
+    {
+        _size += m_heaps[i]._size.load(std::memory_order_relaxed);
+    }
+
+    return _size;
+}
+
+template <typename T>
+MultiQueueHandle<T>::MultiQueueHandle(MultiQueue<T>& _queue, size_t _insert_buffer_size, size_t _delete_buffer_size)
+    : m_queue(_queue),
+      m_insert_buffer_size(_insert_buffer_size == 0 ? 1 : _insert_buffer_size),
+      m_delete_buffer_size(_delete_buffer_size == 0 ? 1 : _delete_buffer_size)
+{
+    m_insert_buffer.reserve(m_insert_buffer_size);
+    m_delete_buffer.resize(m_delete_buffer_size);
+    m_delete_index = m_delete_buffer_size;
+}
+
+template <typename T>
+MultiQueueHandle<T>::~MultiQueueHandle()
+{
+    // 소멸자는 noexcept이므로 Flush의 할당 실패가 std::terminate로 이어지지 않게 막는다
+    try
+    {
+        Flush();
+    }
+    catch (...)
+    {
+    }
+}
+
+template <typename T>
+void MultiQueueHandle<T>::Push(std::uint64_t _priority, const T& _item)
+{
+    m_insert_buffer.push_back(Entry{_priority, _item});
+
+    if (m_insert_buffer.size() >= m_insert_buffer_size)
+    {
+        m_queue.PushBatch(m_insert_buffer.data(), m_insert_buffer.size());
+        m_insert_buffer.clear();
+    }
+}
+
+template <typename T>
+bool MultiQueueHandle<T>::Pop(std::uint64_t& _priority, T& _item) noexcept
+{
+    if (m_delete_index == m_delete_buffer.size())
+    {
+        const size_t _count = m_queue.PopBatch(m_delete_buffer.data(), m_delete_buffer_size);
+
+        // 남은 항목을 버퍼 뒤쪽으로 옮겨 m_delete_index부터 읽게 한다
+        std::move_backward(m_delete_buffer.begin(), m_delete_buffer.begin() + static_cast<std::ptrdiff_t>(_count), m_delete_buffer.end());
+        m_delete_index = m_delete_buffer.size() - _count;
+    }
+
+    // 삽입 버퍼의 최솟값이 더 작으면 그것을 먼저 꺼낸다
+    auto _insert_best = std::min_element(m_insert_buffer.begin(), m_insert_buffer.end(), [](const Entry& _left, const Entry& _right)
+    {
+        return _left._priority < _right._priority;
+    });
+
+    const bool _has_deleted = m_delete_index < m_delete_buffer.size();
+    if (_insert_best != m_insert_buffer.end() &&
+        (false == _has_deleted || _insert_best->_priority < m_delete_buffer[m_delete_index]._priority))
+    {
+        _priority = _insert_best->_priority;
+        _item = std::move(_insert_best->_item);
+
+        // 최솟값이 마지막 원소이면 자기 자신으로 이동 대입하지 않는다
+        if (_insert_best != m_insert_buffer.end() - 1)
+        {
+            *_insert_best = std::move(m_insert_buffer.back());
+        }
+
+        m_insert_buffer.pop_back();
+        return true;
+    }
+
+    if (false == _has_deleted)
+    {
+        return false;
+    }
+
+    Entry& _entry = m_delete_buffer[m_delete_index++];
+    _priority = _entry._priority;
+    _item = std::move(_entry._item);
+    return true;
+}
+
+template <typename T>
+void MultiQueueHandle<T>::Flush()
+{
+    m_queue.PushBatch(m_insert_buffer.data(), m_insert_buffer.size());
+    m_insert_buffer.clear();
+
+    m_queue.PushBatch(m_delete_buffer.data() + m_delete_index, m_delete_buffer.size() - m_delete_index);
+    m_delete_index = m_delete_buffer.size();
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -4,8 +4,10 @@
 #include <cstddef>
 #include "define.h"
 
+#ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable: 4324) // 구조체가 alignas로 패딩됨
+#endif
 
 // Two-Lock Multi Producer Multi Consumer Queue
 // 성능 비교를 위한 two-lock 기반 큐
@@ -29,6 +31,7 @@ public:
 
     bool IsEmpty() const;
     size_t GetSize() const;
+    size_t GetApproximateSize() const noexcept;
     constexpr size_t GetCapacity() const { return Size; }
 
 private:
@@ -155,4 +158,15 @@ size_t MutexQueue<T, Size>::GetSize() const
     }
 }
 
+template <typename T, size_t Size>
+size_t MutexQueue<T, Size>::GetApproximateSize() const noexcept
+{
+    const size_t _tail = m_tail.load(std::memory_order_relaxed);
+    const size_t _head = m_head.load(std::memory_order_relaxed);
+
+    return lfq::ClampApproximateSize(_head, _tail, Size);
+}
+
+#ifdef _MSC_VER
 #pragma warning(pop)
+#endif
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include "define.h"
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324) // 구조체가 alignas로 패딩됨
+#endif
+
+// 고정 용량 Lock-Free 오브젝트 풀
+// 큰 페이로드를 큐에 복사하지 않고 32비트 핸들만 전달하기 위해 사용한다.
+// 빈 객체는 tagged-index Treiber 스택으로 관리하며, 스레드별 Cache(매거진)를
+// 사용하면 대부분의 Acquire/Release가 공유 상태에 접근하지 않는다.
+// 객체는 풀 생성 시 한 번만 기본 생성되며 Release 시 초기화되지 않는다.
+template <typename T, size_t Capacity, size_t MagazineSize = 32>
+class ObjectPool
+{
+public:
+    using Handle = std::uint32_t;
+    static constexpr Handle INVALID_HANDLE = std::numeric_limits<Handle>::max();
+
+    // 한 스레드가 소유하는 핸들 매거진
+    // 매거진이 비면 공유 스택에서 절반을 한 번의 CAS로 가져오고,
+    // 가득 차면 절반을 연결 리스트로 묶어 한 번의 CAS로 반납한다.
+    // 소멸 시 남은 핸들을 모두 풀에 반납한다.
+    class Cache
+    {
+    public:
+        explicit Cache(ObjectPool& _pool) : m_pool(_pool), m_count(0) {}
+        ~Cache() { m_pool.ReleaseBatch(m_handles, m_count); }
+
+        Cache(Cache&&) = delete;
+        Cache(const Cache&) = delete;
+        Cache& operator=(Cache&&) = delete;
+        Cache& operator=(const Cache&) = delete;
+
+    private:
+        friend class ObjectPool;
+
+        ObjectPool& m_pool;
+        size_t m_count;
+        Handle m_handles[MagazineSize];
+    };
+
+    ObjectPool();
+    ~ObjectPool() = default;
+
+    ObjectPool(ObjectPool&&) = delete;
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(ObjectPool&&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // 여러 스레드에서 안전 호출 가능 (공유 스택 직접 사용)
+    // 풀이 비어 있으면 INVALID_HANDLE 반환
+    Handle Acquire() noexcept;
+    void Release(Handle _handle) noexcept;
+
+    // 호출 스레드가 소유한 Cache를 통해 획득/반납
+    Handle Acquire(Cache& _cache) noexcept;
+    void Release(Cache& _cache, Handle _handle) noexcept;
+
+    T& Get(Handle _handle) noexcept { return m_objects[_handle]; }
+    const T& Get(Handle _handle) const noexcept { return m_objects[_handle]; }
+    Handle GetHandle(const T* _object) const noexcept { return static_cast<Handle>(_object - m_objects); }
+
+    constexpr size_t GetCapacity() const { return Capacity; }
+
+private:
+    // 스택 top은 상위 32비트 tag와 하위 32비트 index로 구성된다.
+    // 성공한 CAS마다 tag를 증가시켜 ABA 문제를 막는다.
+    static constexpr std::uint64_t Pack(std::uint32_t _tag, Handle _index) noexcept
+    {
+        return (static_cast<std::uint64_t>(_tag) << 32) | _index;
+    }
+    static constexpr std::uint32_t GetTag(std::uint64_t _top) noexcept { return static_cast<std::uint32_t>(_top >> 32); }
+    static constexpr Handle GetIndex(std::uint64_t _top) noexcept { return static_cast<Handle>(_top); }
+
+    size_t AcquireBatch(Handle* _out, size_t _max_count) noexcept;
+    void ReleaseBatch(const Handle* _handles, size_t _count) noexcept;
+
+    T m_objects[Capacity];
+    std::atomic<Handle> m_next[Capacity];
+
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<std::uint64_t> m_top;
+};
+
+// ============================================================
+// 구현
+template <typename T, size_t Capacity, size_t MagazineSize>
+ObjectPool<T, Capacity, MagazineSize>::ObjectPool() : m_top(Pack(0, 0))
+{
+    static_assert(Capacity > 0, "풀 용량은 0보다 커야 함");
+    static_assert(Capacity < INVALID_HANDLE, "풀 용량은 핸들 범위를 넘을 수 없음");
+    static_assert(MagazineSize >= 2, "매거진 크기는 2 이상이어야 함");
+
+    // 0 -> 1 -> ... -> Capacity - 1 순서로 빈 객체를 연결
+    for (size_t i = 0; i + 1 < Capacity; ++i)
+    {
+        m_next[i].store(static_cast<Handle>(i + 1), std::memory_order_relaxed);
+    }
+    m_next[Capacity - 1].store(INVALID_HANDLE, std::memory_order_relaxed);
+}
+
+template <typename T, size_t Capacity, size_t MagazineSize>
+typename ObjectPool<T, Capacity, MagazineSize>::Handle ObjectPool<T, Capacity, MagazineSize>::Acquire() noexcept
+{
+    Handle _handle = INVALID_HANDLE;
+    AcquireBatch(&_handle, 1);
+    return _handle;
+}
+
+template <typename T, size_t Capacity, size_t MagazineSize>
+void ObjectPool<T, Capacity, MagazineSize>::Release(Handle _handle) noexcept
+{
+    ReleaseBatch(&_handle, 1);
+}
+
+template <typename T, size_t Capacity, size_t MagazineSize>
+typename ObjectPool<T, Capacity, MagazineSize>::Handle ObjectPool<T, Capacity, MagazineSize>::Acquire(Cache& _cache) noexcept
+{
+    if (_cache.m_count == 0)
+    {
+        // 매거진의 절반만 채워 두어 곧바로 Release가 이어져도 반납이 일어나지 않게 함
+        _cache.m_count = AcquireBatch(_cache.m_handles, MagazineSize / 2);
+
+        if (_cache.m_count == 0)
+        {
+            return INVALID_HANDLE;
+        }
+    }
+
+    return _cache.m_handles[--_cache.m_count];
+}
+
+template <typename T, size_t Capacity, size_t MagazineSize>
+void ObjectPool<T, Capacity, MagazineSize>::Release(Cache& _cache, Handle _handle) noexcept
+{
+    if (_cache.m_count == MagazineSize)
+    {
+        // 오래된 절반을 반납하고 최근 핸들(캐시에 남아 있을 가능성이 높음)은 유지
+        constexpr size_t _flush_count = MagazineSize / 2;
+        ReleaseBatch(_cache.m_handles, _flush_count);
+
+        for (size_t i = _flush_count; i < MagazineSize; ++i)
+        {
+            _cache.m_handles[i - _flush_count] = _cache.m_handles[i];
+        }
+        _cache.m_count = MagazineSize - _flush_count;
+    }
+
+    _cache.m_handles[_cache.m_count++] = _handle;
+}
+
+// 스택에서 최대 _max_count개의 핸들을 한 번의 CAS로 가져온다.
+// CAS 시점까지 tag가 그대로라면 그 사이 스택이 변경되지 않았으므로
+// 읽어 둔 next 체인도 유효하다.
+template <typename T, size_t Capacity, size_t MagazineSize>
+size_t ObjectPool<T, Capacity, MagazineSize>::AcquireBatch(Handle* _out, size_t _max_count) noexcept
+{
+    std::uint64_t _top = m_top.load(std::memory_order_acquire);
+
+    while (true)
+    {
+        Handle _index = GetIndex(_top);
+        size_t _count = 0;
+
+        while (_index != INVALID_HANDLE && _count < _max_count)
+        {
+            _out[_count++] = _index;
+            _index = m_next[_index].load(std::memory_order_relaxed);
+        }
+
+        if (_count == 0)
+        {
+            // 풀이 비어 있음
+            return 0;
+        }
+
+        if (m_top.compare_exchange_weak(_top, Pack(GetTag(_top) + 1, _index), std::memory_order_acquire, std::memory_order_acquire))
+        {
+            return _count;
+        }
+    }
+}
+
+// 핸들들을 next로 연결한 뒤 체인 전체를 한 번의 CAS로 스택에 올린다.
+template <typename T, size_t Capacity, size_t MagazineSize>
+void ObjectPool<T, Capacity, MagazineSize>::ReleaseBatch(const Handle* _handles, size_t _count) noexcept
+{
+    if (_count == 0)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i + 1 < _count; ++i)
+    {
+        m_next[_handles[i]].store(_handles[i + 1], std::memory_order_relaxed);
+    }
+
+    const Handle _last = _handles[_count - 1];
+    std::uint64_t _top = m_top.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        m_next[_last].store(GetIndex(_top), std::memory_order_relaxed);
+
+        // release: 반납 전 객체에 쓴 내용이 다음 획득 스레드에 보이도록 함
+        if (m_top.compare_exchange_weak(_top, Pack(GetTag(_top) + 1, _handles[0]), std::memory_order_release, std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
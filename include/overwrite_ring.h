@@ -0,0 +1,279 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include "define.h"
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+// 가득 차면 가장 오래된 항목을 덮어쓰는 손실 허용 링 (트레이스 버퍼, flight recorder용)
+// MPMCQueue와 같은 generation 태그 슬롯을 쓰지만, Push는 소비자를 기다리지 않고 실패하지도 않는다.
+//
+// - Push: 여러 스레드에서 호출 가능. tail을 fetch_add로 받아 sequence 번호로 쓰고 슬롯을 덮어쓴다.
+//   한 바퀴 앞선 생산자가 같은 슬롯에 아직 쓰는 드문 경우에만 그 쓰기가 끝나길 기다린다.
+// - Pop: 소비자 하나만 호출. 슬롯의 sequence로 덮어쓰인 항목을 알아내 건너뛰고 손실 수에 더한다.
+// - Snapshot: 어느 스레드에서나 호출 가능. 소비하지 않고 최근 항목을 복사한다 (크래시 진단용).
+//
+// 슬롯의 sequence는 seqlock으로도 쓰인다. 항목 t를 쓰는 중이면 2t+1, 다 썼으면 2t+2이며,
+// 값을 읽는 동안 sequence가 바뀌면 찢어진 읽기로 보고 버린다. 따라서 T는 trivially copyable이어야 한다.
+template <typename T, size_t Size>
+class OverwriteRing
+{
+public:
+    OverwriteRing();
+    ~OverwriteRing() = default;
+
+    OverwriteRing(OverwriteRing&&) = delete;
+    OverwriteRing(const OverwriteRing&) = delete;
+    OverwriteRing& operator=(OverwriteRing&&) = delete;
+    OverwriteRing& operator=(const OverwriteRing&) = delete;
+
+    // 여러 스레드에서 안전 호출 가능
+    // 항목의 sequence 번호를 반환한다
+    std::uint64_t Push(const T& _item) noexcept;
+
+    // 소비자 하나만 호출
+    // 다음으로 남아 있는 항목을 꺼낸다. 덮어쓰여 사라진 항목은 GetLostCount에 더해진다.
+    bool Pop(T& _item) noexcept;
+    bool Pop(T& _item, std::uint64_t& _sequence) noexcept;
+
+    // 여러 스레드에서 안전 호출 가능
+    // 최근 항목을 최대 _max_count개까지 오래된 것부터 _items에 복사하고 복사한 수를 반환한다.
+    // 복사하는 도중 덮어쓰이거나 아직 쓰는 중인 항목은 빠진다.
+    size_t Snapshot(T* _items, size_t _max_count) const noexcept;
+
+    bool IsEmpty() const;
+    size_t GetSize() const;
+    std::uint64_t GetPushCount() const { return m_tail.load(std::memory_order_acquire); }
+    std::uint64_t GetLostCount() const { return m_lost_count.load(std::memory_order_relaxed); }
+    constexpr size_t GetCapacity() const { return Size; }
+
+private:
+    static_assert(std::is_trivially_copyable_v<T>, "T는 trivially copyable이어야 함");
+
+    static constexpr size_t WORD_COUNT = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    struct alignas(lfq::CACHE_LINE_SIZE) Slot
+    {
+        // 0: 빈 슬롯, 2t+1: 항목 t를 쓰는 중, 2t+2: 항목 t를 다 씀
+        std::atomic<std::uint64_t> _sequence;
+        std::atomic<std::uint64_t> _words[WORD_COUNT];
+    };
+
+    // 슬롯이 항목 _ticket을 담고 있으면 값을 읽어 true를 반환
+    bool TryRead(const Slot& _slot, std::uint64_t _ticket, T& _item) const noexcept;
+
+    Slot m_buffer[Size];
+
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<std::uint64_t> m_tail; // 다음 sequence 번호
+
+    // 소비자 쪽: 다음에 읽을 sequence 번호와 건너뛴 항목 수
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<std::uint64_t> m_head;
+    std::atomic<std::uint64_t> m_lost_count;
+};
+
+// ============================================================
+// 구현
+template <typename T, size_t Size>
+OverwriteRing<T, Size>::OverwriteRing() : m_tail(0), m_head(0), m_lost_count(0)
+{
+    static_assert(Size >= 2, "큐 크기는 2 이상이어야 함");
+    static_assert((Size & (Size - 1)) == 0, "OverwriteRing - 큐 사이즈가 2의 제곱이어야 함");
+
+    for (Slot& _slot : m_buffer)
+    {
+        _slot._sequence.store(0, std::memory_order_relaxed);
+        for (auto& _word : _slot._words)
+        {
+            _word.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T, size_t Size>
+std::uint64_t OverwriteRing<T, Size>::Push(const T& _item) noexcept
+{
+    const std::uint64_t _ticket = m_tail.fetch_add(1, std::memory_order_relaxed);
+    Slot& _slot = m_buffer[_ticket & (Size - 1)];
+
+    std::uint64_t _buffer[WORD_COUNT] = {};
+    std::memcpy(_buffer, &_item, sizeof(T));
+
+    const std::uint64_t _writing = 2 * _ticket + 1;
+    std::uint64_t _sequence = _slot._sequence.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        if (_sequence > _writing)
+        {
+            // 이 생산자가 멈춘 사이 더 새로운 항목이 슬롯을 차지함: 이 항목은 이미 덮어쓰인 것으로 본다
+            return _ticket;
+        }
+
+        if ((_sequence & 1) != 0)
+        {
+            // 한 바퀴 앞선 생산자가 아직 쓰는 중
+            std::this_thread::yield();
+            _sequence = _slot._sequence.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        // acquire: 앞선 생산자의 값 쓰기가 이번 쓰기보다 앞서게 한다
+        if (_slot._sequence.compare_exchange_weak(_sequence, _writing, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+
+    // 홀수 sequence가 값 쓰기보다 먼저 보이게 한다
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i = 0; i < WORD_COUNT; ++i)
+    {
+        _slot._words[i].store(_buffer[i], std::memory_order_relaxed);
+    }
+
+    _slot._sequence.store(_writing + 1, std::memory_order_release);
+    return _ticket;
+}
+
+template <typename T, size_t Size>
+bool OverwriteRing<T, Size>::TryRead(const Slot& _slot, std::uint64_t _ticket, T& _item) const noexcept
+{
+    const std::uint64_t _expected = 2 * _ticket + 2;
+    if (_slot._sequence.load(std::memory_order_acquire) != _expected)
+    {
+        return false;
+    }
+
+    std::uint64_t _buffer[WORD_COUNT];
+    for (size_t i = 0; i < WORD_COUNT; ++i)
+    {
+        _buffer[i] = _slot._words[i].load(std::memory_order_relaxed);
+    }
+
+    // 값 읽기가 두 번째 sequence 읽기보다 먼저 끝나게 한다
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (_slot._sequence.load(std::memory_order_relaxed) != _expected)
+    {
+        return false; // 읽는 도중 덮어쓰임
+    }
+
+    std::memcpy(&_item, _buffer, sizeof(T));
+    return true;
+}
+
+template <typename T, size_t Size>
+bool OverwriteRing<T, Size>::Pop(T& _item) noexcept
+{
+    std::uint64_t _sequence = 0;
+    return Pop(_item, _sequence);
+}
+
+template <typename T, size_t Size>
+bool OverwriteRing<T, Size>::Pop(T& _item, std::uint64_t& _sequence) noexcept
+{
+    std::uint64_t _head = m_head.load(std::memory_order_relaxed);
+    std::uint64_t _lost = 0;
+    bool _popped = false;
+
+    while (true)
+    {
+        const std::uint64_t _tail = m_tail.load(std::memory_order_acquire);
+        if (_head >= _tail)
+        {
+            break; // Empty
+        }
+
+        // 한 바퀴 이상 뒤처졌으면 남아 있을 수 있는 가장 오래된 항목으로 건너뛴다
+        if (_tail - _head > Size)
+        {
+            _lost += _tail - Size - _head;
+            _head = _tail - Size;
+        }
+
+        const Slot& _slot = m_buffer[_head & (Size - 1)];
+        const std::uint64_t _slot_sequence = _slot._sequence.load(std::memory_order_acquire);
+
+        if (_slot_sequence <= 2 * _head + 1)
+        {
+            break; // 이 항목의 Push가 아직 끝나지 않음
+        }
+
+        if (true == TryRead(_slot, _head, _item))
+        {
+            _sequence = _head;
+            ++_head;
+            _popped = true;
+            break;
+        }
+
+        // 다음 바퀴의 항목이 덮어씀
+        ++_lost;
+        ++_head;
+    }
+
+    if (_lost != 0)
+    {
+        m_lost_count.store(m_lost_count.load(std::memory_order_relaxed) + _lost, std::memory_order_relaxed);
+    }
+
+    m_head.store(_head, std::memory_order_release);
+    return _popped;
+}
+
+template <typename T, size_t Size>
+size_t OverwriteRing<T, Size>::Snapshot(T* _items, size_t _max_count) const noexcept
+{
+    const std::uint64_t _tail = m_tail.load(std::memory_order_acquire);
+
+    std::uint64_t _count = _max_count < Size ? _max_count : Size;
+    if (_count > _tail)
+    {
+        _count = _tail;
+    }
+
+    size_t _copied = 0;
+    for (std::uint64_t _ticket = _tail - _count; _ticket < _tail; ++_ticket)
+    {
+        if (true == TryRead(m_buffer[_ticket & (Size - 1)], _ticket, _items[_copied]))
+        {
+            ++_copied;
+        }
+    }
+
+    return _copied;
+}
+
+template <typename T, size_t Size>
+bool OverwriteRing<T, Size>::IsEmpty() const
+{
+    return GetSize() == 0;
+}
+
+// 소비자가 아직 읽지 않은 항목 수 (덮어쓰여 사라질 항목은 빼고 최대 Size)
+template <typename T, size_t Size>
+size_t OverwriteRing<T, Size>::GetSize() const
+{
+    const std::uint64_t _head = m_head.load(std::memory_order_acquire);
+    const std::uint64_t _tail = m_tail.load(std::memory_order_acquire);
+
+    if (_tail <= _head)
+    {
+        return 0;
+    }
+
+    return _tail - _head < Size ? static_cast<size_t>(_tail - _head) : Size;
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include "define.h"
+#include "mpmc_queue.h"
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324) // 구조체가 alignas로 패딩됨
+#endif
+
+namespace lfq
+{
+    // 연속된 키가 같은 파티션에 몰리지 않도록 섞은 뒤 파티션 번호로 바꾼다 (Fibonacci hashing)
+    constexpr size_t GetPartitionIndex(std::uint64_t _key, size_t _partition_count)
+    {
+        return static_cast<size_t>((_key * 0x9E3779B97F4A7C15ull) >> 32) % _partition_count;
+    }
+}
+
+// 키 파티션 큐: 같은 키의 항목은 동시에 처리되지 않고 넣은 순서대로 처리된다.
+// 키를 파티션에 나눠 담고, 처리할 항목이 있는 파티션 번호를 준비 링에 넣는다.
+// 소비자는 고정된 샤드 없이 준비 링에서 파티션을 꺼내 그 파티션을 독점 처리하므로,
+// 뜨거운 키가 한 샤드에 몰려도 한가한 소비자가 다른 파티션을 가져가 코어가 놀지 않는다.
+//
+// 파티션마다 대기 항목 수를 두고, 0 → 1로 만든 생산자만 파티션을 준비 링에 넣는다.
+// 대기 항목 수가 0이 아닌 동안 파티션은 준비 링에 한 번 들어 있거나 소비자 하나가 소유하며,
+// 소유자가 처리한 만큼 줄인 뒤에도 남은 항목이 있으면 파티션을 다시 준비 링에 넣는다.
+// 따라서 준비 링의 깊이는 파티션 수를 넘지 않는다.
+//
+// - Push: 여러 스레드에서 호출 가능. 파티션이 가득 차면 false를 반환한다.
+// - Consume: 여러 스레드에서 호출 가능. 파티션 하나를 소유해 최대 _max_count개를 처리하고 반납한다.
+//   handler는 예외를 던지면 안 된다 (파티션이 소유된 채로 남는다).
+//
+// 파티션 수만큼 큐를 가지므로 객체가 크다. std::make_unique로 생성한다.
+template <typename T, size_t PartitionCount, size_t PartitionSize>
+class PartitionedQueue
+{
+public:
+    PartitionedQueue() : m_ready(std::make_unique<ReadyRing>()) {}
+    ~PartitionedQueue() = default;
+
+    PartitionedQueue(PartitionedQueue&&) = delete;
+    PartitionedQueue(const PartitionedQueue&) = delete;
+    PartitionedQueue& operator=(PartitionedQueue&&) = delete;
+    PartitionedQueue& operator=(const PartitionedQueue&) = delete;
+
+    // 여러 스레드에서 안전 호출 가능
+    // 키의 파티션이 가득 차면 false를 반환한다.
+    bool Push(std::uint64_t _key, const T& _item) noexcept { return PushToPartition(lfq::GetPartitionIndex(_key, PartitionCount), _item); }
+    bool Push(std::uint64_t _key, T&& _item) noexcept { return PushToPartition(lfq::GetPartitionIndex(_key, PartitionCount), std::move(_item)); }
+
+    // 여러 스레드에서 안전 호출 가능
+    // 처리할 항목이 있는 파티션 하나를 소유해 항목을 넣은 순서대로 최대 _max_count개 _handler(T&)로 처리한다.
+    // 처리한 항목 수를 반환하며, 처리할 파티션이 없으면 0이다.
+    template <typename Handler>
+    size_t Consume(Handler&& _handler, size_t _max_count);
+
+    bool IsEmpty() const { return m_ready->IsEmpty(); }
+
+    // 준비 링에 있거나 소유된 파티션 수 (근사값)
+    size_t GetReadyPartitionCount() const { return m_ready->GetSize(); }
+    size_t GetPendingCount(size_t _partition_index) const { return m_partitions[_partition_index]._pending_count.load(std::memory_order_relaxed); }
+    constexpr size_t GetPartitionCount() const { return PartitionCount; }
+
+private:
+    static_assert(PartitionCount >= 1 && PartitionCount <= 0xffffffffu, "파티션 번호는 32비트로 표현할 수 있어야 함");
+
+    // 모든 파티션이 동시에 준비되어도 넣을 수 있는 준비 링
+    static constexpr size_t READY_SIZE = lfq::GetNextPowerOfTwo(PartitionCount < 2 ? 2 : PartitionCount);
+    using ReadyRing = MPMCQueue<std::uint32_t, READY_SIZE>;
+
+    struct Partition
+    {
+        MPMCQueue<T, PartitionSize> _items;
+
+        // 넣기가 끝난 뒤 늘고, 소유자가 처리한 뒤 줄어드는 대기 항목 수
+        alignas(lfq::CACHE_LINE_SIZE) std::atomic<size_t> _pending_count{0};
+    };
+
+    template <typename Item>
+    bool PushToPartition(size_t _partition_index, Item&& _item) noexcept;
+
+    void Schedule(size_t _partition_index) noexcept;
+
+    Partition m_partitions[PartitionCount];
+    std::unique_ptr<ReadyRing> m_ready;
+};
+
+// ============================================================
+// 구현
+template <typename T, size_t PartitionCount, size_t PartitionSize>
+template <typename Item>
+bool PartitionedQueue<T, PartitionCount, PartitionSize>::PushToPartition(size_t _partition_index, Item&& _item) noexcept
+{
+    Partition& _partition = m_partitions[_partition_index];
+
+    if (false == _partition._items.Push(std::forward<Item>(_item)))
+    {
+        return false;
+    }
+
+    // 0 → 1을 만든 생산자만 파티션을 넣는다.
+    // acq_rel: 이전 소유자가 처리를 끝내고 수를 줄인 것이 다음 소유자보다 먼저 보인다.
+    if (_partition._pending_count.fetch_add(1, std::memory_order_acq_rel) == 0)
+    {
+        Schedule(_partition_index);
+    }
+
+    return true;
+}
+
+template <typename T, size_t PartitionCount, size_t PartitionSize>
+void PartitionedQueue<T, PartitionCount, PartitionSize>::Schedule(size_t _partition_index) noexcept
+{
+    // 링은 모든 파티션을 담을 수 있으므로 실패하지 않지만, Pop이 슬롯을 비우는 중이면 재시도한다
+    while (false == m_ready->Push(static_cast<std::uint32_t>(_partition_index)))
+    {
+        std::this_thread::yield();
+    }
+}
+
+template <typename T, size_t PartitionCount, size_t PartitionSize>
+template <typename Handler>
+size_t PartitionedQueue<T, PartitionCount, PartitionSize>::Consume(Handler&& _handler, size_t _max_count)
+{
+    std::uint32_t _partition_index = 0;
+    if (false == m_ready->Pop(_partition_index))
+    {
+        return 0;
+    }
+
+    // 이제 이 스레드만 파티션을 처리한다
+    Partition& _partition = m_partitions[_partition_index];
+    const size_t _pending_count = _partition._pending_count.load(std::memory_order_acquire);
+    const size_t _target_count = _pending_count < _max_count ? _pending_count : _max_count;
+
+    size_t _processed_count = 0;
+    T _item;
+
+    // 대기 항목 수는 Push가 끝난 항목만 세지만 슬롯 순서와 같지는 않다. 뒤 슬롯의 생산자가 먼저 세었고
+    // 앞 슬롯의 생산자가 아직 채우는 중이면 MPMCQueue::Pop은 실패하지 않고 그 슬롯이 공개될 때까지 돈다.
+    // 따라서 선점된 생산자가 있으면 이 소비자는 그동안 바쁜 대기를 한다. Pop이 false를 반환하는 것은 큐가 빈 경우뿐이다.
+    while (_processed_count < _target_count && true == _partition._items.Pop(_item))
+    {
+        _handler(_item);
+        ++_processed_count;
+    }
+
+    // 남은 항목이 있으면 소유권을 준비 링으로 넘기고, 없으면 다음 Push가 다시 넣는다
+    if (_partition._pending_count.fetch_sub(_processed_count, std::memory_order_acq_rel) != _processed_count)
+    {
+        Schedule(_partition_index);
+    }
+
+    return _processed_count;
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
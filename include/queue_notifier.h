@@ -0,0 +1,199 @@
+#pragma once
+
+#if !defined(__linux__)
+#error "queue_notifier.h는 eventfd를 사용하므로 Linux에서만 사용할 수 있음"
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include "define.h"
+#include "mpmc_queue.h"
+#include "spsc_queue.h"
+
+// epoll 루프에서 큐를 기다리는 소비자를 위한 eventfd 알림기
+// 소비자가 잠들기 직전에 대기를 알린 경우에만 생산자가 eventfd에 쓰므로,
+// 소비자가 깨어 있는 동안의 Push 경로에는 시스템 호출이 없다.
+//
+// 생산자: Push 성공 후 Notify() 호출 (PushAndNotify 사용 가능)
+// 소비자: GetFd()를 epoll에 EPOLLIN으로 등록하고, 깨어날 때마다 DrainQueue()로 큐를 비운다.
+//         DrainQueue는 큐가 빈 것을 확인한 뒤 대기 상태를 다시 알리고 반환한다.
+//
+// 대기 표시(m_waiting)와 큐 상태는 양쪽에서 seq_cst 펜스로 순서를 맞춘다.
+// 생산자: 데이터 공개 -> 펜스 -> m_waiting 확인
+// 소비자: m_waiting 설정 -> 펜스 -> 큐 재확인
+// 따라서 둘 중 적어도 한쪽은 상대의 쓰기를 보게 되어 깨우기를 잃지 않는다.
+class QueueNotifier
+{
+public:
+    QueueNotifier()
+        : m_fd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+    {
+        if (m_fd < 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "eventfd 생성 실패");
+        }
+    }
+
+    ~QueueNotifier()
+    {
+        close(m_fd);
+    }
+
+    QueueNotifier(QueueNotifier&&) = delete;
+    QueueNotifier(const QueueNotifier&) = delete;
+    QueueNotifier& operator=(QueueNotifier&&) = delete;
+    QueueNotifier& operator=(const QueueNotifier&) = delete;
+
+    int GetFd() const noexcept { return m_fd; }
+
+    // 생산자: Push 성공 후 호출
+    void Notify() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // 대기 중인 소비자가 없으면 공유 캐시 라인 읽기만 하고 끝남
+        if (true == m_waiting.load(std::memory_order_relaxed) && true == m_waiting.exchange(false, std::memory_order_acq_rel))
+        {
+            Signal();
+        }
+    }
+
+    // 소비자: 큐가 비었음을 확인하기 직전에 호출
+    void PrepareWait() noexcept
+    {
+        m_waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    // 소비자: PrepareWait 이후 큐에서 항목을 찾은 경우 호출
+    // 그 사이 생산자가 이미 신호를 보냈다면 다음 epoll_wait가 한 번 헛깨어날 뿐이다.
+    void CancelWait() noexcept
+    {
+        m_waiting.store(false, std::memory_order_relaxed);
+    }
+
+    // 소비자: eventfd의 읽기 가능 상태를 해제
+    void Consume() noexcept
+    {
+        // 읽을 값이 없으면 EAGAIN으로 끝나지만 시스템 호출 횟수에는 포함한다.
+        std::uint64_t _value = 0;
+        m_read_count.fetch_add(1, std::memory_order_relaxed);
+        [[maybe_unused]] const ssize_t _result = read(m_fd, &_value, sizeof(_value));
+    }
+
+    // 소비자가 처리 한도에 걸려 큐를 다 비우지 못했을 때 스스로 다시 깨우기 위해 사용
+    void Signal() noexcept
+    {
+        // 카운터 값이 넘칠 일은 없으므로 결과는 확인하지 않는다.
+        const std::uint64_t _value = 1;
+        m_write_count.fetch_add(1, std::memory_order_relaxed);
+        [[maybe_unused]] const ssize_t _result = write(m_fd, &_value, sizeof(_value));
+    }
+
+    // 벤치마크용 시스템 호출 횟수
+    size_t GetWriteCount() const { return m_write_count.load(std::memory_order_relaxed); }
+    size_t GetReadCount() const { return m_read_count.load(std::memory_order_relaxed); }
+
+private:
+    const int m_fd;
+
+    // 생산자들이 매 Push마다 읽으므로 통계 카운터와 다른 캐시 라인에 둔다.
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<bool> m_waiting{false};
+
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<size_t> m_write_count{0};
+    std::atomic<size_t> m_read_count{0};
+};
+
+namespace lfq
+{
+    // 큐 종류별 항목 타입과 Push/Pop 호출 방식을 맞추기 위한 어댑터
+    template <typename QueueType>
+    struct NotifierQueueTraits;
+
+    template <typename T, size_t Size, bool PackedSlot>
+    struct NotifierQueueTraits<MPMCQueue<T, Size, PackedSlot>>
+    {
+        using ItemType = T;
+
+        static bool Push(MPMCQueue<T, Size, PackedSlot>& _queue, const T& _item) noexcept { return _queue.Push(_item); }
+        static bool Pop(MPMCQueue<T, Size, PackedSlot>& _queue, T& _item) noexcept { return _queue.Pop(_item); }
+    };
+
+    template <>
+    struct NotifierQueueTraits<SPSC_Q>
+    {
+        using ItemType = std::int64_t;
+
+        static bool Push(SPSC_Q& _queue, std::int64_t _item) noexcept { return _queue.push(_item); }
+
+        static bool Pop(SPSC_Q& _queue, std::int64_t& _item) noexcept
+        {
+            const auto _value = _queue.pop();
+            if (false == _value.has_value())
+            {
+                return false;
+            }
+
+            _item = *_value;
+            return true;
+        }
+    };
+}
+
+// Push에 성공하면 대기 중인 소비자를 깨운다.
+template <typename QueueType>
+bool PushAndNotify(QueueType& _queue, QueueNotifier& _notifier, const typename lfq::NotifierQueueTraits<QueueType>::ItemType& _item) noexcept
+{
+    if (false == lfq::NotifierQueueTraits<QueueType>::Push(_queue, _item))
+    {
+        return false;
+    }
+
+    _notifier.Notify();
+    return true;
+}
+
+// 소비자: 큐의 항목을 _handler로 처리하고, 큐가 빈 것을 확인하면 대기 상태를 알린 뒤 반환한다.
+// 반환 후 epoll_wait로 잠들어도 이후의 Push는 반드시 fd를 읽기 가능 상태로 만든다.
+// _max_count개를 처리하고도 항목이 남아 있으면 fd에 직접 신호를 남겨 다음 epoll_wait가 곧바로 반환되게 한다.
+template <typename QueueType, typename Handler>
+size_t DrainQueue(QueueType& _queue, QueueNotifier& _notifier, Handler&& _handler, size_t _max_count = std::numeric_limits<size_t>::max())
+{
+    using Traits = lfq::NotifierQueueTraits<QueueType>;
+    typename Traits::ItemType _item{};
+    size_t _count = 0;
+
+    _notifier.CancelWait();
+    _notifier.Consume();
+
+    while (_count < _max_count)
+    {
+        if (true == Traits::Pop(_queue, _item))
+        {
+            _handler(_item);
+            ++_count;
+            continue;
+        }
+
+        // 비어 있음을 확인했으니 대기를 알리고, 그 사이 들어온 항목이 없는지 다시 확인
+        _notifier.PrepareWait();
+
+        if (false == Traits::Pop(_queue, _item))
+        {
+            return _count;
+        }
+
+        _notifier.CancelWait();
+        _handler(_item);
+        ++_count;
+    }
+
+    _notifier.Signal();
+    return _count;
+}
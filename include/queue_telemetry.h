@@ -0,0 +1,353 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+// 선택적으로 켜는 큐 깊이 텔레메트리
+// 이름을 붙여 등록한 큐를 샘플러 스레드가 정해진 주기로 읽어 통계를 쌓고,
+// Prometheus 텍스트 형식의 스냅샷을 파일이나 콜백으로 내보낸다.
+//
+// 큐의 Push/Pop 경로에는 아무것도 추가하지 않는다. 샘플러는 GetApproximateSize()로
+// head/tail을 relaxed로 읽기만 하며, 텔레메트리 상태는 모두 이 객체 안에 있다.
+// 따라서 최고 수위와 가득 참/비어 있음 이벤트는 샘플 시점 기준이며, 샘플 사이의 짧은 변화는 놓칠 수 있다.
+//
+// 등록한 큐는 Unregister하거나 이 객체가 소멸할 때까지 유지되어야 한다.
+class QueueTelemetry
+{
+public:
+    using QueueId = size_t;
+    using ExportCallback = std::function<void(const std::string&)>;
+
+    // 점유율(깊이/용량) 히스토그램의 버킷 상한. 마지막 버킷은 가득 찬 상태다.
+    static constexpr size_t HISTOGRAM_BUCKET_COUNT = 8;
+    static constexpr std::array<double, HISTOGRAM_BUCKET_COUNT> HISTOGRAM_BOUNDS = {0.0, 0.0625, 0.125, 0.25, 0.5, 0.75, 0.9, 1.0};
+
+    // 큐 하나의 누적 통계
+    struct QueueSnapshot
+    {
+        std::string _name;
+        size_t _capacity = 0;
+        size_t _depth = 0;           // 마지막 샘플의 깊이
+        size_t _high_water_mark = 0; // 샘플 중 최대 깊이
+        std::uint64_t _sample_count = 0;
+        std::uint64_t _empty_sample_count = 0;
+        std::uint64_t _full_sample_count = 0;
+        std::uint64_t _empty_event_count = 0; // 비어 있지 않다가 비게 된 횟수
+        std::uint64_t _full_event_count = 0;  // 가득 차지 않았다가 가득 찬 횟수
+        double _empty_event_rate = 0.0;       // 초당 이벤트 수 (첫 샘플부터 마지막 샘플까지)
+        double _full_event_rate = 0.0;
+        double _occupancy_sum = 0.0;
+        std::array<std::uint64_t, HISTOGRAM_BUCKET_COUNT> _bucket_counts{}; // 누적이 아닌 버킷별 개수
+    };
+
+    QueueTelemetry() = default;
+    ~QueueTelemetry() { Stop(); }
+
+    QueueTelemetry(QueueTelemetry&&) = delete;
+    QueueTelemetry(const QueueTelemetry&) = delete;
+    QueueTelemetry& operator=(QueueTelemetry&&) = delete;
+    QueueTelemetry& operator=(const QueueTelemetry&) = delete;
+
+    // QueueType은 GetApproximateSize()와 GetCapacity()를 제공해야 한다.
+    template <typename QueueType>
+    QueueId Register(std::string _name, const QueueType& _queue)
+    {
+        auto _entry = std::make_unique<Entry>();
+        _entry->_snapshot._name = std::move(_name);
+        _entry->_snapshot._capacity = _queue.GetCapacity();
+        _entry->_queue = &_queue;
+        _entry->_sample = [](const void* _target) { return static_cast<const QueueType*>(_target)->GetApproximateSize(); };
+
+        std::lock_guard<std::mutex> _lock(m_mutex);
+        m_entries.push_back(std::move(_entry));
+        return m_entries.size() - 1;
+    }
+
+    void Unregister(QueueId _id)
+    {
+        std::lock_guard<std::mutex> _lock(m_mutex);
+
+        if (_id < m_entries.size())
+        {
+            m_entries[_id].reset();
+        }
+    }
+
+    // 등록된 모든 큐를 한 번 샘플링한다. 샘플러 스레드가 주기적으로 호출하며 직접 호출해도 된다.
+    void SampleOnce()
+    {
+        const auto _now = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> _lock(m_mutex);
+
+        for (const auto& _entry : m_entries)
+        {
+            if (nullptr != _entry)
+            {
+                Record(*_entry, std::min(_entry->_sample(_entry->_queue), _entry->_snapshot._capacity), _now);
+            }
+        }
+    }
+
+    std::vector<QueueSnapshot> GetSnapshot() const
+    {
+        std::vector<QueueSnapshot> _snapshots;
+        std::lock_guard<std::mutex> _lock(m_mutex);
+
+        for (const auto& _entry : m_entries)
+        {
+            if (nullptr != _entry)
+            {
+                _snapshots.push_back(_entry->_snapshot);
+            }
+        }
+
+        return _snapshots;
+    }
+
+    // Prometheus 텍스트 노출 형식으로 현재 스냅샷을 만든다.
+    std::string ExportText() const
+    {
+        const std::vector<QueueSnapshot> _snapshots = GetSnapshot();
+        std::ostringstream _out;
+
+        const auto _write_metric = [&](const char* _metric, const char* _type, const char* _help, const auto& _value_of)
+        {
+            _out << "# HELP " << _metric << ' ' << _help << '\n'
+                 << "# TYPE " << _metric << ' ' << _type << '\n';
+
+            for (const auto& _snapshot : _snapshots)
+            {
+                _out << _metric << "{queue=\"" << EscapeLabel(_snapshot._name) << "\"} " << _value_of(_snapshot) << '\n';
+            }
+        };
+
+        _write_metric("lfq_queue_capacity", "gauge", "Queue capacity in elements.",
+            [](const QueueSnapshot& _snapshot) { return _snapshot._capacity; });
+        _write_metric("lfq_queue_depth", "gauge", "Queue depth at the last sample.",
+            [](const QueueSnapshot& _snapshot) { return _snapshot._depth; });
+        _write_metric("lfq_queue_depth_high_water", "gauge", "Highest sampled queue depth.",
+            [](const QueueSnapshot& _snapshot) { return _snapshot._high_water_mark; });
+        _write_metric("lfq_queue_samples_total", "counter", "Number of samples taken.",
+            [](const QueueSnapshot& _snapshot) { return _snapshot._sample_count; });
+        _write_metric("lfq_queue_empty_samples_total", "counter", "Samples that found the queue empty.",
+            [](const QueueSnapshot& _snapshot) { return _snapshot._empty_sample_count; });
+        _write_metric("lfq_queue_full_samples_total", "counter", "Samples that found the queue full.",
+            [](const QueueSnapshot& _snapshot) { return _snapshot._full_sample_count; });
+        _write_metric("lfq_queue_empty_events_total", "counter", "Sampled transitions into the empty state.",
+            [](const QueueSnapshot& _snapshot) { return _snapshot._empty_event_count; });
+        _write_metric("lfq_queue_full_events_total", "counter", "Sampled transitions into the full state.",
+            [](const QueueSnapshot& _snapshot) { return _snapshot._full_event_count; });
+        _write_metric("lfq_queue_empty_events_per_second", "gauge", "Empty transitions per second over the sampled period.",
+            [](const QueueSnapshot& _snapshot) { return _snapshot._empty_event_rate; });
+        _write_metric("lfq_queue_full_events_per_second", "gauge", "Full transitions per second over the sampled period.",
+            [](const QueueSnapshot& _snapshot) { return _snapshot._full_event_rate; });
+
+        _out << "# HELP lfq_queue_occupancy Sampled queue occupancy (depth / capacity).\n"
+             << "# TYPE lfq_queue_occupancy histogram\n";
+
+        for (const auto& _snapshot : _snapshots)
+        {
+            const std::string _label = EscapeLabel(_snapshot._name);
+            std::uint64_t _cumulative_count = 0;
+
+            for (size_t i = 0; i < HISTOGRAM_BUCKET_COUNT; ++i)
+            {
+                _cumulative_count += _snapshot._bucket_counts[i];
+                _out << "lfq_queue_occupancy_bucket{queue=\"" << _label << "\",le=\"" << HISTOGRAM_BOUNDS[i] << "\"} " << _cumulative_count << '\n';
+            }
+
+            _out << "lfq_queue_occupancy_bucket{queue=\"" << _label << "\",le=\"+Inf\"} " << _snapshot._sample_count << '\n'
+                 << "lfq_queue_occupancy_sum{queue=\"" << _label << "\"} " << _snapshot._occupancy_sum << '\n'
+                 << "lfq_queue_occupancy_count{queue=\"" << _label << "\"} " << _snapshot._sample_count << '\n';
+        }
+
+        return _out.str();
+    }
+
+    // 임시 파일에 쓴 뒤 이름을 바꿔, 읽는 쪽이 쓰다 만 파일을 보지 않게 한다.
+    bool ExportToFile(const std::string& _path) const
+    {
+        const std::string _temporary_path = _path + ".tmp";
+
+        {
+            std::ofstream _file(_temporary_path, std::ios::binary | std::ios::trunc);
+            if (false == _file.is_open())
+            {
+                return false;
+            }
+
+            _file << ExportText();
+            if (false == _file.good())
+            {
+                return false;
+            }
+        }
+
+        std::error_code _error;
+        std::filesystem::rename(_temporary_path, _path, _error);
+        return false == static_cast<bool>(_error);
+    }
+
+    // Start 전에 설정한다. 내보내기 주기마다 파일과 콜백으로 스냅샷을 전달한다.
+    void SetExportFile(std::string _path) { m_export_path = std::move(_path); }
+    void SetExportCallback(ExportCallback _callback) { m_export_callback = std::move(_callback); }
+
+    // _sample_interval마다 샘플링하고, _export_interval이 0이 아니면 그 주기마다 내보낸다.
+    // Stop에서는 마지막으로 한 번 더 내보낸다.
+    void Start(std::chrono::microseconds _sample_interval, std::chrono::milliseconds _export_interval = std::chrono::milliseconds(0))
+    {
+        if (true == m_running.exchange(true))
+        {
+            return;
+        }
+
+        m_thread = std::thread([this, _sample_interval, _export_interval]()
+        {
+            auto _next_sample_time = std::chrono::steady_clock::now();
+            auto _next_export_time = _next_sample_time + _export_interval;
+            std::unique_lock<std::mutex> _lock(m_wait_mutex);
+
+            while (true == m_running.load(std::memory_order_relaxed))
+            {
+                _lock.unlock();
+                SampleOnce();
+
+                if (_export_interval.count() != 0 && std::chrono::steady_clock::now() >= _next_export_time)
+                {
+                    Export();
+                    _next_export_time += _export_interval;
+                }
+
+                _lock.lock();
+
+                // 밀린 주기는 건너뛰고 다음 주기에 맞춘다
+                _next_sample_time = std::max(_next_sample_time + _sample_interval, std::chrono::steady_clock::now());
+                m_wait_condition.wait_until(_lock, _next_sample_time, [this]() { return false == m_running.load(std::memory_order_relaxed); });
+            }
+        });
+    }
+
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> _lock(m_wait_mutex);
+            if (false == m_running.exchange(false))
+            {
+                return;
+            }
+        }
+
+        m_wait_condition.notify_all();
+        m_thread.join();
+        Export();
+    }
+
+private:
+    struct Entry
+    {
+        const void* _queue = nullptr;
+        size_t (*_sample)(const void*) = nullptr;
+        QueueSnapshot _snapshot;
+        std::chrono::steady_clock::time_point _first_sample_time;
+    };
+
+    static void Record(Entry& _entry, size_t _depth, std::chrono::steady_clock::time_point _now)
+    {
+        QueueSnapshot& _snapshot = _entry._snapshot;
+        const bool _empty = _depth == 0;
+        const bool _full = _depth == _snapshot._capacity;
+
+        if (_snapshot._sample_count == 0)
+        {
+            _entry._first_sample_time = _now;
+        }
+        else
+        {
+            // 이전 샘플과 상태가 달라진 경우만 이벤트로 센다
+            _snapshot._empty_event_count += (true == _empty && _snapshot._depth != 0) ? 1 : 0;
+            _snapshot._full_event_count += (true == _full && _snapshot._depth != _snapshot._capacity) ? 1 : 0;
+        }
+
+        ++_snapshot._sample_count;
+        _snapshot._empty_sample_count += true == _empty ? 1 : 0;
+        _snapshot._full_sample_count += true == _full ? 1 : 0;
+        _snapshot._depth = _depth;
+        _snapshot._high_water_mark = std::max(_snapshot._high_water_mark, _depth);
+
+        const double _occupancy = static_cast<double>(_depth) / static_cast<double>(_snapshot._capacity);
+        _snapshot._occupancy_sum += _occupancy;
+
+        size_t _bucket = 0;
+        while (_occupancy > HISTOGRAM_BOUNDS[_bucket])
+        {
+            ++_bucket;
+        }
+        ++_snapshot._bucket_counts[_bucket];
+
+        const double _elapsed_sec = std::chrono::duration<double>(_now - _entry._first_sample_time).count();
+        if (_elapsed_sec > 0.0)
+        {
+            _snapshot._empty_event_rate = static_cast<double>(_snapshot._empty_event_count) / _elapsed_sec;
+            _snapshot._full_event_rate = static_cast<double>(_snapshot._full_event_count) / _elapsed_sec;
+        }
+    }
+
+    // 레이블 값의 역슬래시, 큰따옴표, 줄바꿈을 이스케이프
+    static std::string EscapeLabel(const std::string& _value)
+    {
+        std::string _escaped;
+        _escaped.reserve(_value.size());
+
+        for (const char _character : _value)
+        {
+            switch (_character)
+            {
+            case '\\': _escaped += "\\\\"; break;
+            case '"': _escaped += "\\\""; break;
+            case '\n': _escaped += "\\n"; break;
+            default: _escaped += _character; break;
+            }
+        }
+
+        return _escaped;
+    }
+
+    void Export() const
+    {
+        if (false == m_export_path.empty())
+        {
+            ExportToFile(m_export_path);
+        }
+
+        if (m_export_callback)
+        {
+            m_export_callback(ExportText());
+        }
+    }
+
+    mutable std::mutex m_mutex; // m_entries와 통계 보호 (샘플러와 조회 사이에서만 경쟁)
+    std::vector<std::unique_ptr<Entry>> m_entries;
+
+    std::string m_export_path;
+    ExportCallback m_export_callback;
+
+    std::atomic<bool> m_running{false};
+    std::mutex m_wait_mutex;
+    std::condition_variable m_wait_condition;
+    std::thread m_thread;
+};
@@ -0,0 +1,313 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "define.h"
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lfq
+{
+    // 큐의 한쪽(Push 또는 Pop)을 호출하는 스레드 수
+    enum class Cardinality
+    {
+        Single, // 한 스레드만 호출
+        Multi   // 여러 스레드가 동시에 호출
+    };
+}
+
+// 생산자/소비자 수를 컴파일 시간에 지정하는 크기 제한 큐
+// 한 스레드만 호출하는 쪽은 인덱스를 CAS 없이 plain store로 갱신하고,
+// 여러 스레드가 호출하는 쪽만 MPMCQueue와 같은 CAS 예약을 사용한다.
+//
+// - SPSC: generation 없이 head/tail과 상대 인덱스 캐시만 사용 (Lamport 링)
+// - MPSC/SPMC/MPMC: 슬롯 generation 프로토콜을 MPMCQueue와 동일하게 사용
+//
+// API는 MPMCQueue와 같다. Single로 지정한 쪽을 여러 스레드에서 호출하면 동작이 정의되지 않는다.
+// Pop은 MPMCQueue처럼 head >= tail일 때만 false를 반환한다.
+template <typename T, size_t Size, lfq::Cardinality Producers, lfq::Cardinality Consumers>
+class RingQueue
+{
+public:
+    RingQueue();
+    ~RingQueue() = default;
+
+    RingQueue(RingQueue&&) = delete;
+    RingQueue(const RingQueue&) = delete;
+    RingQueue& operator=(RingQueue&&) = delete;
+    RingQueue& operator=(const RingQueue&) = delete;
+
+    bool Push(const T& _item) noexcept { return PushImpl(_item); }
+    bool Push(T&& _item) noexcept { return PushImpl(std::move(_item)); }
+    bool Pop(T& _item) noexcept;
+
+    bool IsEmpty() const;
+    size_t GetSize() const;
+    size_t GetApproximateSize() const noexcept;
+    constexpr size_t GetCapacity() const { return Size; }
+
+private:
+    static constexpr bool SINGLE_PRODUCER = Producers == lfq::Cardinality::Single;
+    static constexpr bool SINGLE_CONSUMER = Consumers == lfq::Cardinality::Single;
+
+    // 양쪽 모두 한 스레드면 슬롯 상태를 head/tail만으로 판단할 수 있다
+    static constexpr bool USE_GENERATION = !(SINGLE_PRODUCER && SINGLE_CONSUMER);
+
+    // generation 슬롯 (MPMCQueue와 같은 구조)
+    struct alignas(lfq::CACHE_LINE_SIZE) SequencedSlot
+    {
+        std::atomic<size_t> _generation;
+        T _data;
+    };
+
+    // SPSC 슬롯: 이웃한 원소가 같은 캐시 라인을 공유해 순차 접근이 빠르다
+    struct PlainSlot
+    {
+        T _data;
+    };
+
+    using Slot = std::conditional_t<USE_GENERATION, SequencedSlot, PlainSlot>;
+
+    template <typename U>
+    bool PushImpl(U&& _item) noexcept;
+
+    Slot m_buffer[Size];
+
+    // 생산자 쪽: tail과 SPSC에서 마지막으로 읽은 head
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<size_t> m_tail; // 쓰기 인덱스
+    size_t m_cached_head;
+
+    // 소비자 쪽: head와 SPSC에서 마지막으로 읽은 tail
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<size_t> m_head; // 읽기 인덱스
+    size_t m_cached_tail;
+};
+
+template <typename T, size_t Size>
+using SPSCRingQueue = RingQueue<T, Size, lfq::Cardinality::Single, lfq::Cardinality::Single>;
+
+template <typename T, size_t Size>
+using MPSCRingQueue = RingQueue<T, Size, lfq::Cardinality::Multi, lfq::Cardinality::Single>;
+
+template <typename T, size_t Size>
+using SPMCRingQueue = RingQueue<T, Size, lfq::Cardinality::Single, lfq::Cardinality::Multi>;
+
+template <typename T, size_t Size>
+using MPMCRingQueue = RingQueue<T, Size, lfq::Cardinality::Multi, lfq::Cardinality::Multi>;
+
+// ============================================================
+// 구현
+template <typename T, size_t Size, lfq::Cardinality Producers, lfq::Cardinality Consumers>
+RingQueue<T, Size, Producers, Consumers>::RingQueue() : m_tail(0), m_cached_head(0), m_head(0), m_cached_tail(0)
+{
+    static_assert(Size >= 2, "큐 크기는 2 이상이어야 함");
+    static_assert((Size & (Size - 1)) == 0, "RingQueue - 큐 사이즈가 2의 제곱이어야 함");
+
+    if constexpr (USE_GENERATION)
+    {
+        for (size_t i = 0; i < Size; ++i)
+        {
+            m_buffer[i]._generation.store(i, std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T, size_t Size, lfq::Cardinality Producers, lfq::Cardinality Consumers>
+template <typename U>
+bool RingQueue<T, Size, Producers, Consumers>::PushImpl(U&& _item) noexcept
+{
+    static_assert(std::is_nothrow_assignable_v<T&, U&&>, "T는 예외 없이 대입할 수 있어야 함");
+
+    // tail은 생산자만 갱신하거나(Single) CAS로만 갱신하므로(Multi) relaxed로 읽어도 된다
+    size_t _tail = m_tail.load(std::memory_order_relaxed);
+
+    if constexpr (false == USE_GENERATION)
+    {
+        // 소비자가 반납한 위치는 가득 찬 것처럼 보일 때만 다시 읽는다
+        if (_tail - m_cached_head == Size)
+        {
+            // acquire는 소비자가 반납 전에 끝낸 읽기가 이후의 덮어쓰기보다 앞서게 한다
+            m_cached_head = m_head.load(std::memory_order_acquire);
+
+            if (_tail - m_cached_head == Size)
+            {
+                return false; // 큐가 가득 참
+            }
+        }
+
+        m_buffer[_tail & (Size - 1)]._data = std::forward<U>(_item);
+
+        // 데이터를 소비자에게 공개
+        m_tail.store(_tail + 1, std::memory_order_release);
+        return true;
+    }
+    else
+    {
+        while (true)
+        {
+            SequencedSlot& _slot = m_buffer[_tail & (Size - 1)];
+            const size_t _generation = _slot._generation.load(std::memory_order_acquire);
+
+            if (_generation == _tail)
+            {
+                if constexpr (SINGLE_PRODUCER)
+                {
+                    // 경쟁하는 생산자가 없으므로 예약 없이 바로 쓴다
+                    _slot._data = std::forward<U>(_item);
+                    _slot._generation.store(_tail + 1, std::memory_order_release);
+
+                    // tail은 슬롯 공개 뒤에 올리므로 소비자는 쓰는 중인 슬롯을 기다리지 않는다
+                    m_tail.store(_tail + 1, std::memory_order_release);
+                    return true;
+                }
+                else
+                {
+                    // tail을 증가시켜 이 슬롯을 예약
+                    if (m_tail.compare_exchange_weak(_tail, _tail + 1, std::memory_order_relaxed))
+                    {
+                        _slot._data = std::forward<U>(_item);
+
+                        // generation을 증가시켜 Pop이 읽을 수 있게 함
+                        _slot._generation.store(_tail + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+            }
+            else if (_generation < _tail)
+            {
+                // 이전 바퀴의 값이 아직 소비되지 않음
+                const size_t _head = m_head.load(std::memory_order_acquire);
+
+                if (_tail >= _head + Size)
+                {
+                    return false; // 큐가 가득 참
+                }
+
+                // 다른 소비자가 이 슬롯을 비우는 중이므로 재시도
+                _tail = m_tail.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                // 다른 생산자가 이미 이 위치에 Push 진행 중
+                _tail = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+template <typename T, size_t Size, lfq::Cardinality Producers, lfq::Cardinality Consumers>
+bool RingQueue<T, Size, Producers, Consumers>::Pop(T& _item) noexcept
+{
+    static_assert(std::is_nothrow_move_assignable_v<T>, "T는 예외 없이 이동 대입할 수 있어야 함");
+
+    size_t _head = m_head.load(std::memory_order_relaxed);
+
+    if constexpr (false == USE_GENERATION)
+    {
+        // 생산자가 공개한 위치는 비어 있는 것처럼 보일 때만 다시 읽는다
+        if (_head == m_cached_tail)
+        {
+            m_cached_tail = m_tail.load(std::memory_order_acquire);
+
+            if (_head == m_cached_tail)
+            {
+                return false; // Empty
+            }
+        }
+
+        _item = std::move(m_buffer[_head & (Size - 1)]._data);
+
+        // 이 슬롯을 생산자에게 반납
+        m_head.store(_head + 1, std::memory_order_release);
+        return true;
+    }
+    else
+    {
+        while (true)
+        {
+            SequencedSlot& _slot = m_buffer[_head & (Size - 1)];
+            const size_t _generation = _slot._generation.load(std::memory_order_acquire);
+
+            if (_generation == _head + 1)
+            {
+                if constexpr (SINGLE_CONSUMER)
+                {
+                    // 경쟁하는 소비자가 없으므로 예약 없이 바로 읽는다
+                    _item = std::move(_slot._data);
+                    _slot._generation.store(_head + Size, std::memory_order_release);
+                    m_head.store(_head + 1, std::memory_order_release);
+                    return true;
+                }
+                else
+                {
+                    if (m_head.compare_exchange_weak(_head, _head + 1, std::memory_order_relaxed))
+                    {
+                        _item = std::move(_slot._data);
+
+                        // 다음 바퀴의 Push가 사용할 수 있도록 generation 갱신
+                        _slot._generation.store(_head + Size, std::memory_order_release);
+                        return true;
+                    }
+                }
+            }
+            else if (_generation < _head + 1)
+            {
+                // 큐가 비었거나 Push가 진행 중임
+                const size_t _tail = m_tail.load(std::memory_order_acquire);
+
+                if (_head >= _tail)
+                {
+                    return false; // Empty
+                }
+
+                // 예약된 슬롯에 아직 쓰는 중이므로 재시도
+                _head = m_head.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                _head = m_head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+template <typename T, size_t Size, lfq::Cardinality Producers, lfq::Cardinality Consumers>
+bool RingQueue<T, Size, Producers, Consumers>::IsEmpty() const
+{
+    size_t _head = m_head.load(std::memory_order_acquire);
+    size_t _tail = m_tail.load(std::memory_order_acquire);
+    return _tail <= _head;
+}
+
+template <typename T, size_t Size, lfq::Cardinality Producers, lfq::Cardinality Consumers>
+size_t RingQueue<T, Size, Producers, Consumers>::GetSize() const
+{
+    size_t _head = m_head.load(std::memory_order_acquire);
+    size_t _tail = m_tail.load(std::memory_order_acquire);
+
+    if (_tail >= _head)
+    {
+        return _tail - _head;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+template <typename T, size_t Size, lfq::Cardinality Producers, lfq::Cardinality Consumers>
+size_t RingQueue<T, Size, Producers, Consumers>::GetApproximateSize() const noexcept
+{
+    const size_t _tail = m_tail.load(std::memory_order_relaxed);
+    const size_t _head = m_head.load(std::memory_order_relaxed);
+
+    return lfq::ClampApproximateSize(_head, _tail, Size);
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
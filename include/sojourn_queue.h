@@ -0,0 +1,431 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "define.h"
+#include "thread_registry.h"
+
+#if defined(__linux__)
+#include <time.h>
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324)
+#endif
+
+namespace lfq
+{
+    // 단조 증가 시계 (나노초)
+    struct SteadyClock
+    {
+        static std::uint64_t Now() noexcept
+        {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+    };
+
+    // 해상도를 낮춘 대신 더 싼 시계 (나노초 단위, Linux에서는 커널 tick 해상도)
+    // 목표 체류 시간이 수십 ms 이상일 때 사용한다. Linux 외에서는 SteadyClock과 같다.
+    struct CoarseClock
+    {
+        static std::uint64_t Now() noexcept
+        {
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_COARSE)
+            timespec _time{};
+            clock_gettime(CLOCK_MONOTONIC_COARSE, &_time);
+            return static_cast<std::uint64_t>(_time.tv_sec) * 1'000'000'000ull + static_cast<std::uint64_t>(_time.tv_nsec);
+#else
+            return SteadyClock::Now();
+#endif
+        }
+    };
+
+    // 체류 시간이 목표를 계속 넘을 때의 동작
+    enum class CoDelMode
+    {
+        Off,    // 통계만 수집
+        Signal, // IsOverloaded로 생산자에게 알림
+        Drop    // 알림과 함께 Pop에서 CoDel 제어 법칙에 따라 항목을 버림
+    };
+
+    struct CoDelPolicy
+    {
+        CoDelMode _mode = CoDelMode::Off;
+        std::uint64_t _target_ns = 5'000'000;     // 허용 체류 시간 (5ms)
+        std::uint64_t _interval_ns = 100'000'000; // 최소 체류 시간이 목표를 넘은 채로 유지되어야 하는 시간 (100ms)
+    };
+
+    // 체류 시간 통계를 나눠 담는 줄 수 (2의 제곱). 소비자는 ThreadRegistry 번호로 줄을 골라 자기 줄에만 더한다.
+    constexpr size_t SOJOURN_STATS_STRIPE_COUNT = 16;
+
+    struct SojournStats
+    {
+        std::uint64_t _pop_count = 0;
+        std::uint64_t _total_sojourn_ns = 0;
+        std::uint64_t _max_sojourn_ns = 0;
+        std::uint64_t _dropped_count = 0;
+        bool _overloaded = false;
+    };
+}
+
+// 항목이 큐에 머문 시간(sojourn time)을 재는 MPMC 큐
+// MPMCQueue와 같은 generation 슬롯에 넣은 시각을 함께 저장하고, generation을 공개할 때 같이 공개한다.
+// Pop은 항목마다 체류 시간을 계산해 통계에 더하고, 선택적으로 CoDel 방식의 과부하 판단을 한다.
+// 통계는 캐시 라인 단위의 줄로 나눠 소비자마다 다른 줄에 더하고 GetStats가 합친다 (소비자끼리 같은 라인을 두고 다투지 않음).
+//
+// CoDel: 꺼낸 항목의 체류 시간이 interval 동안 계속 target 이상이면(= 그 구간의 최소 체류 시간이 target 초과)
+// 과부하 상태가 된다. 체류 시간이 target 아래로 내려가면 바로 풀린다.
+// Drop 모드에서는 과부하 동안 interval / sqrt(n) 간격으로 꺼낸 항목을 버리고 다음 항목을 반환한다.
+// 버린 항목은 소멸만 되므로 소유권을 가진 포인터를 담는 큐에는 Signal 모드를 사용한다.
+//
+// Clock은 static std::uint64_t Now() noexcept로 나노초를 반환하는 타입이다.
+template <typename T, size_t Size, typename Clock = lfq::SteadyClock>
+class SojournQueue
+{
+public:
+    SojournQueue();
+    ~SojournQueue() = default;
+
+    SojournQueue(SojournQueue&&) = delete;
+    SojournQueue(const SojournQueue&) = delete;
+    SojournQueue& operator=(SojournQueue&&) = delete;
+    SojournQueue& operator=(const SojournQueue&) = delete;
+
+    // 큐를 사용하기 전에 호출
+    void SetCoDelPolicy(const lfq::CoDelPolicy& _policy) noexcept { m_policy = _policy; }
+
+    // 여러 스레드에서 안전 호출 가능
+    bool Push(const T& _item) noexcept { return PushImpl(_item); }
+    bool Push(T&& _item) noexcept { return PushImpl(std::move(_item)); }
+    bool Pop(T& _item) noexcept;
+    bool Pop(T& _item, std::uint64_t& _sojourn_ns) noexcept;
+
+    // 생산자가 부하를 줄일지 판단할 때 사용 (CoDel 모드가 Off면 항상 false)
+    bool IsOverloaded() const noexcept { return m_overloaded.load(std::memory_order_relaxed); }
+    lfq::SojournStats GetStats() const noexcept;
+
+    bool IsEmpty() const;
+    size_t GetSize() const;
+    size_t GetApproximateSize() const noexcept;
+    constexpr size_t GetCapacity() const { return Size; }
+
+private:
+    struct alignas(lfq::CACHE_LINE_SIZE) Slot
+    {
+        std::atomic<size_t> _generation;
+        std::uint64_t _enqueue_time; // generation과 함께 공개
+        T _data;
+    };
+
+    template <typename U>
+    bool PushImpl(U&& _item) noexcept;
+
+    bool TryPop(T& _item, std::uint64_t& _enqueue_time) noexcept;
+
+    // 체류 시간을 통계에 더하고 CoDel 상태를 갱신한다. 이 항목을 버려야 하면 true
+    bool RecordSojourn(std::uint64_t _sojourn_ns, std::uint64_t _now) noexcept;
+
+    Slot m_buffer[Size];
+
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<size_t> m_head; // 읽기 인덱스
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<size_t> m_tail; // 쓰기 인덱스
+
+    static_assert((lfq::SOJOURN_STATS_STRIPE_COUNT & (lfq::SOJOURN_STATS_STRIPE_COUNT - 1)) == 0, "통계 줄 수는 2의 제곱이어야 함");
+
+    // 소비자 하나(번호가 겹치면 몇 개)가 갱신하는 통계 줄
+    struct alignas(lfq::CACHE_LINE_SIZE) StatsStripe
+    {
+        std::atomic<std::uint64_t> _pop_count{0};
+        std::atomic<std::uint64_t> _total_sojourn_ns{0};
+        std::atomic<std::uint64_t> _max_sojourn_ns{0};
+        std::atomic<std::uint64_t> _dropped_count{0};
+    };
+
+    // 번호가 없는 스레드(INVALID_THREAD_INDEX)는 마지막 줄을 함께 쓴다
+    StatsStripe& GetStatsStripe() noexcept
+    {
+        return m_stats[ThreadRegistry::GetThreadIndex() & (lfq::SOJOURN_STATS_STRIPE_COUNT - 1)];
+    }
+
+    StatsStripe m_stats[lfq::SOJOURN_STATS_STRIPE_COUNT];
+
+    // 소비자가 갱신하는 CoDel 상태
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<std::uint64_t> m_first_above_time; // 0이면 체류 시간이 target 아래
+    std::atomic<std::uint64_t> m_drop_next;        // 다음에 버릴 수 있는 시각
+    std::atomic<std::uint32_t> m_drop_sequence;    // 이번 과부하 구간에서 버린 횟수
+    std::atomic<bool> m_overloaded;
+
+    lfq::CoDelPolicy m_policy;
+};
+
+// ============================================================
+// 구현
+template <typename T, size_t Size, typename Clock>
+SojournQueue<T, Size, Clock>::SojournQueue()
+    : m_head(0), m_tail(0), m_first_above_time(0), m_drop_next(0), m_drop_sequence(0), m_overloaded(false)
+{
+    static_assert(Size >= 2, "큐 크기는 2 이상이어야 함");
+    static_assert((Size & (Size - 1)) == 0, "SojournQueue - 큐 사이즈가 2의 제곱이어야 함");
+
+    for (size_t i = 0; i < Size; ++i)
+    {
+        m_buffer[i]._generation.store(i, std::memory_order_relaxed);
+        m_buffer[i]._enqueue_time = 0;
+    }
+}
+
+template <typename T, size_t Size, typename Clock>
+template <typename U>
+bool SojournQueue<T, Size, Clock>::PushImpl(U&& _item) noexcept
+{
+    static_assert(std::is_nothrow_assignable_v<T&, U&&>, "T는 예외 없이 대입할 수 있어야 함");
+
+    size_t _tail = m_tail.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Slot& _slot = m_buffer[_tail & (Size - 1)];
+        const size_t _generation = _slot._generation.load(std::memory_order_acquire);
+
+        if (_generation == _tail)
+        {
+            if (m_tail.compare_exchange_weak(_tail, _tail + 1, std::memory_order_relaxed))
+            {
+                _slot._data = std::forward<U>(_item);
+                _slot._enqueue_time = Clock::Now();
+
+                // 데이터와 넣은 시각을 함께 공개
+                _slot._generation.store(_tail + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (_generation < _tail)
+        {
+            const size_t _head = m_head.load(std::memory_order_acquire);
+
+            if (_tail >= _head + Size)
+            {
+                return false; // 큐가 가득 참
+            }
+
+            _tail = m_tail.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            _tail = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T, size_t Size, typename Clock>
+bool SojournQueue<T, Size, Clock>::TryPop(T& _item, std::uint64_t& _enqueue_time) noexcept
+{
+    static_assert(std::is_nothrow_move_assignable_v<T>, "T는 예외 없이 이동 대입할 수 있어야 함");
+
+    size_t _head = m_head.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Slot& _slot = m_buffer[_head & (Size - 1)];
+        const size_t _generation = _slot._generation.load(std::memory_order_acquire);
+
+        if (_generation == _head + 1)
+        {
+            if (m_head.compare_exchange_weak(_head, _head + 1, std::memory_order_relaxed))
+            {
+                _item = std::move(_slot._data);
+                _enqueue_time = _slot._enqueue_time;
+
+                _slot._generation.store(_head + Size, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (_generation < _head + 1)
+        {
+            const size_t _tail = m_tail.load(std::memory_order_acquire);
+
+            if (_head >= _tail)
+            {
+                return false; // Empty
+            }
+
+            _head = m_head.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            _head = m_head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T, size_t Size, typename Clock>
+bool SojournQueue<T, Size, Clock>::Pop(T& _item) noexcept
+{
+    std::uint64_t _sojourn_ns = 0;
+    return Pop(_item, _sojourn_ns);
+}
+
+template <typename T, size_t Size, typename Clock>
+bool SojournQueue<T, Size, Clock>::Pop(T& _item, std::uint64_t& _sojourn_ns) noexcept
+{
+    std::uint64_t _enqueue_time = 0;
+
+    while (true == TryPop(_item, _enqueue_time))
+    {
+        const std::uint64_t _now = Clock::Now();
+
+        // 다른 생산자가 먼저 시각을 읽고 늦게 공개했거나 시계 해상도가 낮으면 0으로 본다
+        _sojourn_ns = _now > _enqueue_time ? _now - _enqueue_time : 0;
+
+        if (false == RecordSojourn(_sojourn_ns, _now))
+        {
+            return true;
+        }
+
+        GetStatsStripe()._dropped_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return false;
+}
+
+template <typename T, size_t Size, typename Clock>
+bool SojournQueue<T, Size, Clock>::RecordSojourn(std::uint64_t _sojourn_ns, std::uint64_t _now) noexcept
+{
+    // 줄은 보통 이 스레드만 쓰므로 원자 연산이 있어도 캐시 라인이 다른 코어로 오가지 않는다
+    StatsStripe& _stripe = GetStatsStripe();
+    _stripe._pop_count.fetch_add(1, std::memory_order_relaxed);
+    _stripe._total_sojourn_ns.fetch_add(_sojourn_ns, std::memory_order_relaxed);
+
+    std::uint64_t _max = _stripe._max_sojourn_ns.load(std::memory_order_relaxed);
+    while (_sojourn_ns > _max && false == _stripe._max_sojourn_ns.compare_exchange_weak(_max, _sojourn_ns, std::memory_order_relaxed))
+    {
+    }
+
+    if (m_policy._mode == lfq::CoDelMode::Off)
+    {
+        return false;
+    }
+
+    // CoDel 상태는 판단용 근사값이므로 소비자끼리 relaxed로 갱신한다
+    if (_sojourn_ns < m_policy._target_ns)
+    {
+        // 이미 0이면 쓰지 않아야 평상시 Pop이 공유 라인을 더럽히지 않는다
+        if (m_first_above_time.load(std::memory_order_relaxed) != 0)
+        {
+            m_first_above_time.store(0, std::memory_order_relaxed);
+        }
+
+        if (true == m_overloaded.load(std::memory_order_relaxed))
+        {
+            m_overloaded.store(false, std::memory_order_relaxed);
+        }
+
+        return false;
+    }
+
+    std::uint64_t _first_above_time = m_first_above_time.load(std::memory_order_relaxed);
+    if (_first_above_time == 0)
+    {
+        // target을 처음 넘음: interval 뒤에도 넘어 있으면 과부하
+        m_first_above_time.compare_exchange_strong(_first_above_time, _now + m_policy._interval_ns, std::memory_order_relaxed);
+        return false;
+    }
+
+    if (_now < _first_above_time)
+    {
+        return false;
+    }
+
+    if (false == m_overloaded.exchange(true, std::memory_order_relaxed))
+    {
+        // 과부하에 들어가면 바로 하나를 버린다
+        m_drop_sequence.store(0, std::memory_order_relaxed);
+        m_drop_next.store(_now, std::memory_order_relaxed);
+    }
+
+    if (m_policy._mode != lfq::CoDelMode::Drop)
+    {
+        return false;
+    }
+
+    std::uint64_t _drop_next = m_drop_next.load(std::memory_order_relaxed);
+    if (_now < _drop_next)
+    {
+        return false;
+    }
+
+    // 제어 법칙: 버릴수록 간격을 interval / sqrt(n)으로 줄여 체류 시간을 target으로 끌어내린다
+    const std::uint32_t _drop_sequence = m_drop_sequence.load(std::memory_order_relaxed) + 1;
+    const auto _spacing = static_cast<std::uint64_t>(static_cast<double>(m_policy._interval_ns) / std::sqrt(static_cast<double>(_drop_sequence)));
+
+    if (false == m_drop_next.compare_exchange_strong(_drop_next, _now + _spacing, std::memory_order_relaxed))
+    {
+        return false; // 다른 소비자가 이번 차례에 버림
+    }
+
+    m_drop_sequence.store(_drop_sequence, std::memory_order_relaxed);
+    return true;
+}
+
+template <typename T, size_t Size, typename Clock>
+lfq::SojournStats SojournQueue<T, Size, Clock>::GetStats() const noexcept
+{
+    // 줄마다 따로 읽으므로 소비자가 동작 중이면 합계는 근사값이다
+    lfq::SojournStats _stats;
+    for (const StatsStripe& _stripe : m_stats)
+    {
+        _stats._pop_count += _stripe._pop_count.load(std::memory_order_relaxed);
+        _stats._total_sojourn_ns += _stripe._total_sojourn_ns.load(std::memory_order_relaxed);
+        _stats._dropped_count += _stripe._dropped_count.load(std::memory_order_relaxed);
+
+        const std::uint64_t _max = _stripe._max_sojourn_ns.load(std::memory_order_relaxed);
+        _stats._max_sojourn_ns = _max > _stats._max_sojourn_ns ? _max : _stats._max_sojourn_ns;
+    }
+
+    _stats._overloaded = m_overloaded.load(std::memory_order_relaxed);
+    return _stats;
+}
+
+template <typename T, size_t Size, typename Clock>
+bool SojournQueue<T, Size, Clock>::IsEmpty() const
+{
+    size_t _head = m_head.load(std::memory_order_acquire);
+    size_t _tail = m_tail.load(std::memory_order_acquire);
+    return _tail <= _head;
+}
+
+template <typename T, size_t Size, typename Clock>
+size_t SojournQueue<T, Size, Clock>::GetSize() const
+{
+    size_t _head = m_head.load(std::memory_order_acquire);
+    size_t _tail = m_tail.load(std::memory_order_acquire);
+
+    if (_tail >= _head)
+    {
+        return _tail - _head;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+template <typename T, size_t Size, typename Clock>
+size_t SojournQueue<T, Size, Clock>::GetApproximateSize() const noexcept
+{
+    const size_t _tail = m_tail.load(std::memory_order_relaxed);
+    const size_t _head = m_head.load(std::memory_order_relaxed);
+
+    return lfq::ClampApproximateSize(_head, _tail, Size);
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+// SPSC_ByteRing은 길이가 다른 레코드를 담는 단일 provider/단일 consumer 바이트 링이다.
+// SPSC_Q와 같은 head/tail 프로토콜을 사용하되, 인덱스는 슬롯 번호가 아니라
+// 계속 증가하는 바이트 위치이며 버퍼 크기(2의 거듭제곱)로 나눈 나머지로 접근한다.
+//
+// provider: reserve(n)로 받은 자리에 직접 쓰고 commit()으로 공개한다.
+// consumer: consume(handler)로 공개된 레코드를 복사 없이 차례로 읽고,
+//           호출이 끝날 때 읽은 레코드 전체를 head 저장 한 번으로 반납한다.
+//
+// 레코드는 8바이트 헤더(길이, 종류)와 8바이트 단위로 올림한 본문으로 구성된다.
+// 본문은 RECORD_ALIGNMENT 경계에 놓이므로 정렬 요구가 8 이하인 구조체로 바로 읽을 수 있다.
+// 버퍼 끝에 레코드가 연속으로 들어가지 않으면 남은 공간을 패딩 레코드로 채우고 버퍼 앞에서 시작한다.
+class SPSC_ByteRing
+{
+public:
+    static constexpr std::size_t RECORD_ALIGNMENT = 8;
+
+    // 버퍼 크기는 64 이상의 2의 거듭제곱(바이트)이어야 한다.
+    explicit SPSC_ByteRing(std::size_t _capacity_bytes)
+        : m_capacity(ValidateCapacity(_capacity_bytes)),
+          m_buffer(std::make_unique<std::uint64_t[]>(m_capacity / sizeof(std::uint64_t)))
+    {
+    }
+
+    std::size_t capacity() const noexcept { return m_capacity; }
+
+    // 한 레코드 본문의 최대 크기
+    // 레코드가 버퍼의 절반을 넘지 않으면 링이 비었을 때 패딩을 포함해도 항상 들어간다.
+    std::size_t max_record_size() const noexcept { return m_capacity / 2 - HEADER_SIZE; }
+
+    // provider 스레드에서만 호출하는 함수
+    // _size 바이트를 쓸 수 있는 본문 위치를 반환한다. 공간이 없거나 너무 크면 nullptr를 반환한다.
+    // 다음 reserve 전에 반드시 commit해야 한다.
+    void* reserve(std::size_t _size) noexcept
+    {
+        if (_size > max_record_size())
+        {
+            return nullptr;
+        }
+
+        const std::size_t _tail = m_tail.load(std::memory_order_relaxed);
+        const std::size_t _record_size = GetRecordSize(_size);
+        const std::size_t _contiguous = m_capacity - (_tail & (m_capacity - 1));
+
+        // 버퍼 끝에 들어가지 않으면 남은 부분을 패딩으로 건너뛴다
+        const std::size_t _padding_size = _record_size <= _contiguous ? 0 : _contiguous;
+        const std::size_t _required = _padding_size + _record_size;
+
+        // consumer가 반납한 위치는 공간이 부족할 때만 다시 읽는다
+        if (_tail + _required - m_cached_head > m_capacity)
+        {
+            // acquire는 consumer가 반납 전에 끝낸 읽기가 이후의 덮어쓰기보다 앞서게 한다
+            m_cached_head = m_head.load(std::memory_order_acquire);
+
+            if (_tail + _required - m_cached_head > m_capacity)
+            {
+                return nullptr;
+            }
+        }
+
+        if (_padding_size != 0)
+        {
+            WriteHeader(_tail, static_cast<std::uint32_t>(_padding_size - HEADER_SIZE), RECORD_TYPE_PADDING);
+        }
+
+        m_reserved_position = _tail + _padding_size;
+        m_reserved_size = _size;
+        return GetBytes(m_reserved_position + HEADER_SIZE);
+    }
+
+    // provider 스레드에서만 호출하는 함수
+    // 예약한 레코드를 공개한다. 실제로 쓴 크기가 예약보다 작으면 _size로 줄일 수 있다.
+    void commit(std::size_t _size) noexcept
+    {
+        if (_size > m_reserved_size)
+        {
+            _size = m_reserved_size;
+        }
+
+        WriteHeader(m_reserved_position, static_cast<std::uint32_t>(_size), RECORD_TYPE_DATA);
+
+        // 패딩과 레코드 본문을 consumer에게 공개한다
+        m_tail.store(m_reserved_position + GetRecordSize(_size), std::memory_order_release);
+    }
+
+    void commit() noexcept { commit(m_reserved_size); }
+
+    // provider 스레드에서만 호출하는 함수 (reserve + 복사 + commit)
+    bool push(const void* _data, std::size_t _size) noexcept
+    {
+        void* const _destination = reserve(_size);
+        if (nullptr == _destination)
+        {
+            return false;
+        }
+
+        std::memcpy(_destination, _data, _size);
+        commit(_size);
+        return true;
+    }
+
+    // consumer 스레드에서만 호출하는 함수
+    // 공개된 레코드마다 _handler(const void* _data, std::size_t _size)를 호출한다.
+    // _data는 _handler가 반환할 때까지만 유효하다. 처리한 레코드 수를 반환한다.
+    template <typename Handler>
+    std::size_t consume(Handler&& _handler, std::size_t _max_record_count = std::numeric_limits<std::size_t>::max())
+    {
+        const std::size_t _tail = m_tail.load(std::memory_order_acquire);
+        std::size_t _head = m_head.load(std::memory_order_relaxed);
+        std::size_t _record_count = 0;
+
+        while (_head != _tail && _record_count < _max_record_count)
+        {
+            const RecordHeader _header = ReadHeader(_head);
+
+            if (_header._type == RECORD_TYPE_DATA)
+            {
+                _handler(static_cast<const void*>(GetBytes(_head + HEADER_SIZE)), static_cast<std::size_t>(_header._size));
+                ++_record_count;
+            }
+
+            _head += GetRecordSize(_header._size);
+        }
+
+        // 읽은 레코드를 한 번에 반납한다
+        m_head.store(_head, std::memory_order_release);
+        return _record_count;
+    }
+
+    bool is_empty() const noexcept
+    {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr std::uint32_t RECORD_TYPE_DATA = 0;
+    static constexpr std::uint32_t RECORD_TYPE_PADDING = 1;
+
+    struct RecordHeader
+    {
+        std::uint32_t _size;
+        std::uint32_t _type;
+    };
+
+    static constexpr std::size_t HEADER_SIZE = sizeof(RecordHeader);
+    static_assert(HEADER_SIZE % RECORD_ALIGNMENT == 0, "헤더 뒤의 본문이 정렬되어야 함");
+
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    static std::size_t ValidateCapacity(std::size_t _capacity_bytes)
+    {
+        if (_capacity_bytes < 64 || (_capacity_bytes & (_capacity_bytes - 1)) != 0 ||
+            _capacity_bytes / 2 > std::numeric_limits<std::uint32_t>::max())
+        {
+            throw std::invalid_argument("SPSC_ByteRing capacity must be a power of two of at least 64 bytes");
+        }
+
+        return _capacity_bytes;
+    }
+
+    static constexpr std::size_t GetRecordSize(std::size_t _size) noexcept
+    {
+        return HEADER_SIZE + ((_size + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1));
+    }
+
+    std::byte* GetBytes(std::size_t _position) const noexcept
+    {
+        return reinterpret_cast<std::byte*>(m_buffer.get()) + (_position & (m_capacity - 1));
+    }
+
+    void WriteHeader(std::size_t _position, std::uint32_t _size, std::uint32_t _type) noexcept
+    {
+        const RecordHeader _header{_size, _type};
+        std::memcpy(GetBytes(_position), &_header, HEADER_SIZE);
+    }
+
+    RecordHeader ReadHeader(std::size_t _position) const noexcept
+    {
+        RecordHeader _header;
+        std::memcpy(&_header, GetBytes(_position), HEADER_SIZE);
+        return _header;
+    }
+
+    const std::size_t m_capacity;
+    std::unique_ptr<std::uint64_t[]> m_buffer;
+
+    // provider 전용 상태
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_tail{0};
+    std::size_t m_cached_head = 0;
+    std::size_t m_reserved_position = 0;
+    std::size_t m_reserved_size = 0;
+
+    // consumer 전용 상태
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_head{0};
+};
@@ -74,6 +74,23 @@ public:
         return _elem;
     }
 
+    // consumer 스레드에서 호출하는 연산이다.
+    // 맨 앞 원소를 꺼내지 않고 그 슬롯의 주소를 반환하며, 비어 있으면 nullptr를 반환한다.
+    // provider는 consumer가 pop()으로 head를 넘기기 전에는 이 슬롯을 다시 쓰지 않으므로
+    // 반환한 포인터는 다음 pop() 호출 전까지 유효하다.
+    const std::int64_t* peek() const noexcept
+    {
+        const std::size_t _head = m_head.load(std::memory_order_relaxed);
+
+        // pop()과 같은 이유로 tail을 acquire로 읽어 슬롯 쓰기 결과를 보이게 한다.
+        if (_head == m_tail.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        return &m_buffer[_head];
+    }
+
 private:
     static constexpr std::size_t CACHE_LINE_SIZE = 64;
     static constexpr std::size_t MAX_CAPACITY_EXCLUSIVE = 50;
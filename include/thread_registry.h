@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace lfq
+{
+    // 동시에 번호를 받을 수 있는 최대 스레드 수
+    constexpr size_t MAX_REGISTERED_THREAD_COUNT = 128;
+
+    // 번호가 모두 사용 중일 때 GetThreadIndex가 반환하는 값
+    constexpr size_t INVALID_THREAD_INDEX = static_cast<size_t>(-1);
+}
+
+// 스레드마다 [0, MAX_REGISTERED_THREAD_COUNT) 범위의 작은 번호를 나눠 주는 전역 등록부
+// 스레드별 배열(발행 레코드 등)의 인덱스로 쓴다. 처음 호출할 때 비트맵에서 빈 번호를 가져오고,
+// 스레드가 끝나면 thread_local 소멸자가 번호를 반납하므로 스레드를 계속 만들어도 번호가 고갈되지 않는다.
+// 동시에 살아 있는 스레드가 MAX_REGISTERED_THREAD_COUNT를 넘으면 lfq::INVALID_THREAD_INDEX를 반환하므로,
+// 호출하는 쪽은 번호 없이 동작하는 경로를 준비해야 한다.
+class ThreadRegistry
+{
+public:
+    ThreadRegistry() = delete;
+
+    // 현재 스레드의 번호. 같은 스레드에서는 항상 같은 값을 반환한다.
+    static size_t GetThreadIndex() noexcept
+    {
+        thread_local const Registration t_registration;
+        return t_registration._index;
+    }
+
+    // 현재 번호를 받은 스레드 수
+    static size_t GetRegisteredCount() noexcept;
+
+private:
+    static constexpr size_t BITS_PER_WORD = 64;
+    static constexpr size_t WORD_COUNT = lfq::MAX_REGISTERED_THREAD_COUNT / BITS_PER_WORD;
+
+    // 비트맵의 모든 비트가 유효한 번호가 되도록 한다
+    static_assert(lfq::MAX_REGISTERED_THREAD_COUNT % BITS_PER_WORD == 0, "MAX_REGISTERED_THREAD_COUNT는 64의 배수여야 함");
+
+    struct Registration
+    {
+        Registration() noexcept : _index(Acquire()) {}
+        ~Registration() { Release(_index); }
+
+        const size_t _index;
+    };
+
+    static size_t Acquire() noexcept;
+    static void Release(size_t _index) noexcept;
+
+    static inline std::atomic<std::uint64_t> s_used_words[WORD_COUNT] = {};
+};
+
+// ============================================================
+// 구현
+inline size_t ThreadRegistry::Acquire() noexcept
+{
+    for (size_t _word_index = 0; _word_index < WORD_COUNT; ++_word_index)
+    {
+        std::atomic<std::uint64_t>& _word = s_used_words[_word_index];
+        std::uint64_t _used = _word.load(std::memory_order_relaxed);
+
+        while (_used != ~std::uint64_t{0})
+        {
+            // 가장 낮은 빈 비트
+            const std::uint64_t _free_bit = ~_used & (_used + 1);
+            if (true == _word.compare_exchange_weak(_used, _used | _free_bit, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                size_t _bit_index = 0;
+                while ((_free_bit >> _bit_index) != 1)
+                {
+                    ++_bit_index;
+                }
+
+                return _word_index * BITS_PER_WORD + _bit_index;
+            }
+        }
+    }
+
+    return lfq::INVALID_THREAD_INDEX;
+}
+
+inline void ThreadRegistry::Release(size_t _index) noexcept
+{
+    if (_index == lfq::INVALID_THREAD_INDEX)
+    {
+        return;
+    }
+
+    // release: 이 스레드가 번호로 쓴 상태가 다음 주인보다 먼저 끝난다
+    s_used_words[_index / BITS_PER_WORD].fetch_and(~(std::uint64_t{1} << (_index % BITS_PER_WORD)), std::memory_order_release);
+}
+
+inline size_t ThreadRegistry::GetRegisteredCount() noexcept
+{
+    size_t _count = 0;
+
+    for (const auto& _word : s_used_words)
+    {
+        std::uint64_t _used = _word.load(std::memory_order_relaxed);
+        while (_used != 0)
+        {
+            _used &= _used - 1;
+            ++_count;
+        }
+    }
+
+    return _count;
+}
@@ -0,0 +1,473 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+#include "define.h"
+#include "mpmc_queue.h"
+#include "object_pool.h"
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324) // 구조체가 alignas로 패딩됨
+#endif
+
+// 지연 작업용 계층형 타이밍 휠
+// 아무 스레드나 Schedule()/Cancel()을 호출하고, 타이머 스레드 하나만 AdvanceTo()를 호출한다.
+// - Schedule: 풀에서 노드를 받아 채운 뒤 핸들을 MPMC 입력 큐에 넣는다 (잠금 없음).
+// - 타이머 스레드: 입력 큐의 노드를 휠에 연결하고, 틱마다 만료된 작업을 출력 큐로 내보낸다.
+// - Cancel: 노드 상태를 CAS로 바꾸고, 취소 큐로 알려 타이머 스레드가 곧바로 휠에서 떼어 낸다.
+//
+// 휠은 단계마다 2^SLOT_BITS개의 슬롯을 가지며, 단계 k의 슬롯 하나는 2^(SLOT_BITS*k) 틱을 담당한다.
+// 삽입과 만료는 O(1)이고, 상위 단계 슬롯은 해당 구간이 시작될 때 한 번 아래 단계로 내려간다.
+// 휠 범위(2^(SLOT_BITS*LEVEL_COUNT) 틱)를 넘는 타이머는 최상위 단계에 두었다가 다시 배치한다.
+//
+// 노드 상태는 상위 30비트 generation과 하위 2비트 상태로 구성되며,
+// 노드를 풀에 반납할 때 generation을 증가시켜 오래된 핸들로 취소하지 못하게 한다.
+// 모든 노드를 객체 안에 두므로 용량이 크면 힙에 할당해야 한다.
+template <typename Job, size_t Capacity, size_t IngressSize = lfq::QUEUE_SIZE, size_t OutputSize = lfq::QUEUE_SIZE>
+class TimerWheel
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // 상위 32비트 generation, 하위 32비트 노드 인덱스
+    using TimerHandle = std::uint64_t;
+    static constexpr TimerHandle INVALID_TIMER = std::numeric_limits<TimerHandle>::max();
+
+    explicit TimerWheel(Clock::duration _tick = std::chrono::milliseconds(1), Clock::time_point _start_time = Clock::now());
+    ~TimerWheel() { Stop(); }
+
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // 여러 스레드에서 안전 호출 가능
+    // 노드 풀이 비었거나 입력 큐가 가득 차면 INVALID_TIMER 반환
+    TimerHandle Schedule(Clock::time_point _deadline, const Job& _job) noexcept;
+
+    // 아직 만료되지 않은 타이머를 취소하면 true, 이미 만료되었거나 취소된 핸들이면 false
+    bool Cancel(TimerHandle _handle) noexcept;
+
+    // 만료된 작업을 꺼낸다 (여러 스레드에서 안전 호출 가능)
+    bool PopExpired(Job& _job) noexcept { return m_output.Pop(_job); }
+
+    // 타이머 스레드 전용: 입력/취소 큐를 처리하고 _now까지 틱을 진행한다. 출력 큐로 내보낸 작업 수를 반환한다.
+    size_t AdvanceTo(Clock::time_point _now);
+
+    // AdvanceTo를 틱마다 호출하는 내부 타이머 스레드를 시작/정지
+    void Start();
+    void Stop();
+
+    // 타이머 스레드 전용: 휠에 연결된 타이머 수
+    size_t GetWheelCount() const { return m_wheel_count; }
+
+private:
+    static constexpr size_t SLOT_BITS = 6;
+    static constexpr size_t SLOT_COUNT = size_t{1} << SLOT_BITS;
+    static constexpr size_t LEVEL_COUNT = 4;
+    static constexpr std::uint64_t WHEEL_RANGE = std::uint64_t{1} << (SLOT_BITS * LEVEL_COUNT);
+
+    static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+    enum NodeState : std::uint32_t
+    {
+        STATE_FREE = 0,
+        STATE_PENDING = 1,
+        STATE_CANCELLED = 2,
+        STATE_FIRED = 3,
+    };
+
+    struct Node
+    {
+        Job _job{};
+        std::uint64_t _deadline_tick = 0;
+
+        // 휠 슬롯의 이중 연결 리스트 (타이머 스레드 전용)
+        std::uint32_t _prev = INVALID_INDEX;
+        std::uint32_t _next = INVALID_INDEX;
+        std::uint8_t _level = 0;
+        std::uint8_t _slot = 0;
+        bool _linked = false;
+
+        std::atomic<std::uint32_t> _state{STATE_FREE};
+    };
+
+    using PoolType = ObjectPool<Node, Capacity>;
+
+    static constexpr std::uint32_t PackState(std::uint32_t _generation, NodeState _state) noexcept { return (_generation << 2) | _state; }
+    static constexpr std::uint32_t GetGeneration(std::uint32_t _state) noexcept { return _state >> 2; }
+
+    std::uint64_t ToTick(Clock::time_point _time, bool _round_up) const noexcept;
+
+    void Link(std::uint32_t _index);
+    void Unlink(std::uint32_t _index);
+    void Free(std::uint32_t _index);
+    bool Expire(std::uint32_t _index);
+    void Cascade(size_t _level);
+    bool Deliver(std::uint32_t _index);
+
+    PoolType m_pool;
+    MPMCQueue<std::uint32_t, IngressSize> m_ingress;
+    MPMCQueue<TimerHandle, IngressSize> m_cancelled;
+    MPMCQueue<Job, OutputSize> m_output;
+
+    const Clock::duration m_tick;
+    const Clock::time_point m_start_time;
+
+    // 같은 슬롯 안에서는 예약 순서대로 만료되도록 꼬리에 붙인다
+    struct SlotList
+    {
+        std::uint32_t _head = INVALID_INDEX;
+        std::uint32_t _tail = INVALID_INDEX;
+    };
+
+    // 아래는 타이머 스레드 전용
+    SlotList m_slots[LEVEL_COUNT][SLOT_COUNT];
+    std::uint64_t m_current_tick = 0;
+    size_t m_wheel_count = 0;
+
+    // 출력 큐가 가득 차 내보내지 못한 만료 노드 (다음 AdvanceTo에서 재시도)
+    std::vector<std::uint32_t> m_undelivered;
+
+    std::atomic<bool> m_running{false};
+    std::thread m_thread;
+};
+
+// ============================================================
+// 구현
+template <typename Job, size_t Capacity, size_t IngressSize, size_t OutputSize>
+TimerWheel<Job, Capacity, IngressSize, OutputSize>::TimerWheel(Clock::duration _tick, Clock::time_point _start_time)
+    : m_tick(_tick),
+      m_start_time(_start_time)
+{
+    static_assert(std::is_nothrow_copy_assignable_v<Job>, "Job은 예외 없이 복사 대입할 수 있어야 함");
+    static_assert(INVALID_INDEX == PoolType::INVALID_HANDLE, "노드 인덱스와 풀 핸들의 무효값이 같아야 함");
+}
+
+template <typename Job, size_t Capacity, size_t IngressSize, size_t OutputSize>
+typename TimerWheel<Job, Capacity, IngressSize, OutputSize>::TimerHandle
+TimerWheel<Job, Capacity, IngressSize, OutputSize>::Schedule(Clock::time_point _deadline, const Job& _job) noexcept
+{
+    const std::uint32_t _index = m_pool.Acquire();
+    if (_index == INVALID_INDEX)
+    {
+        return INVALID_TIMER;
+    }
+
+    Node& _node = m_pool.Get(_index);
+    const std::uint32_t _generation = GetGeneration(_node._state.load(std::memory_order_relaxed));
+
+    _node._job = _job;
+    _node._deadline_tick = ToTick(_deadline, true);
+    _node._state.store(PackState(_generation, STATE_PENDING), std::memory_order_relaxed);
+
+    // 입력 큐의 release/acquire로 노드 내용이 타이머 스레드에 전달됨
+    if (false == m_ingress.Push(_index))
+    {
+        _node._state.store(PackState(_generation + 1, STATE_FREE), std::memory_order_relaxed);
+        m_pool.Release(_index);
+        return INVALID_TIMER;
+    }
+
+    return (static_cast<TimerHandle>(_generation) << 32) | _index;
+}
+
+template <typename Job, size_t Capacity, size_t IngressSize, size_t OutputSize>
+bool TimerWheel<Job, Capacity, IngressSize, OutputSize>::Cancel(TimerHandle _handle) noexcept
+{
+    const std::uint32_t _index = static_cast<std::uint32_t>(_handle);
+    if (_index >= Capacity)
+    {
+        return false;
+    }
+
+    std::uint32_t _expected = PackState(static_cast<std::uint32_t>(_handle >> 32), STATE_PENDING);
+    const std::uint32_t _cancelled = PackState(static_cast<std::uint32_t>(_handle >> 32), STATE_CANCELLED);
+
+    if (false == m_pool.Get(_index)._state.compare_exchange_strong(_expected, _cancelled, std::memory_order_acq_rel))
+    {
+        return false;
+    }
+
+    // 취소 큐가 가득 차면 만료 시점에 회수됨
+    m_cancelled.Push(_handle);
+    return true;
+}
+
+template <typename Job, size_t Capacity, size_t IngressSize, size_t OutputSize>
+size_t TimerWheel<Job, Capacity, IngressSize, OutputSize>::AdvanceTo(Clock::time_point _now)
+{
+    size_t _delivered_count = 0;
+
+    // 1. 지난번에 내보내지 못한 작업 (만료 순서 유지)
+    while (_delivered_count < m_undelivered.size() && true == Deliver(m_undelivered[_delivered_count]))
+    {
+        ++_delivered_count;
+    }
+    m_undelivered.erase(m_undelivered.begin(), m_undelivered.begin() + static_cast<std::ptrdiff_t>(_delivered_count));
+
+    // 2. 새로 예약된 타이머를 휠에 연결 (이미 취소된 노드는 바로 반납하고, 마감이 지난 노드는 바로 만료)
+    std::uint32_t _index = INVALID_INDEX;
+    while (true == m_ingress.Pop(_index))
+    {
+        Node& _node = m_pool.Get(_index);
+
+        if (STATE_PENDING != (_node._state.load(std::memory_order_acquire) & 3))
+        {
+            Free(_index);
+            continue;
+        }
+
+        if (_node._deadline_tick <= m_current_tick)
+        {
+            _delivered_count += true == Expire(_index) ? 1 : 0;
+            continue;
+        }
+
+        Link(_index);
+    }
+
+    // 3. 취소된 타이머를 휠에서 떼어 냄
+    // 이미 반납되어 재사용된 노드는 generation이 달라 무시된다.
+    TimerHandle _handle = INVALID_TIMER;
+    while (true == m_cancelled.Pop(_handle))
+    {
+        const std::uint32_t _cancelled_index = static_cast<std::uint32_t>(_handle);
+        Node& _node = m_pool.Get(_cancelled_index);
+
+        if (_node._state.load(std::memory_order_acquire) == PackState(static_cast<std::uint32_t>(_handle >> 32), STATE_CANCELLED) &&
+            true == _node._linked)
+        {
+            Unlink(_cancelled_index);
+            Free(_cancelled_index);
+        }
+    }
+
+    // 4. 틱 진행
+    const std::uint64_t _target_tick = ToTick(_now, false);
+
+    while (m_current_tick < _target_tick)
+    {
+        if (m_wheel_count == 0)
+        {
+            m_current_tick = _target_tick;
+            break;
+        }
+
+        ++m_current_tick;
+
+        // 구간이 새로 시작된 상위 단계부터 아래 단계로 내린다
+        size_t _cascade_level = 0;
+        while (_cascade_level + 1 < LEVEL_COUNT && (m_current_tick & ((std::uint64_t{1} << (SLOT_BITS * (_cascade_level + 1))) - 1)) == 0)
+        {
+            ++_cascade_level;
+        }
+
+        for (size_t _level = _cascade_level; _level > 0; --_level)
+        {
+            Cascade(_level);
+        }
+
+        SlotList& _slot = m_slots[0][m_current_tick & (SLOT_COUNT - 1)];
+        while (_slot._head != INVALID_INDEX)
+        {
+            const std::uint32_t _expired_index = _slot._head;
+            Unlink(_expired_index);
+
+            if (m_pool.Get(_expired_index)._deadline_tick > m_current_tick)
+            {
+                Link(_expired_index);
+                continue;
+            }
+
+            _delivered_count += true == Expire(_expired_index) ? 1 : 0;
+        }
+    }
+
+    return _delivered_count;
+}
+
+template <typename Job, size_t Capacity, size_t IngressSize, size_t OutputSize>
+void TimerWheel<Job, Capacity, IngressSize, OutputSize>::Start()
+{
+    if (true == m_running.exchange(true))
+    {
+        return;
+    }
+
+    m_thread = std::thread([this]()
+    {
+        while (true == m_running.load(std::memory_order_relaxed))
+        {
+            AdvanceTo(Clock::now());
+            std::this_thread::sleep_for(m_tick);
+        }
+    });
+}
+
+template <typename Job, size_t Capacity, size_t IngressSize, size_t OutputSize>
+void TimerWheel<Job, Capacity, IngressSize, OutputSize>::Stop()
+{
+    if (false == m_running.exchange(false))
+    {
+        return;
+    }
+
+    m_thread.join();
+}
+
+template <typename Job, size_t Capacity, size_t IngressSize, size_t OutputSize>
+std::uint64_t TimerWheel<Job, Capacity, IngressSize, OutputSize>::ToTick(Clock::time_point _time, bool _round_up) const noexcept
+{
+    if (_time <= m_start_time)
+    {
+        return 0;
+    }
+
+    const auto _elapsed = (_time - m_start_time).count();
+    const auto _tick = m_tick.count();
+
+    return static_cast<std::uint64_t>(true == _round_up ? (_elapsed + _tick - 1) / _tick : _elapsed / _tick);
+}
+
+// 만료까지 남은 틱 수로 단계를 고르고, 마감 틱의 해당 단계 비트로 슬롯을 고른다.
+template <typename Job, size_t Capacity, size_t IngressSize, size_t OutputSize>
+void TimerWheel<Job, Capacity, IngressSize, OutputSize>::Link(std::uint32_t _index)
+{
+    Node& _node = m_pool.Get(_index);
+
+    // 휠 범위를 넘으면 최상위 단계의 가장 먼 슬롯에 두었다가 내려올 때 다시 배치
+    const std::uint64_t _delta = _node._deadline_tick - m_current_tick;
+    const std::uint64_t _placement_tick = _delta < WHEEL_RANGE ? _node._deadline_tick : m_current_tick + WHEEL_RANGE - 1;
+
+    size_t _level = 0;
+    while (_level + 1 < LEVEL_COUNT && (_placement_tick - m_current_tick) >= (std::uint64_t{1} << (SLOT_BITS * (_level + 1))))
+    {
+        ++_level;
+    }
+
+    const size_t _slot = (_placement_tick >> (SLOT_BITS * _level)) & (SLOT_COUNT - 1);
+    SlotList& _list = m_slots[_level][_slot];
+
+    _node._level = static_cast<std::uint8_t>(_level);
+    _node._slot = static_cast<std::uint8_t>(_slot);
+    _node._prev = _list._tail;
+    _node._next = INVALID_INDEX;
+    _node._linked = true;
+
+    if (_list._tail != INVALID_INDEX)
+    {
+        m_pool.Get(_list._tail)._next = _index;
+    }
+    else
+    {
+        _list._head = _index;
+    }
+
+    _list._tail = _index;
+    ++m_wheel_count;
+}
+
+template <typename Job, size_t Capacity, size_t IngressSize, size_t OutputSize>
+void TimerWheel<Job, Capacity, IngressSize, OutputSize>::Unlink(std::uint32_t _index)
+{
+    Node& _node = m_pool.Get(_index);
+    SlotList& _list = m_slots[_node._level][_node._slot];
+
+    if (_node._prev != INVALID_INDEX)
+    {
+        m_pool.Get(_node._prev)._next = _node._next;
+    }
+    else
+    {
+        _list._head = _node._next;
+    }
+
+    if (_node._next != INVALID_INDEX)
+    {
+        m_pool.Get(_node._next)._prev = _node._prev;
+    }
+    else
+    {
+        _list._tail = _node._prev;
+    }
+
+    _node._linked = false;
+    --m_wheel_count;
+}
+
+template <typename Job, size_t Capacity, size_t IngressSize, size_t OutputSize>
+void TimerWheel<Job, Capacity, IngressSize, OutputSize>::Free(std::uint32_t _index)
+{
+    Node& _node = m_pool.Get(_index);
+    const std::uint32_t _generation = GetGeneration(_node._state.load(std::memory_order_relaxed));
+
+    _node._state.store(PackState(_generation + 1, STATE_FREE), std::memory_order_release);
+    m_pool.Release(_index);
+}
+
+// 취소와 경쟁하므로 CAS로 FIRED 상태를 얻은 경우에만 내보낸다.
+// 출력 큐로 내보냈으면 true, 취소되었거나 출력 큐가 가득 차 보류했으면 false
+template <typename Job, size_t Capacity, size_t IngressSize, size_t OutputSize>
+bool TimerWheel<Job, Capacity, IngressSize, OutputSize>::Expire(std::uint32_t _index)
+{
+    Node& _node = m_pool.Get(_index);
+    const std::uint32_t _generation = GetGeneration(_node._state.load(std::memory_order_relaxed));
+    std::uint32_t _expected = PackState(_generation, STATE_PENDING);
+
+    if (false == _node._state.compare_exchange_strong(_expected, PackState(_generation, STATE_FIRED), std::memory_order_acq_rel))
+    {
+        Free(_index);
+        return false;
+    }
+
+    // 보류 중인 작업이 있으면 순서를 지키기 위해 뒤에 붙인다
+    if (false == m_undelivered.empty() || false == Deliver(_index))
+    {
+        m_undelivered.push_back(_index);
+        return false;
+    }
+
+    return true;
+}
+
+template <typename Job, size_t Capacity, size_t IngressSize, size_t OutputSize>
+void TimerWheel<Job, Capacity, IngressSize, OutputSize>::Cascade(size_t _level)
+{
+    SlotList& _list = m_slots[_level][(m_current_tick >> (SLOT_BITS * _level)) & (SLOT_COUNT - 1)];
+    std::uint32_t _index = _list._head;
+
+    _list = SlotList();
+
+    while (_index != INVALID_INDEX)
+    {
+        const std::uint32_t _next = m_pool.Get(_index)._next;
+
+        --m_wheel_count;
+        Link(_index);
+
+        _index = _next;
+    }
+}
+
+template <typename Job, size_t Capacity, size_t IngressSize, size_t OutputSize>
+bool TimerWheel<Job, Capacity, IngressSize, OutputSize>::Deliver(std::uint32_t _index)
+{
+    if (false == m_output.Push(m_pool.Get(_index)._job))
+    {
+        return false;
+    }
+
+    Free(_index);
+    return true;
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
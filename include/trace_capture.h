@@ -0,0 +1,369 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "mapped_file.h"
+
+namespace lfq
+{
+    enum class TraceOperation : std::uint8_t
+    {
+        Push = 1,
+        Pop = 2
+    };
+
+    // 트레이스 이벤트 하나 (16바이트)
+    struct TraceRecord
+    {
+        std::uint64_t _timestamp_ns;  // 캡처 시작부터 지난 시간
+        std::uint32_t _payload_size;  // 항목의 바이트 수
+        std::uint16_t _thread_id;     // 캡처 안에서 스레드마다 고유한 번호 (0부터 처음 기록한 순서)
+        TraceOperation _operation;
+        std::uint8_t _reserved;
+    };
+
+    static_assert(sizeof(TraceRecord) == 16, "TraceRecord는 16바이트여야 함");
+    static_assert(std::is_trivially_copyable_v<TraceRecord>);
+
+    // 스레드별 트레이스 파일 머리말. 레코드는 TRACE_HEADER_SIZE부터 이어진다.
+    struct TraceFileHeader
+    {
+        char _magic[8];
+        std::uint32_t _version;
+        std::uint32_t _thread_id;
+        std::uint64_t _capacity;
+        std::uint64_t _record_count;
+        std::uint64_t _dropped_count;
+    };
+
+    constexpr char TRACE_MAGIC[8] = {'L', 'F', 'Q', 'T', 'R', 'A', 'C', 'E'};
+    constexpr std::uint32_t TRACE_VERSION = 1;
+    constexpr size_t TRACE_HEADER_SIZE = 64;
+
+    static_assert(sizeof(TraceFileHeader) <= TRACE_HEADER_SIZE);
+
+    // 캡처 하나에 기록할 수 있는 최대 스레드 수. 넘는 스레드의 레코드는 버려진다.
+    constexpr size_t TRACE_MAX_THREAD_COUNT = 256;
+
+    // 트레이스에 기록할 항목 크기. 가변 길이 항목은 이 템플릿을 특수화한다.
+    template <typename T>
+    struct TracePayloadSize
+    {
+        static std::uint32_t Get(const T&) noexcept { return static_cast<std::uint32_t>(sizeof(T)); }
+    };
+
+    // 트레이스 파일 하나를 읽어 레코드를 _records 뒤에 붙인다. 형식이 맞지 않으면 false를 반환한다.
+    inline bool LoadTraceFile(const std::string& _path, std::vector<TraceRecord>& _records)
+    {
+        MappedFile _file;
+        if (false == _file.Open(_path, MappedFileMode::ReadOnly) || _file.GetSize() < TRACE_HEADER_SIZE)
+        {
+            return false;
+        }
+
+        TraceFileHeader _header{};
+        std::memcpy(&_header, _file.GetData(), sizeof(_header));
+
+        if (std::memcmp(_header._magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0 || _header._version != TRACE_VERSION ||
+            _header._record_count > (_file.GetSize() - TRACE_HEADER_SIZE) / sizeof(TraceRecord))
+        {
+            return false;
+        }
+
+        const size_t _first_index = _records.size();
+        _records.resize(_first_index + static_cast<size_t>(_header._record_count));
+        std::memcpy(_records.data() + _first_index, _file.GetData() + TRACE_HEADER_SIZE, static_cast<size_t>(_header._record_count) * sizeof(TraceRecord));
+        return true;
+    }
+}
+
+// 큐 작업을 스레드별 mmap 버퍼에 기록하는 가벼운 캡처기
+// 스레드마다 "<_path_prefix>.<스레드 번호>.trace" 파일을 처음 기록할 때 만들어 매핑하고,
+// 이후 기록은 공유 상태 없이 매핑된 메모리에 16바이트 레코드를 쓰는 것뿐이다.
+// 버퍼가 가득 차거나 파일을 만들 수 없거나 스레드 수가 lfq::TRACE_MAX_THREAD_COUNT를 넘으면 레코드를 버리고 수만 센다.
+//
+// - Record: 여러 스레드에서 호출 가능
+// - Finish: 기록하는 스레드가 모두 끝난 뒤(join 뒤) 호출한다. 머리말을 채우고 파일을 닫으며, 이후의 Record는 버려진다.
+//
+// 스레드 번호는 캡처 안에서 처음 기록한 순서대로 나눠 주며 스레드가 끝나도 재사용하지 않으므로,
+// 순서대로 살았던 두 스레드도 서로 다른 파일에 기록되어 따로 재생된다.
+class TraceCapture
+{
+public:
+    TraceCapture(std::string _path_prefix, size_t _records_per_thread)
+        : m_path_prefix(std::move(_path_prefix)),
+          m_records_per_thread(_records_per_thread),
+          m_start_time(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~TraceCapture() { Finish(); }
+
+    TraceCapture(TraceCapture&&) = delete;
+    TraceCapture(const TraceCapture&) = delete;
+    TraceCapture& operator=(TraceCapture&&) = delete;
+    TraceCapture& operator=(const TraceCapture&) = delete;
+
+    // 여러 스레드에서 안전 호출 가능
+    void Record(lfq::TraceOperation _operation, std::uint32_t _payload_size) noexcept;
+
+    // 기록을 마치고 만든 트레이스 파일 경로를 반환한다 (두 번째 호출부터는 빈 목록)
+    std::vector<std::string> Finish();
+
+    // 버려진 레코드 수. 기록하는 스레드가 모두 끝난 뒤 호출한다.
+    std::uint64_t GetDroppedCount() const noexcept;
+
+private:
+    struct ThreadBuffer
+    {
+        MappedFile _file;
+        lfq::TraceRecord* _records = nullptr;
+        size_t _count = 0;
+        std::uint64_t _dropped_count = 0;
+    };
+
+    struct ThreadSlot
+    {
+        std::atomic<std::uint64_t> _owner{0};  // 슬롯을 받은 스레드의 프로세스 고유 번호
+        std::unique_ptr<ThreadBuffer> _buffer; // 슬롯을 받은 스레드만 만들고 쓴다
+    };
+
+    static constexpr size_t INVALID_THREAD_ID = static_cast<size_t>(-1);
+
+    // 프로세스 안에서 스레드마다 한 번만 나눠 주는 번호 (0은 쓰지 않음)
+    static std::uint64_t GetThreadSerial() noexcept
+    {
+        static std::atomic<std::uint64_t> s_next_thread_serial{1};
+        thread_local const std::uint64_t t_thread_serial = s_next_thread_serial.fetch_add(1, std::memory_order_relaxed);
+        return t_thread_serial;
+    }
+
+    // 현재 스레드의 캡처 안 번호. 처음 기록하는 스레드는 다음 슬롯을 받는다.
+    size_t GetThreadId() noexcept;
+
+    ThreadBuffer* GetThreadBuffer(size_t _thread_id) noexcept;
+
+    std::string GetPath(size_t _thread_id) const { return m_path_prefix + "." + std::to_string(_thread_id) + ".trace"; }
+
+    size_t GetUsedSlotCount() const noexcept
+    {
+        const size_t _count = m_thread_count.load(std::memory_order_acquire);
+        return _count < lfq::TRACE_MAX_THREAD_COUNT ? _count : lfq::TRACE_MAX_THREAD_COUNT;
+    }
+
+    static inline std::atomic<std::uint64_t> s_next_capture_serial{1};
+
+    const std::string m_path_prefix;
+    const size_t m_records_per_thread;
+    const std::chrono::steady_clock::time_point m_start_time;
+
+    // 스레드별 번호 캐시가 소멸한 캡처와 같은 주소의 새 캡처를 구별하도록 캡처마다 고유한 번호
+    const std::uint64_t m_capture_serial = s_next_capture_serial.fetch_add(1, std::memory_order_relaxed);
+
+    std::atomic<size_t> m_thread_count{0};
+    ThreadSlot m_slots[lfq::TRACE_MAX_THREAD_COUNT];
+
+    // 스레드 슬롯이나 버퍼가 없어 버린 레코드 수
+    std::atomic<std::uint64_t> m_unbuffered_dropped_count{0};
+    bool m_finished = false;
+};
+
+// 큐를 감싸 성공한 Push/Pop을 TraceCapture에 기록하는 캡처 모드 래퍼
+// 감싼 큐와 같은 Push/Pop 인터페이스이므로 운영 코드에서 큐 타입만 바꿔 실제 트래픽을 캡처할 수 있다.
+template <typename QueueType>
+class CapturingQueue
+{
+public:
+    CapturingQueue(QueueType& _queue, TraceCapture& _capture) noexcept : m_queue(_queue), m_capture(_capture) {}
+
+    template <typename Item>
+    bool Push(Item&& _item) noexcept
+    {
+        // 이동으로 항목이 비기 전에 크기를 잰다
+        const std::uint32_t _payload_size = lfq::TracePayloadSize<std::decay_t<Item>>::Get(_item);
+        if (false == m_queue.Push(std::forward<Item>(_item)))
+        {
+            return false;
+        }
+
+        m_capture.Record(lfq::TraceOperation::Push, _payload_size);
+        return true;
+    }
+
+    template <typename Item>
+    bool Pop(Item& _item) noexcept
+    {
+        if (false == m_queue.Pop(_item))
+        {
+            return false;
+        }
+
+        m_capture.Record(lfq::TraceOperation::Pop, lfq::TracePayloadSize<Item>::Get(_item));
+        return true;
+    }
+
+    QueueType& GetQueue() noexcept { return m_queue; }
+
+private:
+    QueueType& m_queue;
+    TraceCapture& m_capture;
+};
+
+// ============================================================
+// 구현
+inline void TraceCapture::Record(lfq::TraceOperation _operation, std::uint32_t _payload_size) noexcept
+{
+    const size_t _thread_id = GetThreadId();
+    ThreadBuffer* const _buffer = _thread_id == INVALID_THREAD_ID ? nullptr : GetThreadBuffer(_thread_id);
+    if (nullptr == _buffer)
+    {
+        m_unbuffered_dropped_count.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    if (nullptr == _buffer->_records || _buffer->_count == m_records_per_thread)
+    {
+        ++_buffer->_dropped_count;
+        return;
+    }
+
+    const auto _elapsed = std::chrono::steady_clock::now() - m_start_time;
+
+    lfq::TraceRecord& _record = _buffer->_records[_buffer->_count++];
+    _record._timestamp_ns = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(_elapsed).count());
+    _record._payload_size = _payload_size;
+    _record._thread_id = static_cast<std::uint16_t>(_thread_id);
+    _record._operation = _operation;
+    _record._reserved = 0;
+}
+
+inline size_t TraceCapture::GetThreadId() noexcept
+{
+    struct CachedThreadId
+    {
+        std::uint64_t _capture_serial;
+        size_t _thread_id;
+    };
+
+    // 보통 한 스레드는 캡처 하나에만 기록하므로 마지막 캡처의 번호만 기억한다
+    thread_local CachedThreadId t_cached{0, INVALID_THREAD_ID};
+    if (t_cached._capture_serial == m_capture_serial)
+    {
+        return t_cached._thread_id;
+    }
+
+    // 여러 캡처를 번갈아 기록하면 이미 받은 슬롯을 다시 찾는다. 자기 번호는 자기만 쓰므로 경쟁하지 않는다.
+    const std::uint64_t _thread_serial = GetThreadSerial();
+    const size_t _used_count = GetUsedSlotCount();
+    size_t _thread_id = INVALID_THREAD_ID;
+
+    for (size_t i = 0; i < _used_count; ++i)
+    {
+        if (m_slots[i]._owner.load(std::memory_order_relaxed) == _thread_serial)
+        {
+            _thread_id = i;
+            break;
+        }
+    }
+
+    if (_thread_id == INVALID_THREAD_ID)
+    {
+        const size_t _new_id = m_thread_count.fetch_add(1, std::memory_order_acq_rel);
+        if (_new_id < lfq::TRACE_MAX_THREAD_COUNT)
+        {
+            m_slots[_new_id]._owner.store(_thread_serial, std::memory_order_relaxed);
+            _thread_id = _new_id;
+        }
+    }
+
+    t_cached = CachedThreadId{m_capture_serial, _thread_id};
+    return _thread_id;
+}
+
+inline TraceCapture::ThreadBuffer* TraceCapture::GetThreadBuffer(size_t _thread_id) noexcept
+{
+    std::unique_ptr<ThreadBuffer>& _buffer = m_slots[_thread_id]._buffer;
+    if (nullptr != _buffer)
+    {
+        return _buffer.get();
+    }
+
+    // 처음 기록하는 스레드: 파일을 만들어 매핑한다. 파일을 열지 못하면 _records가 nullptr인 채로 레코드를 버린다.
+    try
+    {
+        _buffer = std::make_unique<ThreadBuffer>();
+
+        const size_t _file_size = lfq::TRACE_HEADER_SIZE + m_records_per_thread * sizeof(lfq::TraceRecord);
+        if (true == _buffer->_file.Open(GetPath(_thread_id), lfq::MappedFileMode::Create, _file_size))
+        {
+            _buffer->_records = reinterpret_cast<lfq::TraceRecord*>(_buffer->_file.GetData() + lfq::TRACE_HEADER_SIZE);
+        }
+    }
+    catch (...)
+    {
+        // 버퍼나 경로 문자열을 할당하지 못함
+        return nullptr;
+    }
+
+    return _buffer.get();
+}
+
+inline std::vector<std::string> TraceCapture::Finish()
+{
+    std::vector<std::string> _paths;
+    if (true == m_finished)
+    {
+        return _paths;
+    }
+
+    m_finished = true;
+
+    const size_t _used_count = GetUsedSlotCount();
+    for (size_t _thread_id = 0; _thread_id < _used_count; ++_thread_id)
+    {
+        ThreadBuffer* const _buffer = m_slots[_thread_id]._buffer.get();
+        if (nullptr == _buffer || nullptr == _buffer->_records)
+        {
+            continue;
+        }
+
+        lfq::TraceFileHeader _header{};
+        std::memcpy(_header._magic, lfq::TRACE_MAGIC, sizeof(lfq::TRACE_MAGIC));
+        _header._version = lfq::TRACE_VERSION;
+        _header._thread_id = static_cast<std::uint32_t>(_thread_id);
+        _header._capacity = m_records_per_thread;
+        _header._record_count = _buffer->_count;
+        _header._dropped_count = _buffer->_dropped_count;
+        std::memcpy(_buffer->_file.GetData(), &_header, sizeof(_header));
+
+        _buffer->_file.Close();
+        _buffer->_records = nullptr;
+        _paths.push_back(GetPath(_thread_id));
+    }
+
+    return _paths;
+}
+
+inline std::uint64_t TraceCapture::GetDroppedCount() const noexcept
+{
+    std::uint64_t _dropped_count = m_unbuffered_dropped_count.load(std::memory_order_relaxed);
+
+    const size_t _used_count = GetUsedSlotCount();
+    for (size_t _thread_id = 0; _thread_id < _used_count; ++_thread_id)
+    {
+        if (nullptr != m_slots[_thread_id]._buffer)
+        {
+            _dropped_count += m_slots[_thread_id]._buffer->_dropped_count;
+        }
+    }
+
+    return _dropped_count;
+}
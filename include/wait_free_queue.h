@@ -0,0 +1,557 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "define.h"
+#include "thread_registry.h"
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4324) // 구조체가 alignas로 패딩됨
+#endif
+
+namespace lfq
+{
+    // 빠른 경로에서 상태 CAS를 몇 번 실패하면 요청을 공고하고 느린 경로로 넘어갈지
+    constexpr size_t WAIT_FREE_FAST_PATH_ATTEMPT_COUNT = 8;
+
+    enum class WaitFreeStatus
+    {
+        Ok,
+        Full,
+        Empty,
+        NoThreadIndex  // 호출한 스레드가 ThreadRegistry 번호를 받지 못함 (다시 시도해도 실패한다)
+    };
+}
+
+// Wait-Free Multi Producer Multi Consumer Queue (고정 용량)
+// MPMCQueue는 lock-free라 운이 나쁜 스레드가 Push/Pop 루프를 끝없이 다시 돌 수 있다.
+// 이 큐는 빠른 경로/느린 경로(fast-path/slow-path)와 도움(helping)으로 모든 호출의 단계 수에 상한을 둔다.
+// - 큐 상태(head, tail, 마지막으로 적용된 연산)는 스레드별 상태 레코드에 적고,
+//   m_state(버전 + 레코드 번호) 하나를 CAS로 바꿔 다음 상태로 넘어간다.
+// - 빠른 경로: 자기 연산을 적용한 새 상태를 최대 m_fast_path_attempt_count번 CAS한다.
+// - 느린 경로: 스레드별 공고 레코드에 요청을 적고, 적용될 때까지 다른 스레드와 함께 상태를 진행시킨다.
+// - 새 상태를 만드는 스레드는 (버전 % 스레드 수)번 스레드의 공고된 요청이 있으면 자기 것보다 먼저 적용한다.
+//   공고한 요청은 많아야 2 x lfq::MAX_REGISTERED_THREAD_COUNT번의 상태 전이 안에 적용된다.
+// - 상태를 바꾸기 전에 현재 상태의 뒷정리(슬롯 쓰기, 공고 레코드에 결과 쓰기)를 먼저 끝낸다.
+//   그래서 슬롯과 응답은 여러 스레드가 써도 같은 값을 한 번만 CAS로 쓰게 된다.
+//
+// 도우미가 값을 대신 옮겨야 하므로 T는 32비트 이하의 trivially copyable 타입이어야 하며,
+// 슬롯 하나가 [위치 태그 31비트 | 회수 비트 | 값 32비트] 64비트 단어다.
+// 큰 페이로드는 ObjectPool 핸들을 넣는다.
+// Pop한 스레드가 값을 읽고 회수 비트를 세우기 전에는 같은 슬롯에 다음 바퀴 Push를 하지 않으므로,
+// 그 사이에는 빈 칸이 있어도 Push가 가득 참으로 실패할 수 있다 (기다리는 대신 실패한다).
+// 공고 레코드 번호는 ThreadRegistry가 나눠 준다. 전제 조건: Push/Pop을 부르는 스레드는 번호를 받아야 한다
+// (동시에 살아 있는 스레드가 lfq::MAX_REGISTERED_THREAD_COUNT 이하). 어기면 디버그 빌드에서는 assert가 실패하고,
+// 릴리스 빌드에서는 false가 가득 참/빈 큐와 구별되지 않아 재시도 루프가 끝나지 않는다.
+// 이 조건을 보장할 수 없는 호출자는 TryPush/TryPop의 lfq::WaitFreeStatus::NoThreadIndex로 구별한다.
+// 객체가 크므로 std::make_unique로 생성한다.
+template <typename T, size_t Size>
+class WaitFreeQueue
+{
+public:
+    explicit WaitFreeQueue(size_t _fast_path_attempt_count = lfq::WAIT_FREE_FAST_PATH_ATTEMPT_COUNT);
+    ~WaitFreeQueue() = default;
+
+    WaitFreeQueue(WaitFreeQueue&&) = delete;
+    WaitFreeQueue(const WaitFreeQueue&) = delete;
+    WaitFreeQueue& operator=(WaitFreeQueue&&) = delete;
+    WaitFreeQueue& operator=(const WaitFreeQueue&) = delete;
+
+    // 여러 스레드에서 안전 호출 가능
+    bool Push(const T& _item) noexcept { return CheckStatus(TryPush(_item)); }
+    bool Push(T&& _item) noexcept { return Push(static_cast<const T&>(_item)); }
+    bool Pop(T& _item) noexcept { return CheckStatus(TryPop(_item)); }
+
+    // 실패 이유를 구별해야 할 때 사용 (Full/Empty는 재시도할 수 있고 NoThreadIndex는 그렇지 않다)
+    lfq::WaitFreeStatus TryPush(const T& _item) noexcept;
+    lfq::WaitFreeStatus TryPop(T& _item) noexcept;
+
+    bool IsEmpty() const { return GetApproximateSize() == 0; }
+    size_t GetSize() const { return GetApproximateSize(); }
+    size_t GetApproximateSize() const noexcept;
+    constexpr size_t GetCapacity() const { return Size; }
+
+    // 느린 경로로 넘어간 호출 수
+    std::uint64_t GetSlowPathCount() const noexcept { return m_slow_path_count.load(std::memory_order_relaxed); }
+
+private:
+    static_assert(std::is_trivially_copyable_v<T>, "T는 trivially copyable이어야 함");
+    static_assert(sizeof(T) <= sizeof(std::uint32_t), "T는 32비트 이하여야 함 (큰 페이로드는 ObjectPool 핸들 사용)");
+
+    enum Operation : std::uint64_t
+    {
+        OPERATION_PUSH = 0,
+        OPERATION_POP
+    };
+
+    // 상태 전이의 결과. 앞의 네 값은 응답 단어의 상위 2비트로도 쓴다.
+    enum Result : std::uint64_t
+    {
+        RESULT_PUSHED = 0,
+        RESULT_POPPED,
+        RESULT_FULL,
+        RESULT_EMPTY,
+        RESULT_NONE
+    };
+
+    static bool CheckStatus(lfq::WaitFreeStatus _status) noexcept
+    {
+        assert(_status != lfq::WaitFreeStatus::NoThreadIndex && "WaitFreeQueue - ThreadRegistry 번호가 없는 스레드에서 호출함");
+        return _status == lfq::WaitFreeStatus::Ok;
+    }
+
+    static constexpr std::uint64_t NO_OWNER = static_cast<std::uint64_t>(-1);
+    static constexpr size_t RECORD_COUNT = lfq::MAX_REGISTERED_THREAD_COUNT * 2;
+    static constexpr std::uint64_t RECORD_INDEX_BITS = 8;
+    static constexpr std::uint64_t RECORD_INDEX_MASK = (1ull << RECORD_INDEX_BITS) - 1;
+
+    static constexpr std::uint64_t TAG_MASK = 0x7FFFFFFFull;
+    static constexpr std::uint64_t ACK_BIT = 1ull << 32;
+    static constexpr std::uint64_t RESPONSE_PAYLOAD_MASK = (1ull << 62) - 1;
+
+    // 어떤 연산의 응답과도 겹치지 않는 초기 응답 (버전이 2^62에 닿을 일은 없다)
+    static constexpr std::uint64_t INITIAL_RESPONSE = static_cast<std::uint64_t>(-1);
+
+    static_assert(RECORD_COUNT <= RECORD_INDEX_MASK + 1, "상태 레코드 번호가 m_state에 들어가지 않음");
+
+    // 큐 상태 하나. 소유 스레드만 쓰고, m_state가 가리키는 동안에는 바뀌지 않는다.
+    // 가리키지 않게 된 레코드를 읽는 스레드는 m_state를 다시 읽어 확인하므로 필드는 모두 atomic이다.
+    struct alignas(lfq::CACHE_LINE_SIZE) StateRecord
+    {
+        std::atomic<std::uint64_t> _head{0};
+        std::atomic<std::uint64_t> _tail{0};
+        std::atomic<std::uint64_t> _owner{NO_OWNER};  // 마지막 연산을 공고한 스레드 (빠른 경로면 NO_OWNER)
+        std::atomic<std::uint64_t> _sequence{0};      // 공고된 요청 번호
+        std::atomic<std::uint64_t> _result{RESULT_NONE};
+        std::atomic<std::uint64_t> _position{0};      // Push/Pop이 차지한 위치
+        std::atomic<std::uint64_t> _value{0};         // Push한 값
+    };
+
+    // m_state와 레코드를 한 번에 읽은 사본
+    struct Snapshot
+    {
+        std::uint64_t _state;
+        std::uint64_t _head;
+        std::uint64_t _tail;
+        std::uint64_t _owner;
+        std::uint64_t _sequence;
+        std::uint64_t _result;
+        std::uint64_t _position;
+        std::uint64_t _value;
+
+        std::uint64_t GetVersion() const noexcept { return _state >> RECORD_INDEX_BITS; }
+    };
+
+    // 스레드 하나의 공고 레코드. 요청은 소유 스레드만 쓰고, 응답과 적용 번호는 도우미가 CAS로 쓴다.
+    struct alignas(lfq::CACHE_LINE_SIZE) Announcement
+    {
+        std::atomic<std::uint64_t> _request_sequence{0};
+        std::atomic<std::uint64_t> _request_operation{OPERATION_PUSH};
+        std::atomic<std::uint64_t> _request_value{0};
+        std::atomic<std::uint64_t> _applied_sequence{0};  // 상태에 적용된 마지막 요청 번호
+        std::atomic<std::uint64_t> _response{INITIAL_RESPONSE};
+    };
+
+    struct alignas(lfq::CACHE_LINE_SIZE) Slot
+    {
+        std::atomic<std::uint64_t> _word;
+    };
+
+    static std::uint64_t GetTag(std::uint64_t _position) noexcept { return _position & TAG_MASK; }
+
+    static std::uint64_t MakeSlotWord(std::uint64_t _position, bool _acknowledged, std::uint64_t _value) noexcept
+    {
+        return (GetTag(_position) << 33) | (true == _acknowledged ? ACK_BIT : 0) | (_value & 0xFFFFFFFFull);
+    }
+
+    static std::uint64_t ToValue(const T& _item) noexcept
+    {
+        std::uint32_t _bits = 0;
+        std::memcpy(&_bits, &_item, sizeof(T));
+        return _bits;
+    }
+
+    static T FromValue(std::uint64_t _value) noexcept
+    {
+        const std::uint32_t _bits = static_cast<std::uint32_t>(_value);
+        T _item;
+        std::memcpy(&_item, &_bits, sizeof(T));
+        return _item;
+    }
+
+    // m_state와 그 레코드를 읽고, 읽는 동안 m_state가 그대로였으면 true
+    bool TryLoadState(Snapshot& _snapshot) const noexcept;
+
+    // _current에서 연산 하나를 적용한 다음 상태를 만든다 (가득 참/빈 큐도 결과로 기록한다)
+    void BuildNextState(const Snapshot& _current, std::uint64_t _operation, std::uint64_t _value, Snapshot& _next) const noexcept;
+
+    // _thread_index의 레코드에 _next를 적고 m_state를 _current에서 바꾼다
+    bool ProposeState(const Snapshot& _current, size_t _thread_index, Snapshot& _next) noexcept;
+
+    // 상태 _snapshot을 만든 연산의 뒷정리: Push한 값을 슬롯에 쓰고, 공고된 연산이면 응답을 쓴다
+    void CompleteState(const Snapshot& _snapshot) noexcept;
+
+    bool IsPending(size_t _thread_index) const noexcept;
+
+    // _target의 공고된 요청을 _current에 적용해 본다 (이미 적용됐으면 아무것도 하지 않는다)
+    void HelpAnnouncement(const Snapshot& _current, size_t _thread_index, size_t _target) noexcept;
+
+    // 빠른 경로 한 번: 도와야 할 공고가 있으면 돕고 false, 자기 연산을 끝냈으면 true
+    bool TryFastPath(size_t _thread_index, std::uint64_t _operation, std::uint64_t _value, Snapshot& _next) noexcept;
+
+    // 요청을 공고하고 적용될 때까지 돕는다. 응답 단어를 반환한다.
+    std::uint64_t ExecuteSlowPath(size_t _thread_index, std::uint64_t _operation, std::uint64_t _value) noexcept;
+
+    // Pop이 차지한 위치의 값을 읽고 회수 비트를 세운다
+    T TakeSlot(std::uint64_t _position) noexcept;
+
+    Slot m_buffer[Size];
+    Announcement m_announcements[lfq::MAX_REGISTERED_THREAD_COUNT];
+    StateRecord m_records[RECORD_COUNT];
+
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<std::uint64_t> m_state;  // [버전 | 레코드 번호 8비트]
+    alignas(lfq::CACHE_LINE_SIZE) std::atomic<std::uint64_t> m_slow_path_count;
+    const size_t m_fast_path_attempt_count;
+};
+
+// ============================================================
+// 구현
+template <typename T, size_t Size>
+WaitFreeQueue<T, Size>::WaitFreeQueue(size_t _fast_path_attempt_count)
+    : m_state(0), m_slow_path_count(0), m_fast_path_attempt_count(_fast_path_attempt_count)
+{
+    static_assert(Size >= 2, "큐 크기는 2 이상이어야 함");
+    static_assert((Size & (Size - 1)) == 0, "WaitFreeQueue - 큐 사이즈가 2의 제곱이어야 함");
+    static_assert(Size <= (TAG_MASK + 1) / 2, "위치 태그로 바퀴를 구분할 수 없을 만큼 큼");
+
+    // 처음에는 모든 슬롯이 "이전 바퀴에 꺼내고 회수된" 상태다
+    for (size_t i = 0; i < Size; ++i)
+    {
+        m_buffer[i]._word.store(MakeSlotWord(static_cast<std::uint64_t>(i) - Size, true, 0), std::memory_order_relaxed);
+    }
+}
+
+template <typename T, size_t Size>
+lfq::WaitFreeStatus WaitFreeQueue<T, Size>::TryPush(const T& _item) noexcept
+{
+    const size_t _thread_index = ThreadRegistry::GetThreadIndex();
+    if (_thread_index == lfq::INVALID_THREAD_INDEX)
+    {
+        return lfq::WaitFreeStatus::NoThreadIndex;
+    }
+
+    const std::uint64_t _value = ToValue(_item);
+    Snapshot _next{};
+
+    for (size_t _attempt = 0; _attempt < m_fast_path_attempt_count; ++_attempt)
+    {
+        if (true == TryFastPath(_thread_index, OPERATION_PUSH, _value, _next))
+        {
+            return _next._result == RESULT_PUSHED ? lfq::WaitFreeStatus::Ok : lfq::WaitFreeStatus::Full;
+        }
+    }
+
+    m_slow_path_count.fetch_add(1, std::memory_order_relaxed);
+    return (ExecuteSlowPath(_thread_index, OPERATION_PUSH, _value) >> 62) == RESULT_PUSHED ? lfq::WaitFreeStatus::Ok : lfq::WaitFreeStatus::Full;
+}
+
+template <typename T, size_t Size>
+lfq::WaitFreeStatus WaitFreeQueue<T, Size>::TryPop(T& _item) noexcept
+{
+    const size_t _thread_index = ThreadRegistry::GetThreadIndex();
+    if (_thread_index == lfq::INVALID_THREAD_INDEX)
+    {
+        return lfq::WaitFreeStatus::NoThreadIndex;
+    }
+
+    Snapshot _next{};
+
+    for (size_t _attempt = 0; _attempt < m_fast_path_attempt_count; ++_attempt)
+    {
+        if (true == TryFastPath(_thread_index, OPERATION_POP, 0, _next))
+        {
+            if (_next._result != RESULT_POPPED)
+            {
+                return lfq::WaitFreeStatus::Empty;
+            }
+
+            _item = TakeSlot(_next._position);
+            return lfq::WaitFreeStatus::Ok;
+        }
+    }
+
+    m_slow_path_count.fetch_add(1, std::memory_order_relaxed);
+    const std::uint64_t _response = ExecuteSlowPath(_thread_index, OPERATION_POP, 0);
+    if ((_response >> 62) != RESULT_POPPED)
+    {
+        return lfq::WaitFreeStatus::Empty;
+    }
+
+    _item = TakeSlot(_response & RESPONSE_PAYLOAD_MASK);
+    return lfq::WaitFreeStatus::Ok;
+}
+
+template <typename T, size_t Size>
+size_t WaitFreeQueue<T, Size>::GetApproximateSize() const noexcept
+{
+    Snapshot _snapshot{};
+    for (int _attempt = 0; _attempt < 4; ++_attempt)
+    {
+        if (true == TryLoadState(_snapshot))
+        {
+            break;
+        }
+    }
+
+    // 끝내 일관된 사본을 얻지 못하면 섞인 값일 수 있으므로 범위만 맞춘다
+    const std::uint64_t _size = _snapshot._tail - _snapshot._head;
+    return _size > Size ? Size : static_cast<size_t>(_size);
+}
+
+template <typename T, size_t Size>
+bool WaitFreeQueue<T, Size>::TryLoadState(Snapshot& _snapshot) const noexcept
+{
+    _snapshot._state = m_state.load(std::memory_order_acquire);
+
+    const StateRecord& _record = m_records[_snapshot._state & RECORD_INDEX_MASK];
+    _snapshot._head = _record._head.load(std::memory_order_relaxed);
+    _snapshot._tail = _record._tail.load(std::memory_order_relaxed);
+    _snapshot._owner = _record._owner.load(std::memory_order_relaxed);
+    _snapshot._sequence = _record._sequence.load(std::memory_order_relaxed);
+    _snapshot._result = _record._result.load(std::memory_order_relaxed);
+    _snapshot._position = _record._position.load(std::memory_order_relaxed);
+    _snapshot._value = _record._value.load(std::memory_order_relaxed);
+
+    // seqlock과 같은 방식: 필드를 읽은 뒤에도 m_state가 같으면 레코드가 다시 쓰이지 않았다
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return m_state.load(std::memory_order_relaxed) == _snapshot._state;
+}
+
+template <typename T, size_t Size>
+void WaitFreeQueue<T, Size>::BuildNextState(const Snapshot& _current, std::uint64_t _operation, std::uint64_t _value, Snapshot& _next) const noexcept
+{
+    _next._head = _current._head;
+    _next._tail = _current._tail;
+    _next._position = 0;
+    _next._value = 0;
+
+    if (_operation == OPERATION_PUSH)
+    {
+        // 지난 바퀴에 이 슬롯을 꺼낸 스레드가 아직 값을 읽지 않았으면 가득 찬 것으로 본다
+        const std::uint64_t _word = m_buffer[_current._tail & (Size - 1)]._word.load(std::memory_order_acquire);
+        const bool _reusable = (_word >> 33) == GetTag(_current._tail - Size) && (_word & ACK_BIT) != 0;
+
+        if (_current._tail - _current._head >= Size || false == _reusable)
+        {
+            _next._result = RESULT_FULL;
+            return;
+        }
+
+        _next._result = RESULT_PUSHED;
+        _next._position = _current._tail;
+        _next._value = _value;
+        ++_next._tail;
+        return;
+    }
+
+    if (_current._head == _current._tail)
+    {
+        _next._result = RESULT_EMPTY;
+        return;
+    }
+
+    _next._result = RESULT_POPPED;
+    _next._position = _current._head;
+    ++_next._head;
+}
+
+template <typename T, size_t Size>
+bool WaitFreeQueue<T, Size>::ProposeState(const Snapshot& _current, size_t _thread_index, Snapshot& _next) noexcept
+{
+    // 스레드마다 레코드가 두 개이므로 현재 상태가 가리키지 않는 쪽은 언제나 비어 있다
+    const std::uint64_t _record_index = _thread_index * 2 + ((_current._state & RECORD_INDEX_MASK) == _thread_index * 2 ? 1 : 0);
+
+    // 이 레코드를 아직 읽는 스레드가 필드를 새로 쓴 값을 보면 m_state가 바뀐 것도 보게 한다
+    std::atomic_thread_fence(std::memory_order_release);
+
+    StateRecord& _record = m_records[_record_index];
+    _record._head.store(_next._head, std::memory_order_relaxed);
+    _record._tail.store(_next._tail, std::memory_order_relaxed);
+    _record._owner.store(_next._owner, std::memory_order_relaxed);
+    _record._sequence.store(_next._sequence, std::memory_order_relaxed);
+    _record._result.store(_next._result, std::memory_order_relaxed);
+    _record._position.store(_next._position, std::memory_order_relaxed);
+    _record._value.store(_next._value, std::memory_order_relaxed);
+
+    _next._state = ((_current.GetVersion() + 1) << RECORD_INDEX_BITS) | _record_index;
+
+    std::uint64_t _expected = _current._state;
+    return m_state.compare_exchange_strong(_expected, _next._state, std::memory_order_acq_rel, std::memory_order_relaxed);
+}
+
+template <typename T, size_t Size>
+void WaitFreeQueue<T, Size>::CompleteState(const Snapshot& _snapshot) noexcept
+{
+    if (_snapshot._result == RESULT_PUSHED)
+    {
+        // 지난 바퀴의 회수된 단어에서만 바꾸므로 늦게 도착한 도우미는 아무것도 하지 않는다
+        std::atomic<std::uint64_t>& _slot_word = m_buffer[_snapshot._position & (Size - 1)]._word;
+        std::uint64_t _word = _slot_word.load(std::memory_order_acquire);
+
+        if ((_word >> 33) == GetTag(_snapshot._position - Size) && (_word & ACK_BIT) != 0)
+        {
+            _slot_word.compare_exchange_strong(_word, MakeSlotWord(_snapshot._position, false, _snapshot._value), std::memory_order_acq_rel);
+        }
+    }
+
+    if (_snapshot._owner == NO_OWNER)
+    {
+        return;
+    }
+
+    // 응답은 [결과 2비트 | 위치 또는 버전]이다. 성공은 위치, 실패는 버전을 넣어
+    // 한 스레드가 받는 응답 단어가 모두 달라지므로 CAS가 ABA에 걸리지 않는다.
+    Announcement& _announcement = m_announcements[_snapshot._owner];
+    const std::uint64_t _payload = _snapshot._result == RESULT_PUSHED || _snapshot._result == RESULT_POPPED ? _snapshot._position : _snapshot.GetVersion();
+    const std::uint64_t _response = (_snapshot._result << 62) | (_payload & RESPONSE_PAYLOAD_MASK);
+
+    // 응답을 먼저 읽고 요청 번호를 확인해야, 소유 스레드가 다음 요청으로 넘어간 뒤의 응답을 덮어쓰지 않는다
+    std::uint64_t _old_response = _announcement._response.load();
+    if (_old_response != _response && _announcement._request_sequence.load() == _snapshot._sequence)
+    {
+        _announcement._response.compare_exchange_strong(_old_response, _response);
+    }
+
+    std::uint64_t _applied_sequence = _announcement._applied_sequence.load();
+    while (_applied_sequence < _snapshot._sequence && false == _announcement._applied_sequence.compare_exchange_weak(_applied_sequence, _snapshot._sequence))
+    {
+    }
+}
+
+template <typename T, size_t Size>
+bool WaitFreeQueue<T, Size>::IsPending(size_t _thread_index) const noexcept
+{
+    const Announcement& _announcement = m_announcements[_thread_index];
+    return _announcement._request_sequence.load() > _announcement._applied_sequence.load();
+}
+
+template <typename T, size_t Size>
+void WaitFreeQueue<T, Size>::HelpAnnouncement(const Snapshot& _current, size_t _thread_index, size_t _target) noexcept
+{
+    const Announcement& _announcement = m_announcements[_target];
+    const std::uint64_t _sequence = _announcement._request_sequence.load();
+    const std::uint64_t _operation = _announcement._request_operation.load();
+    const std::uint64_t _value = _announcement._request_value.load();
+
+    // 현재 상태가 완료된 뒤이므로 적용 번호가 요청 번호에 닿았으면 이미 적용된 요청이다.
+    // 읽는 사이 요청이 바뀌었다면 그 전에 상태도 바뀌었으므로 아래 CAS가 실패한다.
+    if (_sequence <= _announcement._applied_sequence.load())
+    {
+        return;
+    }
+
+    Snapshot _next{};
+    BuildNextState(_current, _operation, _value, _next);
+    _next._owner = _target;
+    _next._sequence = _sequence;
+
+    ProposeState(_current, _thread_index, _next);
+}
+
+template <typename T, size_t Size>
+bool WaitFreeQueue<T, Size>::TryFastPath(size_t _thread_index, std::uint64_t _operation, std::uint64_t _value, Snapshot& _next) noexcept
+{
+    Snapshot _current{};
+    if (false == TryLoadState(_current))
+    {
+        return false;
+    }
+
+    CompleteState(_current);
+
+    // 차례가 된 스레드의 공고가 있으면 자기 연산보다 먼저 적용한다
+    const size_t _priority_index = static_cast<size_t>(_current.GetVersion() % lfq::MAX_REGISTERED_THREAD_COUNT);
+    if (_priority_index != _thread_index && true == IsPending(_priority_index))
+    {
+        HelpAnnouncement(_current, _thread_index, _priority_index);
+        return false;
+    }
+
+    BuildNextState(_current, _operation, _value, _next);
+
+    // 가득 참/빈 큐는 읽은 상태가 유효했던 시점에 확정되므로 상태를 바꾸지 않고 끝낸다
+    if (_next._result == RESULT_FULL || _next._result == RESULT_EMPTY)
+    {
+        return true;
+    }
+
+    _next._owner = NO_OWNER;
+    _next._sequence = 0;
+
+    if (false == ProposeState(_current, _thread_index, _next))
+    {
+        return false;
+    }
+
+    CompleteState(_next);
+    return true;
+}
+
+template <typename T, size_t Size>
+std::uint64_t WaitFreeQueue<T, Size>::ExecuteSlowPath(size_t _thread_index, std::uint64_t _operation, std::uint64_t _value) noexcept
+{
+    Announcement& _announcement = m_announcements[_thread_index];
+    const std::uint64_t _previous_response = _announcement._response.load();
+
+    _announcement._request_operation.store(_operation);
+    _announcement._request_value.store(_value);
+    _announcement._request_sequence.store(_announcement._request_sequence.load(std::memory_order_relaxed) + 1);
+
+    // 매 반복마다 상태가 한 번 이상 바뀌거나 자기 요청이 끝나므로 반복 횟수에 상한이 있다
+    while (true)
+    {
+        std::uint64_t _response = _announcement._response.load();
+        if (_response != _previous_response)
+        {
+            return _response;
+        }
+
+        Snapshot _current{};
+        if (false == TryLoadState(_current))
+        {
+            continue;
+        }
+
+        CompleteState(_current);
+
+        _response = _announcement._response.load();
+        if (_response != _previous_response)
+        {
+            return _response;
+        }
+
+        const size_t _priority_index = static_cast<size_t>(_current.GetVersion() % lfq::MAX_REGISTERED_THREAD_COUNT);
+        const size_t _target = _priority_index != _thread_index && true == IsPending(_priority_index) ? _priority_index : _thread_index;
+        HelpAnnouncement(_current, _thread_index, _target);
+    }
+}
+
+template <typename T, size_t Size>
+T WaitFreeQueue<T, Size>::TakeSlot(std::uint64_t _position) noexcept
+{
+    // Pop이 적용되기 전에 그 위치의 Push 뒷정리가 끝났고, 회수 비트를 세울 때까지 다른 스레드는 슬롯을 바꾸지 않는다
+    std::atomic<std::uint64_t>& _slot_word = m_buffer[_position & (Size - 1)]._word;
+    const T _item = FromValue(_slot_word.load(std::memory_order_acquire));
+
+    _slot_word.fetch_or(ACK_BIT, std::memory_order_release);
+    return _item;
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,299 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "batching_producer.h"
+#include "mpmc_queue.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr size_t BatchSize = 32;
+    constexpr auto MaxBatchDelay = std::chrono::microseconds(100);
+
+    // 지연 시간 측정용 타임스탬프는 일부 항목에만 기록해 시계 호출 비용이 처리량을 왜곡하지 않게 한다.
+    constexpr size_t LatencySampleInterval = 64;
+
+    struct Item
+    {
+        std::uint64_t value;
+        std::int64_t enqueue_ns;
+    };
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double messages_per_sec;
+        double latency_p50_us;
+        double latency_p99_us;
+        double latency_max_us;
+        std::uint64_t checksum;
+        std::uint64_t expected_checksum;
+    };
+
+    std::int64_t NowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    Item MakeItem(size_t _thread_id, size_t _operation_index)
+    {
+        return Item{
+            _thread_id * lfq::OPERATIONS_PER_THREAD + _operation_index,
+            (_operation_index % LatencySampleInterval) == 0 ? NowNs() : 0};
+    }
+
+    // 소비자 한 명이 관찰한 체크섬과 표본 지연 시간
+    struct ConsumerStats
+    {
+        std::uint64_t _checksum = 0;
+        std::vector<std::int64_t> _latencies_ns;
+
+        void Record(const Item& _item, std::int64_t _now_ns)
+        {
+            _checksum += _item.value;
+
+            if (_item.enqueue_ns != 0)
+            {
+                _latencies_ns.push_back(_now_ns - _item.enqueue_ns);
+            }
+        }
+    };
+
+    // 기존 ProducerThread/ConsumerThread와 같은 방식으로 항목마다 Push/Pop한다.
+    // 소비자는 미리 나눠 받은 몫만큼 Pop한다.
+    struct PerItemScenario
+    {
+        using QueueType = MPMCQueue<Item, lfq::QUEUE_SIZE>;
+
+        std::unique_ptr<QueueType> m_queue = std::make_unique<QueueType>();
+
+        void Produce(size_t _thread_id)
+        {
+            for (size_t _operation_index = 0; _operation_index < lfq::OPERATIONS_PER_THREAD; ++_operation_index)
+            {
+                const Item _item = MakeItem(_thread_id, _operation_index);
+
+                while (false == m_queue->Push(_item))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void Consume(size_t _operation_count, std::atomic<size_t>&, ConsumerStats& _stats)
+        {
+            Item _item{};
+
+            for (size_t _success_count = 0; _success_count < _operation_count;)
+            {
+                if (true == m_queue->Pop(_item))
+                {
+                    _stats.Record(_item, _item.enqueue_ns != 0 ? NowNs() : 0);
+                    ++_success_count;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    };
+
+    // BatchingProducer로 모아 묶음 단위로 Push한다. 큐 용량은 항목 기준으로 PerItemScenario와 같다.
+    // 묶음 크기가 일정하지 않아 소비자 몫을 미리 나눌 수 없으므로 남은 항목 수를 묶음마다 공유 카운터에서 뺀다.
+    struct BatchedScenario
+    {
+        using ProducerType = BatchingProducer<Item, BatchSize, lfq::QUEUE_SIZE / BatchSize>;
+        using QueueType = ProducerType::QueueType;
+
+        std::unique_ptr<QueueType> m_queue = std::make_unique<QueueType>();
+
+        void Produce(size_t _thread_id)
+        {
+            ProducerType _producer(*m_queue, MaxBatchDelay);
+
+            for (size_t _operation_index = 0; _operation_index < lfq::OPERATIONS_PER_THREAD; ++_operation_index)
+            {
+                const Item _item = MakeItem(_thread_id, _operation_index);
+
+                while (false == _producer.Push(_item))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void Consume(size_t, std::atomic<size_t>& _remaining_count, ConsumerStats& _stats)
+        {
+            auto _batch = std::make_unique<ProducerType::BatchType>();
+
+            while (_remaining_count.load(std::memory_order_relaxed) > 0)
+            {
+                if (true == m_queue->Pop(*_batch))
+                {
+                    const std::int64_t _now_ns = NowNs();
+
+                    for (size_t i = 0; i < _batch->_count; ++i)
+                    {
+                        _stats.Record(_batch->_items[i], _now_ns);
+                    }
+
+                    _remaining_count.fetch_sub(_batch->_count, std::memory_order_relaxed);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    };
+
+    double GetPercentileUs(const std::vector<std::int64_t>& _sorted_latencies_ns, double _percentile)
+    {
+        if (true == _sorted_latencies_ns.empty())
+        {
+            return 0.0;
+        }
+
+        const size_t _index = static_cast<size_t>(_percentile * static_cast<double>(_sorted_latencies_ns.size() - 1));
+        return static_cast<double>(_sorted_latencies_ns[_index]) / 1000.0;
+    }
+
+    // 한 번의 벤치마크를 실행하고 처리량, 표본 지연 시간 분포와 체크섬 결과를 반환한다.
+    template <typename ScenarioType>
+    BenchmarkResult RunBenchmarkOnce(size_t _thread_pair_count)
+    {
+        auto _scenario = std::make_unique<ScenarioType>();
+        const size_t _total_operation_count = _thread_pair_count * lfq::OPERATIONS_PER_THREAD;
+
+        std::vector<ConsumerStats> _consumer_stats(_thread_pair_count);
+        std::atomic<size_t> _remaining_count{_total_operation_count};
+
+        std::vector<std::thread> _threads;
+        _threads.reserve(_thread_pair_count * 2);
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        for (size_t _thread_index = 0; _thread_index < _thread_pair_count; ++_thread_index)
+        {
+            _threads.emplace_back([&_scenario, _thread_index]() { _scenario->Produce(_thread_index); });
+            _threads.emplace_back([&_scenario, &_remaining_count, &_consumer_stats, _thread_index]()
+            {
+                _scenario->Consume(lfq::OPERATIONS_PER_THREAD, _remaining_count, _consumer_stats[_thread_index]);
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const auto _end_time = std::chrono::steady_clock::now();
+        const double _duration_sec = std::chrono::duration<double>(_end_time - _start_time).count();
+
+        std::vector<std::int64_t> _latencies_ns;
+        std::uint64_t _checksum = 0;
+
+        for (const auto& _stats : _consumer_stats)
+        {
+            _checksum += _stats._checksum;
+            _latencies_ns.insert(_latencies_ns.end(), _stats._latencies_ns.begin(), _stats._latencies_ns.end());
+        }
+
+        std::sort(_latencies_ns.begin(), _latencies_ns.end());
+
+        const std::uint64_t _total_operation_count64 = static_cast<std::uint64_t>(_total_operation_count);
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(_total_operation_count) / _duration_sec,
+            GetPercentileUs(_latencies_ns, 0.50),
+            GetPercentileUs(_latencies_ns, 0.99),
+            true == _latencies_ns.empty() ? 0.0 : static_cast<double>(_latencies_ns.back()) / 1000.0,
+            _checksum,
+            (_total_operation_count64 * (_total_operation_count64 - 1)) / 2};
+    }
+
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.duration_ms < _right.duration_ms;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        const bool _checksum_valid = _result.checksum == _result.expected_checksum;
+
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << _result.duration_ms << " ms | "
+                  << _result.messages_per_sec << " messages/sec | 지연 p50="
+                  << _result.latency_p50_us << " us, p99="
+                  << _result.latency_p99_us << " us, max="
+                  << _result.latency_max_us << " us | 체크섬 "
+                  << (true == _checksum_valid ? "정상" : "오류") << '\n';
+    }
+
+    // 항목별 Push와 묶음 Push를 번갈아 세 번 측정하고 각각의 중앙값을 출력한다.
+    void RunComparison(size_t _thread_pair_count)
+    {
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _per_item_results;
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _batched_results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            if ((_repeat_index % 2) == 0)
+            {
+                _per_item_results[_repeat_index] = RunBenchmarkOnce<PerItemScenario>(_thread_pair_count);
+                _batched_results[_repeat_index] = RunBenchmarkOnce<BatchedScenario>(_thread_pair_count);
+            }
+            else
+            {
+                _batched_results[_repeat_index] = RunBenchmarkOnce<BatchedScenario>(_thread_pair_count);
+                _per_item_results[_repeat_index] = RunBenchmarkOnce<PerItemScenario>(_thread_pair_count);
+            }
+        }
+
+        std::cout << "\n" << _thread_pair_count << "P / " << _thread_pair_count << "C\n";
+        PrintResult("항목별 Push", GetMedianResult(_per_item_results));
+        PrintResult("묶음 Push", GetMedianResult(_batched_results));
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "항목별 Push vs BatchingProducer 벤치마크\n";
+    std::cout << "큐 용량(항목 기준)=" << lfq::QUEUE_SIZE
+              << " | 묶음 크기=" << BatchSize
+              << " | 최대 지연=" << MaxBatchDelay.count() << " us"
+              << " | 스레드당 작업=" << lfq::OPERATIONS_PER_THREAD
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
+
+    for (const size_t _thread_pair_count : {1, 2, 4})
+    {
+        RunComparison(_thread_pair_count);
+    }
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
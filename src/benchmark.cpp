@@ -7,12 +7,18 @@
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <string>
 #include <thread>
 #include <vector>
+#ifdef _WIN32
 #include <windows.h>
+#endif
 
+#include "flat_combining_queue.h"
 #include "mpmc_queue.h"
 #include "mutex_queue.h"
+#include "perf_counters.h"
+#include "thread_cpu_time.h"
 
 namespace
 {
@@ -25,6 +31,60 @@ namespace
         char padding[lfq::CACHE_LINE_SIZE - sizeof(int) - sizeof(std::atomic<size_t>)];
     };
 
+    // 스레드 하나의 CPU 사용량과 실패한 재시도에 쓴 시간
+    struct ThreadAccounting
+    {
+        lfq::ThreadResourceUsage usage;
+        std::int64_t cpu_ns = 0;     // CLOCK_THREAD_CPUTIME_ID 기준 (getrusage보다 정밀)
+        std::int64_t active_ns = 0;  // 스레드가 작업을 시작해서 끝낼 때까지의 벽시계 시간
+        std::int64_t retry_ns = 0;   // 실패한 Push/Pop부터 다음 성공까지의 벽시계 시간 합
+
+        ThreadAccounting& operator+=(const ThreadAccounting& _other)
+        {
+            usage += _other.usage;
+            cpu_ns += _other.cpu_ns;
+            active_ns += _other.active_ns;
+            retry_ns += _other.retry_ns;
+            return *this;
+        }
+    };
+
+    // 작업 구간의 CPU 사용량을 잰다. 재시도 시간은 실패했을 때만 시각을 읽어 성공 경로에 비용을 더하지 않는다.
+    class ThreadAccountingScope
+    {
+    public:
+        explicit ThreadAccountingScope(ThreadAccounting& _accounting)
+            : m_accounting(_accounting),
+              m_start_usage(lfq::GetThreadResourceUsage()),
+              m_start_cpu_ns(lfq::GetThreadCpuTimeNs()),
+              m_start_time(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~ThreadAccountingScope()
+        {
+            m_accounting.active_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start_time).count();
+            m_accounting.cpu_ns = lfq::GetThreadCpuTimeNs() - m_start_cpu_ns;
+            m_accounting.usage = lfq::GetThreadResourceUsage() - m_start_usage;
+        }
+
+        ThreadAccountingScope(ThreadAccountingScope&&) = delete;
+        ThreadAccountingScope(const ThreadAccountingScope&) = delete;
+        ThreadAccountingScope& operator=(ThreadAccountingScope&&) = delete;
+        ThreadAccountingScope& operator=(const ThreadAccountingScope&) = delete;
+
+        void AddRetryTime(std::chrono::steady_clock::time_point _retry_start)
+        {
+            m_accounting.retry_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _retry_start).count();
+        }
+
+    private:
+        ThreadAccounting& m_accounting;
+        const lfq::ThreadResourceUsage m_start_usage;
+        const std::int64_t m_start_cpu_ns;
+        const std::chrono::steady_clock::time_point m_start_time;
+    };
+
     struct BenchmarkResult
     {
         double duration_ms;
@@ -36,51 +96,82 @@ namespace
         size_t pop_retry_count;
         std::uint64_t checksum;
         std::uint64_t expected_checksum;
+        std::vector<lfq::PerfCounterValues> producer_counters;
+        std::vector<lfq::PerfCounterValues> consumer_counters;
+        std::vector<size_t> consumer_operation_counts;
+        std::vector<ThreadAccounting> producer_accounting;
+        std::vector<ThreadAccounting> consumer_accounting;
     };
 
-    // 정해진 수의 값을 Push하고 큐가 가득 차 발생한 재시도 횟수를 기록한다.
+    // 정해진 수의 값을 Push하고 큐가 가득 차 발생한 재시도 횟수, 스레드의 성능 카운터와 CPU 사용량을 기록한다.
     template <typename QueueType>
-    void ProducerThread(QueueType& _queue, size_t _thread_id, std::atomic<size_t>& _retry_count)
+    void ProducerThread(QueueType& _queue, size_t _thread_id, std::atomic<size_t>& _retry_count, lfq::PerfCounterValues& _counters, ThreadAccounting& _accounting)
     {
         size_t _local_retry_count = 0;
+        lfq::ThreadPerfCounters _perf_counters;
+        _perf_counters.Start();
 
-        for (auto _operation_index = 0; _operation_index < lfq::OPERATIONS_PER_THREAD; ++_operation_index)
         {
-            TestData _data{static_cast<int>(_thread_id * lfq::OPERATIONS_PER_THREAD + _operation_index)};
+            ThreadAccountingScope _accounting_scope(_accounting);
 
-            while (false == _queue.Push(_data))
+            for (size_t _operation_index = 0; _operation_index < lfq::OPERATIONS_PER_THREAD; ++_operation_index)
             {
-                ++_local_retry_count;
-                std::this_thread::yield();
+                TestData _data{static_cast<int>(_thread_id * lfq::OPERATIONS_PER_THREAD + _operation_index), {}};
+
+                if (true == _queue.Push(_data))
+                {
+                    continue;
+                }
+
+                const auto _retry_start = std::chrono::steady_clock::now();
+                do
+                {
+                    ++_local_retry_count;
+                    std::this_thread::yield();
+                } while (false == _queue.Push(_data));
+
+                _accounting_scope.AddRetryTime(_retry_start);
             }
         }
 
+        _counters = _perf_counters.Stop();
         _retry_count.fetch_add(_local_retry_count, std::memory_order_relaxed);
     }
 
-    // 정해진 수의 값을 Pop하고 재시도 횟수와 전달된 값의 체크섬을 기록한다.
+    // 정해진 수의 값을 Pop하고 재시도 횟수, 전달된 값의 체크섬, 스레드의 성능 카운터와 CPU 사용량을 기록한다.
     template <typename QueueType>
-    void ConsumerThread(QueueType& _queue, size_t _operation_count, std::atomic<size_t>& _retry_count, std::atomic<std::uint64_t>& _checksum)
+    void ConsumerThread(QueueType& _queue, size_t _operation_count, std::atomic<size_t>& _retry_count, std::atomic<std::uint64_t>& _checksum, lfq::PerfCounterValues& _counters, ThreadAccounting& _accounting)
     {
         size_t _success_count = 0;
         size_t _local_retry_count = 0;
         std::uint64_t _local_checksum = 0;
         TestData _data;
+        lfq::ThreadPerfCounters _perf_counters;
+        _perf_counters.Start();
 
-        while (_success_count < _operation_count)
         {
-            if (true == _queue.Pop(_data))
+            ThreadAccountingScope _accounting_scope(_accounting);
+
+            while (_success_count < _operation_count)
             {
+                if (false == _queue.Pop(_data))
+                {
+                    const auto _retry_start = std::chrono::steady_clock::now();
+                    do
+                    {
+                        ++_local_retry_count;
+                        std::this_thread::yield();
+                    } while (false == _queue.Pop(_data));
+
+                    _accounting_scope.AddRetryTime(_retry_start);
+                }
+
                 ++_success_count;
                 _local_checksum += static_cast<std::uint64_t>(_data.value);
             }
-            else
-            {
-                ++_local_retry_count;
-                std::this_thread::yield();
-            }
         }
 
+        _counters = _perf_counters.Stop();
         _retry_count.fetch_add(_local_retry_count, std::memory_order_relaxed);
         _checksum.fetch_add(_local_checksum, std::memory_order_relaxed);
     }
@@ -103,11 +194,17 @@ namespace
         _producers.reserve(_producer_count);
         _consumers.reserve(_consumer_count);
 
+        std::vector<lfq::PerfCounterValues> _producer_counters(_producer_count);
+        std::vector<lfq::PerfCounterValues> _consumer_counters(_consumer_count);
+        std::vector<size_t> _consumer_operation_counts(_consumer_count);
+        std::vector<ThreadAccounting> _producer_accounting(_producer_count);
+        std::vector<ThreadAccounting> _consumer_accounting(_consumer_count);
+
         const auto _start_time = std::chrono::steady_clock::now();
 
         for (size_t _producer_index = 0; _producer_index < _producer_count; ++_producer_index)
         {
-            _producers.emplace_back(ProducerThread<QueueType>, std::ref(*_queue), _producer_index, std::ref(_push_retry_count));
+            _producers.emplace_back(ProducerThread<QueueType>, std::ref(*_queue), _producer_index, std::ref(_push_retry_count), std::ref(_producer_counters[_producer_index]), std::ref(_producer_accounting[_producer_index]));
         }
 
         for (size_t _consumer_index = 0; _consumer_index < _consumer_count; ++_consumer_index)
@@ -115,7 +212,8 @@ namespace
             const size_t _operation_count =
                 _base_operation_count + (_consumer_index < _remaining_operation_count ? 1 : 0);
 
-            _consumers.emplace_back(ConsumerThread<QueueType>, std::ref(*_queue), _operation_count, std::ref(_pop_retry_count), std::ref(_checksum));
+            _consumer_operation_counts[_consumer_index] = _operation_count;
+            _consumers.emplace_back(ConsumerThread<QueueType>, std::ref(*_queue), _operation_count, std::ref(_pop_retry_count), std::ref(_checksum), std::ref(_consumer_counters[_consumer_index]), std::ref(_consumer_accounting[_consumer_index]));
         }
 
         for (auto& _producer : _producers)
@@ -145,7 +243,12 @@ namespace
             _push_retry_count.load(std::memory_order_relaxed),
             _pop_retry_count.load(std::memory_order_relaxed),
             _checksum.load(std::memory_order_relaxed),
-            _expected_checksum};
+            _expected_checksum,
+            std::move(_producer_counters),
+            std::move(_consumer_counters),
+            std::move(_consumer_operation_counts),
+            std::move(_producer_accounting),
+            std::move(_consumer_accounting)};
     }
 
     // 세 번의 실행 결과를 시간순으로 정렬해 중앙값에 해당하는 결과를 선택한다.
@@ -159,6 +262,114 @@ namespace
         return _results[BenchmarkRepeatCount / 2];
     }
 
+    // 카운터 값을 메시지 수로 나눠 한 줄로 출력한다. 사용 불가 카운터는 N/A로 표시한다.
+    void PrintPerfCounterRow(const std::string& _label, const lfq::PerfCounterValues& _counters, size_t _message_count)
+    {
+        std::cout << "    " << _label;
+
+        for (size_t i = 0; i < lfq::PERF_COUNTER_COUNT; ++i)
+        {
+            std::cout << " | " << lfq::GetPerfCounterName(i) << '=';
+
+            if (true == _counters._valid[i] && _message_count != 0)
+            {
+                std::cout << std::defaultfloat << std::setprecision(4) << static_cast<double>(_counters._values[i]) / static_cast<double>(_message_count);
+            }
+            else
+            {
+                std::cout << "N/A";
+            }
+        }
+
+        std::cout << '\n';
+    }
+
+    // 생산자/소비자 역할별 합계와 스레드별 카운터를 메시지당 값으로 출력한다.
+    void PrintPerfCounters(const BenchmarkResult& _result)
+    {
+        lfq::PerfCounterValues _producer_total;
+        lfq::PerfCounterValues _consumer_total;
+
+        for (const auto& _counters : _result.producer_counters)
+        {
+            _producer_total += _counters;
+        }
+        for (const auto& _counters : _result.consumer_counters)
+        {
+            _consumer_total += _counters;
+        }
+
+        if (false == _producer_total.HasAnyValid() && false == _consumer_total.HasAnyValid())
+        {
+            std::cout << "  성능 카운터: 사용 불가 (perf_event_open 미지원 또는 권한 없음)\n";
+            return;
+        }
+
+        std::cout << "  성능 카운터 (메시지당):\n";
+        PrintPerfCounterRow("생산자 전체", _producer_total, _result.message_count);
+
+        for (size_t i = 0; i < _result.producer_counters.size(); ++i)
+        {
+            PrintPerfCounterRow("생산자 #" + std::to_string(i), _result.producer_counters[i], lfq::OPERATIONS_PER_THREAD);
+        }
+
+        PrintPerfCounterRow("소비자 전체", _consumer_total, _result.message_count);
+
+        for (size_t i = 0; i < _result.consumer_counters.size(); ++i)
+        {
+            PrintPerfCounterRow("소비자 #" + std::to_string(i), _result.consumer_counters[i], _result.consumer_operation_counts[i]);
+        }
+
+        std::cout << std::fixed << std::setprecision(2);
+    }
+
+    ThreadAccounting SumAccounting(const std::vector<ThreadAccounting>& _accounting)
+    {
+        ThreadAccounting _total;
+        for (const ThreadAccounting& _thread_accounting : _accounting)
+        {
+            _total += _thread_accounting;
+        }
+
+        return _total;
+    }
+
+    // 모든 생산자/소비자 스레드의 CPU 시간 1초당 전달한 메시지 수
+    double GetMessagesPerCpuSec(const BenchmarkResult& _result)
+    {
+        const std::int64_t _cpu_ns = SumAccounting(_result.producer_accounting).cpu_ns + SumAccounting(_result.consumer_accounting).cpu_ns;
+        return _cpu_ns <= 0 ? 0.0 : static_cast<double>(_result.message_count) * 1e9 / static_cast<double>(_cpu_ns);
+    }
+
+    void PrintAccountingRow(const char* _label, const ThreadAccounting& _accounting)
+    {
+        const double _retry_percent = _accounting.active_ns <= 0 ? 0.0 : static_cast<double>(_accounting.retry_ns) * 100.0 / static_cast<double>(_accounting.active_ns);
+
+        std::cout << "    " << _label << ": CPU " << static_cast<double>(_accounting.cpu_ns) / 1e6
+                  << " ms (사용자 " << static_cast<double>(_accounting.usage._user_ns) / 1e6
+                  << " ms, 시스템 " << static_cast<double>(_accounting.usage._system_ns) / 1e6
+                  << " ms) | 재시도 시간 " << _retry_percent << "% | 컨텍스트 스위치 ";
+
+        if (true == _accounting.usage._has_switch_counts)
+        {
+            std::cout << "자발 " << _accounting.usage._voluntary_switch_count
+                      << ", 비자발 " << _accounting.usage._involuntary_switch_count << '\n';
+        }
+        else
+        {
+            std::cout << "N/A\n";
+        }
+    }
+
+    // 처리량을 CPU를 태워 얻었는지 보기 위해 역할별 CPU 시간, 실패한 재시도에 쓴 시간 비율과 컨텍스트 스위치를 출력한다.
+    // 재시도 시간 비율은 스레드가 작업한 벽시계 시간 중 실패한 Push/Pop부터 다음 성공까지 걸린 시간이다.
+    void PrintCpuAccounting(const BenchmarkResult& _result)
+    {
+        std::cout << "  CPU 효율: " << GetMessagesPerCpuSec(_result) << " messages/CPU-sec\n";
+        PrintAccountingRow("생산자 전체", SumAccounting(_result.producer_accounting));
+        PrintAccountingRow("소비자 전체", SumAccounting(_result.consumer_accounting));
+    }
+
     // 선택된 중앙값 결과를 사람이 확인하기 쉬운 형식으로 출력한다.
     void PrintResult(const char* _queue_name, const BenchmarkResult& _result)
     {
@@ -174,14 +385,29 @@ namespace
         std::cout << "  Pop 재시도: " << _result.pop_retry_count << '\n';
         std::cout << "  체크섬: " << _result.checksum << " / " << _result.expected_checksum
                   << " (" << (true == _checksum_valid ? "정상" : "오류") << ")\n";
+        PrintCpuAccounting(_result);
+        PrintPerfCounters(_result);
     }
 
-    // 두 큐의 실행 순서를 번갈아 가며 세 번 측정하고 각각의 중앙값을 출력한다.
-    template <typename LockFreeQueueType, typename TwoLockQueueType>
-    void RunComparison(const char* _case_name, size_t _producer_count, size_t _consumer_count)
+    // 스레드 수에 따른 교차점을 보기 위한 경우별 중앙값 처리량 (messages/sec, messages/CPU-sec)
+    struct ComparisonSummary
+    {
+        const char* case_name;
+        double lock_free_messages_per_sec;
+        double two_lock_messages_per_sec;
+        double flat_combining_messages_per_sec;
+        double lock_free_messages_per_cpu_sec;
+        double two_lock_messages_per_cpu_sec;
+        double flat_combining_messages_per_cpu_sec;
+    };
+
+    // 세 큐의 실행 순서를 번갈아 가며 세 번 측정하고 각각의 중앙값을 출력한다.
+    template <typename LockFreeQueueType, typename TwoLockQueueType, typename FlatCombiningQueueType>
+    ComparisonSummary RunComparison(const char* _case_name, size_t _producer_count, size_t _consumer_count)
     {
         std::array<BenchmarkResult, BenchmarkRepeatCount> _lock_free_results;
         std::array<BenchmarkResult, BenchmarkRepeatCount> _two_lock_results;
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _flat_combining_results;
 
         std::cout << "\n============================================================\n";
         std::cout << _case_name << '\n';
@@ -191,44 +417,123 @@ namespace
         {
             std::cout << "\n[" << _repeat_index + 1 << '/' << BenchmarkRepeatCount << "] ";
 
-            if ((_repeat_index % 2) == 0)
+            switch (_repeat_index % 3)
             {
-                std::cout << "Lock-Free → Two-Lock 순서로 측정\n";
+            case 0:
+                std::cout << "Lock-Free → Two-Lock → Flat-Combining 순서로 측정\n";
                 _lock_free_results[_repeat_index] = RunBenchmarkOnce<LockFreeQueueType>(_producer_count, _consumer_count);
                 _two_lock_results[_repeat_index] = RunBenchmarkOnce<TwoLockQueueType>(_producer_count, _consumer_count);
-            }
-            else
-            {
-                std::cout << "Two-Lock → Lock-Free 순서로 측정\n";
+                _flat_combining_results[_repeat_index] = RunBenchmarkOnce<FlatCombiningQueueType>(_producer_count, _consumer_count);
+                break;
+            case 1:
+                std::cout << "Two-Lock → Flat-Combining → Lock-Free 순서로 측정\n";
                 _two_lock_results[_repeat_index] = RunBenchmarkOnce<TwoLockQueueType>(_producer_count, _consumer_count);
+                _flat_combining_results[_repeat_index] = RunBenchmarkOnce<FlatCombiningQueueType>(_producer_count, _consumer_count);
                 _lock_free_results[_repeat_index] = RunBenchmarkOnce<LockFreeQueueType>(_producer_count, _consumer_count);
+                break;
+            default:
+                std::cout << "Flat-Combining → Lock-Free → Two-Lock 순서로 측정\n";
+                _flat_combining_results[_repeat_index] = RunBenchmarkOnce<FlatCombiningQueueType>(_producer_count, _consumer_count);
+                _lock_free_results[_repeat_index] = RunBenchmarkOnce<LockFreeQueueType>(_producer_count, _consumer_count);
+                _two_lock_results[_repeat_index] = RunBenchmarkOnce<TwoLockQueueType>(_producer_count, _consumer_count);
+                break;
             }
 
             std::cout << "  Lock-Free: " << std::fixed << std::setprecision(2)
                       << _lock_free_results[_repeat_index].duration_ms << " ms"
-                      << " | Two-Lock: " << _two_lock_results[_repeat_index].duration_ms << " ms\n";
+                      << " | Two-Lock: " << _two_lock_results[_repeat_index].duration_ms << " ms"
+                      << " | Flat-Combining: " << _flat_combining_results[_repeat_index].duration_ms << " ms\n";
         }
 
-        PrintResult("Lock-Free MPMC Queue", GetMedianResult(_lock_free_results));
-        PrintResult("Two-Lock Queue", GetMedianResult(_two_lock_results));
+        const BenchmarkResult _lock_free_median = GetMedianResult(_lock_free_results);
+        const BenchmarkResult _two_lock_median = GetMedianResult(_two_lock_results);
+        const BenchmarkResult _flat_combining_median = GetMedianResult(_flat_combining_results);
+
+        PrintResult("Lock-Free MPMC Queue", _lock_free_median);
+        PrintResult("Two-Lock Queue", _two_lock_median);
+        PrintResult("Flat-Combining Queue", _flat_combining_median);
+
+        return ComparisonSummary{
+            _case_name,
+            _lock_free_median.messages_per_sec,
+            _two_lock_median.messages_per_sec,
+            _flat_combining_median.messages_per_sec,
+            GetMessagesPerCpuSec(_lock_free_median),
+            GetMessagesPerCpuSec(_two_lock_median),
+            GetMessagesPerCpuSec(_flat_combining_median)};
+    }
+
+    // 경우별 중앙값 값 하나(처리량 또는 CPU 효율)를 한 표로 모아 스레드 수에 따라 가장 좋은 큐가 바뀌는 지점을 보여 준다.
+    void PrintSummaryTable(const char* _title, const std::vector<ComparisonSummary>& _summaries,
+                           double ComparisonSummary::*_lock_free, double ComparisonSummary::*_two_lock, double ComparisonSummary::*_flat_combining)
+    {
+        std::cout << "\n============================================================\n";
+        std::cout << _title << '\n';
+        std::cout << std::fixed << std::setprecision(0);
+
+        for (const ComparisonSummary& _summary : _summaries)
+        {
+            const char* _fastest_name = "Lock-Free";
+            double _fastest = _summary.*_lock_free;
+
+            if (_summary.*_two_lock > _fastest)
+            {
+                _fastest_name = "Two-Lock";
+                _fastest = _summary.*_two_lock;
+            }
+
+            if (_summary.*_flat_combining > _fastest)
+            {
+                _fastest_name = "Flat-Combining";
+            }
+
+            std::cout << "  " << std::setw(10) << std::left << _summary.case_name << std::right
+                      << " | Lock-Free " << std::setw(12) << _summary.*_lock_free
+                      << " | Two-Lock " << std::setw(12) << _summary.*_two_lock
+                      << " | Flat-Combining " << std::setw(12) << _summary.*_flat_combining
+                      << " | 최고: " << _fastest_name << '\n';
+        }
+
+        std::cout << std::setprecision(2);
+    }
+
+    // 벽시계 처리량과 CPU 시간당 처리량을 나란히 보여 준다.
+    // 공유 호스트에서는 재시도 루프로 코어를 더 태워 얻은 처리량이 두 번째 표에서 드러난다.
+    void PrintSummary(const std::vector<ComparisonSummary>& _summaries)
+    {
+        PrintSummaryTable("처리량 요약 (중앙값, messages/sec)", _summaries,
+                          &ComparisonSummary::lock_free_messages_per_sec,
+                          &ComparisonSummary::two_lock_messages_per_sec,
+                          &ComparisonSummary::flat_combining_messages_per_sec);
+        PrintSummaryTable("CPU 효율 요약 (중앙값, messages/CPU-sec)", _summaries,
+                          &ComparisonSummary::lock_free_messages_per_cpu_sec,
+                          &ComparisonSummary::two_lock_messages_per_cpu_sec,
+                          &ComparisonSummary::flat_combining_messages_per_cpu_sec);
     }
 }
 
 int main()
 {
+#ifdef _WIN32
     SetConsoleOutputCP(CP_UTF8);
+#endif
 
     using LockFreeQueue = MPMCQueue<TestData, lfq::QUEUE_SIZE>;
     using TwoLockQueue = MutexQueue<TestData, lfq::QUEUE_SIZE>;
+    using CombiningQueue = FlatCombiningQueue<TestData, lfq::QUEUE_SIZE>;
 
-    std::cout << "Lock-Free Queue vs Two-Lock Queue 성능 벤치마크\n";
+    std::cout << "Lock-Free Queue vs Two-Lock Queue vs Flat-Combining Queue 성능 벤치마크\n";
     std::cout << "큐 크기=" << lfq::QUEUE_SIZE
               << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
 
-    RunComparison<LockFreeQueue, TwoLockQueue>("1P / 1C", 1, 1);
-    RunComparison<LockFreeQueue, TwoLockQueue>("2P / 2C", 2, 2);
-    RunComparison<LockFreeQueue, TwoLockQueue>("4P / 4C", 4, 4);
-    RunComparison<LockFreeQueue, TwoLockQueue>("6P / 6C", 6, 6);
+    std::vector<ComparisonSummary> _summaries;
+    _summaries.push_back(RunComparison<LockFreeQueue, TwoLockQueue, CombiningQueue>("1P / 1C", 1, 1));
+    _summaries.push_back(RunComparison<LockFreeQueue, TwoLockQueue, CombiningQueue>("2P / 2C", 2, 2));
+    _summaries.push_back(RunComparison<LockFreeQueue, TwoLockQueue, CombiningQueue>("4P / 4C", 4, 4));
+    _summaries.push_back(RunComparison<LockFreeQueue, TwoLockQueue, CombiningQueue>("6P / 6C", 6, 6));
+    _summaries.push_back(RunComparison<LockFreeQueue, TwoLockQueue, CombiningQueue>("8P / 8C", 8, 8));
+    _summaries.push_back(RunComparison<LockFreeQueue, TwoLockQueue, CombiningQueue>("16P / 16C", 16, 16));
+    PrintSummary(_summaries);
 
     std::cout << "\n모든 벤치마크 완료\n";
     return 0;
@@ -0,0 +1,305 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "channel.h"
+#include "mpmc_queue.h"
+#include "thread_cpu_time.h"
+
+namespace
+{
+    constexpr size_t ChannelCount = 3;
+    constexpr size_t ChannelQueueSize = 1024;
+
+    // 드문드문 보내는 경우: 수신 스레드가 대부분의 시간을 기다리며 보낸다.
+    constexpr size_t SparseMessagesPerChannel = 5'000;
+    constexpr auto SparseSendInterval = std::chrono::microseconds(200);
+
+    // 쉬지 않고 보내는 경우
+    constexpr size_t BurstMessagesPerChannel = 1'000'000;
+
+    using QueueType = MPMCQueue<std::int64_t, ChannelQueueSize>;
+    using SenderType = Sender<std::int64_t, ChannelQueueSize>;
+    using ReceiverType = Receiver<std::int64_t, ChannelQueueSize>;
+
+    std::int64_t NowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double messages_per_sec;
+        double consumer_cpu_ms;
+        double latency_p50_us;
+        double latency_p99_us;
+        bool valid;
+    };
+
+    // 수신 스레드 한 명의 관찰 결과
+    struct ConsumerStats
+    {
+        size_t _received_count = 0;
+        std::int64_t _checksum = 0;
+        std::int64_t _cpu_time_ns = 0;
+        std::vector<std::int64_t> _latencies_ns;
+    };
+
+    // 비교 대상: MPMCQueue 여러 개를 번갈아 Pop하고, 모두 비어 있으면 yield
+    struct PollingScenario
+    {
+        std::array<std::unique_ptr<QueueType>, ChannelCount> m_queues;
+        std::atomic<size_t> m_finished_producer_count{0};
+
+        PollingScenario()
+        {
+            for (auto& _queue : m_queues)
+            {
+                _queue = std::make_unique<QueueType>();
+            }
+        }
+
+        template <typename ValueFunction>
+        void Produce(size_t _channel_index, size_t _message_count, std::chrono::microseconds _interval, ValueFunction&& _make_value)
+        {
+            for (size_t _message_index = 0; _message_index < _message_count; ++_message_index)
+            {
+                if (_interval.count() != 0)
+                {
+                    std::this_thread::sleep_for(_interval);
+                }
+
+                while (false == m_queues[_channel_index]->Push(_make_value(_message_index)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            m_finished_producer_count.fetch_add(1, std::memory_order_release);
+        }
+
+        template <typename Handler>
+        void Consume(Handler&& _handler)
+        {
+            std::int64_t _value = 0;
+            size_t _start = 0;
+
+            while (true)
+            {
+                bool _received = false;
+
+                for (size_t _offset = 0; _offset < ChannelCount; ++_offset)
+                {
+                    if (true == m_queues[(_start + _offset) % ChannelCount]->Pop(_value))
+                    {
+                        _handler(_value);
+                        _received = true;
+                        break;
+                    }
+                }
+
+                ++_start;
+
+                if (true == _received)
+                {
+                    continue;
+                }
+
+                // 닫힘 감지: 모든 생산자가 끝난 뒤 모든 큐가 비어 있으면 종료
+                if (m_finished_producer_count.load(std::memory_order_acquire) == ChannelCount &&
+                    std::all_of(m_queues.begin(), m_queues.end(), [](const auto& _queue) { return _queue->IsEmpty(); }))
+                {
+                    return;
+                }
+
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    // Channel: Select 하나로 세 채널을 기다리고, 모두 비어 있으면 잠든다.
+    struct SelectScenario
+    {
+        std::vector<SenderType> m_senders;
+        std::vector<ReceiverType> m_receivers;
+
+        SelectScenario()
+        {
+            for (size_t _channel_index = 0; _channel_index < ChannelCount; ++_channel_index)
+            {
+                auto _channel = MakeChannel<std::int64_t, ChannelQueueSize>();
+                m_senders.push_back(std::move(_channel.first));
+                m_receivers.push_back(std::move(_channel.second));
+            }
+        }
+
+        template <typename ValueFunction>
+        void Produce(size_t _channel_index, size_t _message_count, std::chrono::microseconds _interval, ValueFunction&& _make_value)
+        {
+            SenderType _sender = std::move(m_senders[_channel_index]);
+
+            for (size_t _message_index = 0; _message_index < _message_count; ++_message_index)
+            {
+                if (_interval.count() != 0)
+                {
+                    std::this_thread::sleep_for(_interval);
+                }
+
+                _sender.Send(_make_value(_message_index));
+            }
+        }
+
+        template <typename Handler>
+        void Consume(Handler&& _handler)
+        {
+            auto _on_receive = [&_handler](std::int64_t _value) { _handler(_value); };
+
+            while (Select(
+                       OnReceive(m_receivers[0], _on_receive),
+                       OnReceive(m_receivers[1], _on_receive),
+                       OnReceive(m_receivers[2], _on_receive)) != lfq::SELECT_CLOSED)
+            {
+            }
+        }
+    };
+
+    double GetPercentileUs(const std::vector<std::int64_t>& _sorted_latencies_ns, double _percentile)
+    {
+        if (true == _sorted_latencies_ns.empty())
+        {
+            return 0.0;
+        }
+
+        const size_t _index = static_cast<size_t>(_percentile * static_cast<double>(_sorted_latencies_ns.size() - 1));
+        return static_cast<double>(_sorted_latencies_ns[_index]) / 1000.0;
+    }
+
+    // 생산자 ChannelCount명이 각자 채널 하나에 보내고, 수신 스레드 하나가 모두 받는다.
+    // _interval이 0이 아니면 보낼 때마다 쉬고, 항목에 보낸 시각을 담아 지연 시간을 잰다.
+    template <typename ScenarioType>
+    BenchmarkResult RunBenchmarkOnce(size_t _messages_per_channel, std::chrono::microseconds _interval)
+    {
+        auto _scenario = std::make_unique<ScenarioType>();
+        const bool _measure_latency = _interval.count() != 0;
+        const size_t _total_message_count = _messages_per_channel * ChannelCount;
+        ConsumerStats _stats;
+
+        if (true == _measure_latency)
+        {
+            _stats._latencies_ns.reserve(_total_message_count);
+        }
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::thread _consumer([&_scenario, &_stats, _measure_latency]()
+        {
+            const std::int64_t _cpu_start_ns = lfq::GetThreadCpuTimeNs();
+
+            _scenario->Consume([&_stats, _measure_latency](std::int64_t _value)
+            {
+                ++_stats._received_count;
+
+                if (true == _measure_latency)
+                {
+                    _stats._latencies_ns.push_back(NowNs() - _value);
+                }
+                else
+                {
+                    _stats._checksum += _value;
+                }
+            });
+
+            _stats._cpu_time_ns = lfq::GetThreadCpuTimeNs() - _cpu_start_ns;
+        });
+
+        std::vector<std::thread> _producers;
+        for (size_t _channel_index = 0; _channel_index < ChannelCount; ++_channel_index)
+        {
+            _producers.emplace_back([&_scenario, _channel_index, _messages_per_channel, _interval, _measure_latency]()
+            {
+                _scenario->Produce(_channel_index, _messages_per_channel, _interval, [_measure_latency](size_t _message_index)
+                {
+                    return true == _measure_latency ? NowNs() : static_cast<std::int64_t>(_message_index);
+                });
+            });
+        }
+
+        for (auto& _producer : _producers)
+        {
+            _producer.join();
+        }
+
+        _consumer.join();
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+        const std::int64_t _per_channel64 = static_cast<std::int64_t>(_messages_per_channel);
+
+        std::sort(_stats._latencies_ns.begin(), _stats._latencies_ns.end());
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(_total_message_count) / _duration_sec,
+            static_cast<double>(_stats._cpu_time_ns) / 1'000'000.0,
+            GetPercentileUs(_stats._latencies_ns, 0.50),
+            GetPercentileUs(_stats._latencies_ns, 0.99),
+            _stats._received_count == _total_message_count &&
+                (true == _measure_latency || _stats._checksum == static_cast<std::int64_t>(ChannelCount) * (_per_channel64 * (_per_channel64 - 1)) / 2)};
+    }
+
+    void PrintSparseResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << "지연 p50=" << _result.latency_p50_us
+                  << " us, p99=" << _result.latency_p99_us
+                  << " us | 수신 스레드 CPU=" << _result.consumer_cpu_ms
+                  << " ms (" << _result.consumer_cpu_ms * 100.0 / _result.duration_ms
+                  << "% of " << _result.duration_ms << " ms) | 수신 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+
+    void PrintBurstResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << _result.duration_ms << " ms | "
+                  << _result.messages_per_sec << " messages/sec | 수신 스레드 CPU="
+                  << _result.consumer_cpu_ms << " ms | 체크섬 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "Select vs MPMCQueue 번갈아 폴링 벤치마크\n";
+    std::cout << "채널=" << ChannelCount
+              << " | 채널 큐 크기=" << ChannelQueueSize << '\n';
+
+    std::cout << "\n드문 전송: 채널당 " << SparseMessagesPerChannel
+              << "개, " << SparseSendInterval.count() << " us 간격\n";
+    PrintSparseResult("폴링(yield)", RunBenchmarkOnce<PollingScenario>(SparseMessagesPerChannel, SparseSendInterval));
+    PrintSparseResult("Select", RunBenchmarkOnce<SelectScenario>(SparseMessagesPerChannel, SparseSendInterval));
+
+    std::cout << "\n연속 전송: 채널당 " << BurstMessagesPerChannel << "개\n";
+    PrintBurstResult("폴링(yield)", RunBenchmarkOnce<PollingScenario>(BurstMessagesPerChannel, std::chrono::microseconds(0)));
+    PrintBurstResult("Select", RunBenchmarkOnce<SelectScenario>(BurstMessagesPerChannel, std::chrono::microseconds(0)));
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
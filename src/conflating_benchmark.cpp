@@ -0,0 +1,260 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "conflating_queue.h"
+#include "mpmc_queue.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr size_t KeyCount = 1024;
+    constexpr size_t ProducerCount = 4;
+    constexpr auto RunDuration = std::chrono::milliseconds(500);
+
+    // 소비자가 갱신 하나를 처리하는 데 쓰는 가짜 작업량 (생산 속도보다 느리게 만든다)
+    constexpr size_t ConsumerWorkIterations = 400;
+
+    struct Quote
+    {
+        std::int64_t _timestamp_ns;
+        std::uint64_t _sequence;
+        double _price;
+    };
+
+    struct Update
+    {
+        std::uint32_t _key;
+        Quote _quote;
+    };
+
+    std::int64_t GetNowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    std::uint64_t DoConsumerWork(const Quote& _quote)
+    {
+        std::uint64_t _hash = _quote._sequence;
+        for (size_t i = 0; i < ConsumerWorkIterations; ++i)
+        {
+            _hash = _hash * 6364136223846793005ull + 1442695040888963407ull;
+        }
+
+        return _hash;
+    }
+
+    // 모든 갱신을 그대로 넣는 비교 대상: 가득 차면 생산자가 기다린다
+    struct QueueFeed
+    {
+        MPMCQueue<Update, lfq::QUEUE_SIZE> _queue;
+
+        // 종료 신호를 받으면 넣지 못한 갱신은 버린다
+        void Publish(std::uint32_t _key, const Quote& _quote, const std::atomic<bool>& _running)
+        {
+            while (false == _queue.Push(Update{_key, _quote}) && true == _running.load(std::memory_order_relaxed))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        bool Consume(size_t& _key, Quote& _quote)
+        {
+            Update _update{};
+            if (false == _queue.Pop(_update))
+            {
+                return false;
+            }
+
+            _key = _update._key;
+            _quote = _update._quote;
+            return true;
+        }
+
+        size_t GetBacklog() const { return _queue.GetSize(); }
+    };
+
+    struct ConflatingFeed
+    {
+        ConflatingQueue<Quote, KeyCount> _queue;
+
+        void Publish(std::uint32_t _key, const Quote& _quote, const std::atomic<bool>&) { _queue.Update(_key, _quote); }
+        bool Consume(size_t& _key, Quote& _quote) { return _queue.Pop(_key, _quote); }
+        size_t GetBacklog() const { return _queue.GetPendingCount(); }
+    };
+
+    struct BenchmarkResult
+    {
+        double updates_per_sec;
+        double consumed_per_sec;
+        double staleness_p50_us;
+        double staleness_p99_us;
+        double staleness_max_us;
+        size_t backlog;
+        bool valid;
+    };
+
+    // 생산자는 정해진 시간 동안 키를 돌아가며 시세를 갱신하고, 소비자 하나가 꺼낸 값마다 작업을 한다.
+    // 지연(staleness)은 소비자가 값을 꺼낸 시각과 그 값이 만들어진 시각의 차이다.
+    template <typename FeedType>
+    BenchmarkResult RunBenchmarkOnce()
+    {
+        auto _feed = std::make_unique<FeedType>();
+        std::atomic<bool> _running{true};
+        std::atomic<std::uint64_t> _update_count{0};
+
+        std::vector<std::int64_t> _staleness_ns;
+        _staleness_ns.reserve(4'000'000);
+
+        bool _monotonic = true;
+        std::uint64_t _sink = 0;
+
+        std::vector<std::thread> _threads;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        for (size_t _producer = 0; _producer < ProducerCount; ++_producer)
+        {
+            _threads.emplace_back([&_feed, &_running, &_update_count, _producer]()
+            {
+                std::uint64_t _sequence = 0;
+
+                // 생산자마다 키 범위를 나눠 가져 키별 sequence가 단조 증가하게 한다
+                constexpr size_t KeysPerProducer = KeyCount / ProducerCount;
+                const std::uint32_t _first_key = static_cast<std::uint32_t>(_producer * KeysPerProducer);
+
+                while (true == _running.load(std::memory_order_relaxed))
+                {
+                    const std::uint32_t _key = _first_key + static_cast<std::uint32_t>(_sequence % KeysPerProducer);
+                    _feed->Publish(_key, Quote{GetNowNs(), _sequence, 100.0 + static_cast<double>(_sequence % 100) * 0.01}, _running);
+                    ++_sequence;
+                }
+
+                _update_count.fetch_add(_sequence, std::memory_order_relaxed);
+            });
+        }
+
+        _threads.emplace_back([&]()
+        {
+            std::array<std::uint64_t, KeyCount> _last_sequences{};
+            size_t _key = 0;
+            Quote _quote{};
+
+            while (true == _running.load(std::memory_order_relaxed))
+            {
+                if (false == _feed->Consume(_key, _quote))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                _staleness_ns.push_back(GetNowNs() - _quote._timestamp_ns);
+                _monotonic = _monotonic && _quote._sequence >= _last_sequences[_key];
+                _last_sequences[_key] = _quote._sequence;
+                _sink += DoConsumerWork(_quote);
+            }
+        });
+
+        std::this_thread::sleep_for(RunDuration);
+        _running.store(false);
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        std::sort(_staleness_ns.begin(), _staleness_ns.end());
+        const auto _percentile_us = [&_staleness_ns](double _fraction)
+        {
+            if (true == _staleness_ns.empty())
+            {
+                return 0.0;
+            }
+
+            const size_t _index = std::min(_staleness_ns.size() - 1, static_cast<size_t>(_fraction * static_cast<double>(_staleness_ns.size())));
+            return static_cast<double>(_staleness_ns[_index]) / 1000.0;
+        };
+
+        return BenchmarkResult{
+            static_cast<double>(_update_count.load()) / _duration_sec,
+            static_cast<double>(_staleness_ns.size()) / _duration_sec,
+            _percentile_us(0.5),
+            _percentile_us(0.99),
+            _percentile_us(1.0),
+            _feed->GetBacklog(),
+            true == _monotonic && _sink != 1};
+    }
+
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.staleness_p50_us < _right.staleness_p50_us;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(14) << _result.updates_per_sec << " updates/sec | 소비 "
+                  << std::setw(12) << _result.consumed_per_sec << " /sec | 지연 p50 "
+                  << _result.staleness_p50_us << " us, p99 "
+                  << _result.staleness_p99_us << " us, 최대 "
+                  << _result.staleness_max_us << " us | 남은 항목 "
+                  << _result.backlog << " | 검증 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "시세 갱신: ConflatingQueue vs MPMCQueue 벤치마크\n";
+    std::cout << "키=" << KeyCount
+              << " | 생산자=" << ProducerCount
+              << " | 느린 소비자=1 | 실행 시간=" << RunDuration.count() << " ms"
+              << " | MPMCQueue 크기=" << lfq::QUEUE_SIZE
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n\n";
+
+    std::array<BenchmarkResult, BenchmarkRepeatCount> _queue_results;
+    std::array<BenchmarkResult, BenchmarkRepeatCount> _conflating_results;
+
+    for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+    {
+        // 측정 순서에 따른 편향을 줄이기 위해 반복마다 순서를 바꾼다
+        if (_repeat_index % 2 == 0)
+        {
+            _queue_results[_repeat_index] = RunBenchmarkOnce<QueueFeed>();
+            _conflating_results[_repeat_index] = RunBenchmarkOnce<ConflatingFeed>();
+        }
+        else
+        {
+            _conflating_results[_repeat_index] = RunBenchmarkOnce<ConflatingFeed>();
+            _queue_results[_repeat_index] = RunBenchmarkOnce<QueueFeed>();
+        }
+    }
+
+    PrintResult("MPMCQueue (모든 갱신)", GetMedianResult(_queue_results));
+    PrintResult("ConflatingQueue      ", GetMedianResult(_conflating_results));
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
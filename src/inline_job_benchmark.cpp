@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "inline_job.h"
+#include "mpmc_queue.h"
+
+namespace
+{
+    // 측정 구간의 힙 할당 수 (전역 operator new 교체로 센다)
+    std::atomic<std::uint64_t> g_allocation_count{0};
+}
+
+void* operator new(std::size_t _size)
+{
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* _pointer = std::malloc(_size == 0 ? 1 : _size))
+    {
+        return _pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* _pointer) noexcept
+{
+    std::free(_pointer);
+}
+
+void operator delete(void* _pointer, std::size_t) noexcept
+{
+    std::free(_pointer);
+}
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr std::uint64_t JobsPerCase = 2'000'000;
+    constexpr size_t JobQueueSize = 4096;
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double jobs_per_sec;
+        double allocations_per_job;
+        bool valid;
+    };
+
+    // 캡처 크기별 작업: 결과 합계 포인터 + CaptureWords개의 값
+    template <size_t CaptureWords>
+    struct JobFactory
+    {
+        static auto Make(std::atomic<std::uint64_t>* _sum, std::uint64_t _value)
+        {
+            std::array<std::uint64_t, CaptureWords> _values{};
+            _values[0] = _value;
+
+            return [_sum, _values]()
+            {
+                std::uint64_t _total = 0;
+                for (const std::uint64_t _word : _values)
+                {
+                    _total += _word;
+                }
+
+                _sum->fetch_add(_total, std::memory_order_relaxed);
+            };
+        }
+    };
+
+    template <typename JobType, size_t CaptureWords>
+    BenchmarkResult RunBenchmarkOnce(size_t _thread_pair_count)
+    {
+        auto _queue = std::make_unique<MPMCQueue<JobType, JobQueueSize>>();
+        std::atomic<std::uint64_t> _remaining_count{JobsPerCase};
+        std::atomic<std::uint64_t> _sum{0};
+
+        const std::uint64_t _jobs_per_producer = JobsPerCase / _thread_pair_count;
+        std::vector<std::thread> _threads;
+
+        const std::uint64_t _allocations_before = g_allocation_count.load();
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        for (size_t _thread_index = 0; _thread_index < _thread_pair_count; ++_thread_index)
+        {
+            _threads.emplace_back([&_queue, &_sum, _thread_index, _jobs_per_producer]()
+            {
+                const std::uint64_t _first_value = _thread_index * _jobs_per_producer;
+
+                for (std::uint64_t _value = _first_value; _value < _first_value + _jobs_per_producer; ++_value)
+                {
+                    JobType _job(JobFactory<CaptureWords>::Make(&_sum, _value));
+
+                    while (false == _queue->Push(std::move(_job)))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+            _threads.emplace_back([&_queue, &_remaining_count]()
+            {
+                JobType _job;
+
+                while (_remaining_count.load(std::memory_order_relaxed) != 0)
+                {
+                    if (true == _queue->Pop(_job))
+                    {
+                        _job();
+                        _remaining_count.fetch_sub(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        // 스레드 생성에 쓰인 할당은 작업 수에 비해 무시할 만큼 작다
+        const std::uint64_t _allocation_count = g_allocation_count.load() - _allocations_before;
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(JobsPerCase) / _duration_sec,
+            static_cast<double>(_allocation_count) / static_cast<double>(JobsPerCase),
+            _sum.load() == JobsPerCase * (JobsPerCase - 1) / 2};
+    }
+
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.duration_ms < _right.duration_ms;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(9) << _result.duration_ms << " ms | "
+                  << std::setw(12) << _result.jobs_per_sec << " jobs/sec | 할당 "
+                  << _result.allocations_per_job << " /job | 검증 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+
+    // 같은 캡처를 std::function과 InlineJob에 담아 번갈아 세 번 측정하고 중앙값을 출력한다.
+    template <size_t CaptureWords>
+    void RunComparison(size_t _thread_pair_count)
+    {
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _function_results;
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _inline_results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            if (_repeat_index % 2 == 0)
+            {
+                _function_results[_repeat_index] = RunBenchmarkOnce<std::function<void()>, CaptureWords>(_thread_pair_count);
+                _inline_results[_repeat_index] = RunBenchmarkOnce<InlineJob<>, CaptureWords>(_thread_pair_count);
+            }
+            else
+            {
+                _inline_results[_repeat_index] = RunBenchmarkOnce<InlineJob<>, CaptureWords>(_thread_pair_count);
+                _function_results[_repeat_index] = RunBenchmarkOnce<std::function<void()>, CaptureWords>(_thread_pair_count);
+            }
+        }
+
+        const size_t _capture_bytes = sizeof(JobFactory<CaptureWords>::Make(nullptr, 0));
+        std::cout << "\n캡처 " << _capture_bytes << "바이트, " << _thread_pair_count << "P / " << _thread_pair_count << "C\n";
+        PrintResult("std::function<void()>", GetMedianResult(_function_results));
+        PrintResult("InlineJob<>          ", GetMedianResult(_inline_results));
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "작업 큐: InlineJob vs std::function 벤치마크\n";
+    std::cout << "큐 크기=" << JobQueueSize
+              << " | 경우별 작업=" << JobsPerCase
+              << " | InlineJob 저장 공간=" << lfq::INLINE_JOB_CAPACITY << "바이트"
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
+
+    for (const size_t _thread_pair_count : {1, 4})
+    {
+        // 포인터 + 값 1개(16바이트): libstdc++ std::function도 내부 버퍼에 담는 크기
+        RunComparison<1>(_thread_pair_count);
+        RunComparison<3>(_thread_pair_count);
+        RunComparison<5>(_thread_pair_count);
+    }
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
@@ -0,0 +1,241 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "intrusive_mpsc_queue.h"
+#include "mpmc_queue.h"
+
+namespace
+{
+    constexpr size_t MailboxCount = 100'000;
+    constexpr size_t ProducerCount = 4;
+    constexpr size_t WorkerCount = 2;
+    constexpr size_t MessagesPerProducer = 500'000;
+    constexpr size_t TotalMessageCount = ProducerCount * MessagesPerProducer;
+
+    // 메시지가 있는 메일박스 번호를 담는 실행 큐 (메일박스 수보다 커야 함)
+    constexpr size_t RunQueueSize = size_t{1} << 17;
+    static_assert(RunQueueSize >= MailboxCount, "실행 큐가 모든 메일박스를 담을 수 있어야 함");
+
+    using RunQueue = MPMCQueue<std::uint32_t, RunQueueSize>;
+
+    struct Message : lfq::MPSCNode
+    {
+        std::uint32_t _mailbox = 0;
+        std::uint64_t _payload = 0;
+    };
+
+    // 비교 대상: 메일박스마다 고정 크기 MPMCQueue와 실행 큐 등록 여부 플래그
+    template <size_t Depth>
+    struct BoundedMailbox
+    {
+        MPMCQueue<Message*, Depth> _queue;
+        std::atomic<bool> _scheduled{false};
+
+        // 빈 메일박스에서 처음 넣은 생산자만 true를 반환
+        bool Send(Message* _message, size_t& _retry_count)
+        {
+            while (false == _queue.Push(_message))
+            {
+                ++_retry_count;
+                std::this_thread::yield();
+            }
+
+            // acq_rel: 소유자가 플래그를 내린 뒤에 넣은 메시지는 반드시 다시 등록된다
+            return false == _scheduled.exchange(true, std::memory_order_acq_rel);
+        }
+
+        template <typename Handler>
+        size_t Receive(Handler&& _handler)
+        {
+            // 비우기 전에 플래그를 내려, 비우는 도중에 들어온 메시지는 새로 등록되게 한다
+            _scheduled.exchange(false, std::memory_order_acq_rel);
+
+            size_t _count = 0;
+            Message* _message = nullptr;
+            while (true == _queue.Pop(_message))
+            {
+                _handler(_message);
+                ++_count;
+            }
+
+            return _count;
+        }
+    };
+
+    struct IntrusiveMailbox
+    {
+        IntrusiveMPSCQueue<Message> _queue;
+
+        bool Send(Message* _message, size_t&) { return _queue.Push(_message); }
+
+        template <typename Handler>
+        size_t Receive(Handler&& _handler) { return _queue.Drain(std::forward<Handler>(_handler)); }
+    };
+
+    struct BenchmarkResult
+    {
+        double setup_ms;
+        double mailbox_memory_mib;
+        double duration_ms;
+        double messages_per_sec;
+        size_t schedule_count;
+        size_t push_retry_count;
+        bool valid;
+    };
+
+    // 생산자는 임의의 메일박스에 메시지를 보내고, 빈 메일박스를 깨웠으면 실행 큐에 등록한다.
+    // 작업 스레드는 실행 큐에서 꺼낸 메일박스를 비운다.
+    template <typename MailboxType>
+    BenchmarkResult RunBenchmark(std::vector<Message>& _messages)
+    {
+        auto _setup_start = std::chrono::steady_clock::now();
+        auto _mailboxes = std::make_unique<MailboxType[]>(MailboxCount);
+        const double _setup_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _setup_start).count();
+
+        auto _run_queue = std::make_unique<RunQueue>();
+        std::atomic<size_t> _processed_count{0};
+        std::atomic<size_t> _schedule_count{0};
+        std::atomic<size_t> _push_retry_count{0};
+        std::atomic<std::uint64_t> _checksum{0};
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> _threads;
+
+        for (size_t _producer = 0; _producer < ProducerCount; ++_producer)
+        {
+            _threads.emplace_back([&, _producer]()
+            {
+                size_t _local_schedule_count = 0;
+                size_t _local_retry_count = 0;
+
+                for (size_t i = 0; i < MessagesPerProducer; ++i)
+                {
+                    Message& _message = _messages[_producer * MessagesPerProducer + i];
+
+                    if (true == _mailboxes[_message._mailbox].Send(&_message, _local_retry_count))
+                    {
+                        while (false == _run_queue->Push(_message._mailbox))
+                        {
+                            std::this_thread::yield();
+                        }
+
+                        ++_local_schedule_count;
+                    }
+                }
+
+                _schedule_count.fetch_add(_local_schedule_count, std::memory_order_relaxed);
+                _push_retry_count.fetch_add(_local_retry_count, std::memory_order_relaxed);
+            });
+        }
+
+        for (size_t _worker = 0; _worker < WorkerCount; ++_worker)
+        {
+            _threads.emplace_back([&]()
+            {
+                std::uint64_t _local_checksum = 0;
+                std::uint32_t _mailbox = 0;
+
+                while (_processed_count.load(std::memory_order_relaxed) < TotalMessageCount)
+                {
+                    if (false == _run_queue->Pop(_mailbox))
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    const size_t _count = _mailboxes[_mailbox].Receive([&_local_checksum](Message* _message)
+                    {
+                        _local_checksum += _message->_payload;
+                    });
+
+                    _processed_count.fetch_add(_count, std::memory_order_relaxed);
+                }
+
+                _checksum.fetch_add(_local_checksum, std::memory_order_relaxed);
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        // 비교 대상 메일박스는 플래그를 내린 뒤 비우므로 빈 메일박스가 실행 큐에 남을 수 있다
+        std::uint32_t _mailbox = 0;
+        while (true == _run_queue->Pop(_mailbox))
+        {
+        }
+
+        const std::uint64_t _expected_checksum = static_cast<std::uint64_t>(TotalMessageCount) * (TotalMessageCount - 1) / 2;
+
+        return BenchmarkResult{
+            _setup_ms,
+            static_cast<double>(sizeof(MailboxType) * MailboxCount) / (1024.0 * 1024.0),
+            _duration_sec * 1000.0,
+            static_cast<double>(TotalMessageCount) / _duration_sec,
+            _schedule_count.load(),
+            _push_retry_count.load(),
+            _processed_count.load() == TotalMessageCount && _checksum.load() == _expected_checksum};
+    }
+
+    void PrintResult(const char* _name, size_t _mailbox_size, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << "메일박스=" << _mailbox_size << " B, 합계 " << _result.mailbox_memory_mib << " MiB (생성 "
+                  << _result.setup_ms << " ms) | "
+                  << _result.duration_ms << " ms | "
+                  << _result.messages_per_sec << " messages/sec | 실행 큐 등록 "
+                  << _result.schedule_count << " | Push 재시도 "
+                  << _result.push_retry_count << " | 검증 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "액터 메일박스: IntrusiveMPSCQueue vs MPMCQueue 벤치마크\n";
+    std::cout << "메일박스=" << MailboxCount
+              << " | 생산자=" << ProducerCount
+              << " | 작업 스레드=" << WorkerCount
+              << " | 메시지=" << TotalMessageCount << " (메일박스를 고르게 임의 선택)\n\n";
+
+    // 모든 경우가 같은 메시지 배열과 목적지를 사용한다
+    std::vector<Message> _messages(TotalMessageCount);
+    {
+        std::mt19937 _random(5);
+        std::uniform_int_distribution<std::uint32_t> _mailbox_distribution(0, MailboxCount - 1);
+
+        for (size_t i = 0; i < TotalMessageCount; ++i)
+        {
+            _messages[i]._mailbox = _mailbox_distribution(_random);
+            _messages[i]._payload = i;
+        }
+    }
+
+    PrintResult("MPMCQueue<Message*, 16>", sizeof(BoundedMailbox<16>), RunBenchmark<BoundedMailbox<16>>(_messages));
+    PrintResult("MPMCQueue<Message*, 64>", sizeof(BoundedMailbox<64>), RunBenchmark<BoundedMailbox<64>>(_messages));
+    PrintResult("IntrusiveMPSCQueue", sizeof(IntrusiveMailbox), RunBenchmark<IntrusiveMailbox>(_messages));
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
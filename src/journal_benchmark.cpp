@@ -0,0 +1,323 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "journal_queue.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr size_t JournalCapacity = 131072;
+
+    // 항목마다 동기화하는 경우는 저장 장치 지연이 지배하므로 항목 수를 줄인다
+    constexpr size_t BatchedItemCount = 100'000;
+    constexpr size_t SyncedItemCount = 2'000;
+
+    // 64바이트 저널 항목
+    struct JournalItem
+    {
+        std::uint64_t _sequence;
+        std::uint32_t _producer;
+        std::uint32_t _length;
+        char _body[48];
+    };
+
+    static_assert(sizeof(JournalItem) == 64);
+
+    using Journal = JournalQueue<JournalItem, JournalCapacity>;
+
+    enum class Backend
+    {
+        Journal,
+        AppendLog
+    };
+
+    struct CaseConfig
+    {
+        const char* name;
+        Backend backend;
+        lfq::JournalSyncMode mode;
+        size_t batch_count;  // 0이면 항목마다 동기화
+        size_t item_count;
+    };
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double pushes_per_sec;
+        std::uint64_t sync_count;
+        bool valid;
+    };
+
+    JournalItem MakeItem(std::uint64_t _sequence, std::uint32_t _producer)
+    {
+        JournalItem _item{};
+        _item._sequence = _sequence;
+        _item._producer = _producer;
+        _item._length = sizeof(_item._body);
+        std::fill(std::begin(_item._body), std::end(_item._body), static_cast<char>('a' + _sequence % 26));
+        return _item;
+    }
+
+    // 생산자들이 저널에 넣고, 모두 끝나면 Sync로 마지막 그룹까지 내려 쓴 시점까지 잰다
+    BenchmarkResult RunJournalOnce(const std::string& _path, const CaseConfig& _config, size_t _producer_count)
+    {
+        std::error_code _error;
+        std::filesystem::remove(_path, _error);
+
+        lfq::JournalSyncPolicy _policy;
+        _policy._mode = _config.mode;
+        _policy._batch_count = _config.batch_count;
+        _policy._interval_us = 10'000;
+
+        auto _journal = std::make_unique<Journal>();
+        if (false == _journal->Open(_path, _policy))
+        {
+            return BenchmarkResult{0.0, 0.0, 0, false};
+        }
+
+        const size_t _items_per_producer = _config.item_count / _producer_count;
+        std::atomic<size_t> _ready_count{0};
+        std::atomic<bool> _start{false};
+        std::atomic<size_t> _failed_count{0};
+        std::vector<std::thread> _producers;
+
+        for (size_t _producer_index = 0; _producer_index < _producer_count; ++_producer_index)
+        {
+            _producers.emplace_back([&, _producer_index]()
+            {
+                _ready_count.fetch_add(1);
+                while (false == _start.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                for (size_t i = 0; i < _items_per_producer; ++i)
+                {
+                    if (false == _journal->Push(MakeItem(i, static_cast<std::uint32_t>(_producer_index))))
+                    {
+                        _failed_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+
+        while (_ready_count.load() < _producer_count)
+        {
+            std::this_thread::yield();
+        }
+
+        const auto _start_time = std::chrono::steady_clock::now();
+        _start.store(true, std::memory_order_release);
+
+        for (auto& _producer : _producers)
+        {
+            _producer.join();
+        }
+
+        const bool _synced = _journal->Sync();
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        const std::uint64_t _sync_count = _journal->GetSyncCount();
+        const size_t _pushed_count = _journal->GetSize();
+        _journal->Close();
+
+        // 다시 열어 모든 항목이 복구되는지 확인한다
+        const bool _recovered = _journal->Open(_path) && _journal->GetRecoveryStats()._recovered_count == _pushed_count;
+        _journal->Close();
+        std::filesystem::remove(_path, _error);
+
+        const size_t _total_count = _items_per_producer * _producer_count;
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(_total_count) / _duration_sec,
+            _sync_count,
+            true == _synced && true == _recovered && _failed_count.load() == 0 && _pushed_count == _total_count};
+    }
+
+    // 기준선: write()로 파일 끝에 붙이고 batch_count개마다 fsync하는 append-log
+    // 여러 생산자는 한 잠금 안에서 쓰고, 동기화도 잠금을 잡은 채 수행한다.
+    BenchmarkResult RunAppendLogOnce(const std::string& _path, const CaseConfig& _config, size_t _producer_count)
+    {
+        const int _fd = open(_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
+        if (_fd < 0)
+        {
+            return BenchmarkResult{0.0, 0.0, 0, false};
+        }
+
+        const size_t _batch_count = _config.batch_count == 0 ? 1 : _config.batch_count;
+        const size_t _items_per_producer = _config.item_count / _producer_count;
+
+        std::mutex _log_mutex;
+        size_t _unsynced_count = 0;
+        std::uint64_t _sync_count = 0;
+        bool _io_failed = false;
+
+        std::atomic<size_t> _ready_count{0};
+        std::atomic<bool> _start{false};
+        std::vector<std::thread> _producers;
+
+        for (size_t _producer_index = 0; _producer_index < _producer_count; ++_producer_index)
+        {
+            _producers.emplace_back([&, _producer_index]()
+            {
+                _ready_count.fetch_add(1);
+                while (false == _start.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                for (size_t i = 0; i < _items_per_producer; ++i)
+                {
+                    const JournalItem _item = MakeItem(i, static_cast<std::uint32_t>(_producer_index));
+
+                    std::lock_guard<std::mutex> _lock(_log_mutex);
+                    _io_failed = _io_failed || write(_fd, &_item, sizeof(_item)) != static_cast<ssize_t>(sizeof(_item));
+
+                    if (++_unsynced_count >= _batch_count)
+                    {
+                        _io_failed = _io_failed || fsync(_fd) != 0;
+                        _unsynced_count = 0;
+                        ++_sync_count;
+                    }
+                }
+            });
+        }
+
+        while (_ready_count.load() < _producer_count)
+        {
+            std::this_thread::yield();
+        }
+
+        const auto _start_time = std::chrono::steady_clock::now();
+        _start.store(true, std::memory_order_release);
+
+        for (auto& _producer : _producers)
+        {
+            _producer.join();
+        }
+
+        if (_unsynced_count != 0)
+        {
+            _io_failed = _io_failed || fsync(_fd) != 0;
+            ++_sync_count;
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+        close(_fd);
+
+        std::error_code _error;
+        const size_t _total_count = _items_per_producer * _producer_count;
+        const bool _size_matches = std::filesystem::file_size(_path, _error) == _total_count * sizeof(JournalItem);
+        std::filesystem::remove(_path, _error);
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(_total_count) / _duration_sec,
+            _sync_count,
+            false == _io_failed && true == _size_matches};
+    }
+
+    BenchmarkResult RunCaseOnce(const std::string& _directory, const CaseConfig& _config, size_t _producer_count)
+    {
+        if (_config.backend == Backend::Journal)
+        {
+            return RunJournalOnce(_directory + "/lfq_journal_benchmark.jrnl", _config, _producer_count);
+        }
+
+        return RunAppendLogOnce(_directory + "/lfq_append_log_benchmark.log", _config, _producer_count);
+    }
+
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.pushes_per_sec < _right.pushes_per_sec;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const CaseConfig& _config, const BenchmarkResult& _result)
+    {
+        const size_t _item_count = _config.item_count;
+        std::cout << "  " << _config.name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(9) << _result.duration_ms << " ms | "
+                  << std::setw(12) << _result.pushes_per_sec << " acked pushes/sec | 동기화 "
+                  << std::setw(6) << _result.sync_count << "회 | 평균 그룹 "
+                  << std::setw(8) << (_result.sync_count == 0 ? 0.0 : static_cast<double>(_item_count) / static_cast<double>(_result.sync_count)) << " | 검증 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+
+    // 모든 경우를 번갈아 실행하고 중앙값을 출력한다
+    void RunComparison(const std::string& _directory, size_t _producer_count)
+    {
+        constexpr size_t CaseCount = 7;
+        const std::array<CaseConfig, CaseCount> _cases = {{
+            {"저널 None              ", Backend::Journal, lfq::JournalSyncMode::None, 0, BatchedItemCount},
+            {"저널 GroupCommit 1024  ", Backend::Journal, lfq::JournalSyncMode::GroupCommit, 1024, BatchedItemCount},
+            {"write+fsync 1024개마다 ", Backend::AppendLog, lfq::JournalSyncMode::GroupCommit, 1024, BatchedItemCount},
+            {"저널 GroupCommit 64    ", Backend::Journal, lfq::JournalSyncMode::GroupCommit, 64, BatchedItemCount},
+            {"write+fsync 64개마다   ", Backend::AppendLog, lfq::JournalSyncMode::GroupCommit, 64, BatchedItemCount},
+            {"저널 EveryPush         ", Backend::Journal, lfq::JournalSyncMode::EveryPush, 0, SyncedItemCount},
+            {"write+fsync 매번       ", Backend::AppendLog, lfq::JournalSyncMode::EveryPush, 0, SyncedItemCount},
+        }};
+
+        std::array<std::array<BenchmarkResult, BenchmarkRepeatCount>, CaseCount> _results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            for (size_t _offset = 0; _offset < CaseCount; ++_offset)
+            {
+                const size_t _case_index = (_repeat_index + _offset) % CaseCount;
+                _results[_case_index][_repeat_index] = RunCaseOnce(_directory, _cases[_case_index], _producer_count);
+            }
+        }
+
+        std::cout << "\n생산자 " << _producer_count << "개\n";
+        for (size_t _case_index = 0; _case_index < CaseCount; ++_case_index)
+        {
+            PrintResult(_cases[_case_index], GetMedianResult(_results[_case_index]));
+        }
+    }
+}
+
+// 사용법: journal_benchmark [디렉터리]
+// 디렉터리를 주지 않으면 임시 디렉터리에 저널과 로그 파일을 만든다.
+// tmpfs처럼 메모리 파일 시스템이면 msync/fsync가 거의 공짜이므로 실제 저장 장치 위의 디렉터리를 준다.
+int main(int _argc, char* _argv[])
+{
+    const std::string _directory = _argc > 1 ? std::string(_argv[1]) : std::filesystem::temp_directory_path().string();
+
+    std::cout << "JournalQueue 동기화 정책 벤치마크\n";
+    std::cout << "디렉터리=" << _directory
+              << " | 항목=" << sizeof(JournalItem) << "바이트"
+              << " | 저널 용량=" << JournalCapacity
+              << " | 항목 수=" << BatchedItemCount << " (항목마다 동기화는 " << SyncedItemCount << ")"
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
+    std::cout << "시간: 첫 Push부터 모든 생산자가 끝난 뒤 마지막 동기화가 끝날 때까지\n";
+    std::cout << "acked: Push가 반환된 수. EveryPush만 반환 시점에 저장 장치에 있고, None/GroupCommit/fsync 그룹은 마지막 동기화에서 내려 쓴다\n";
+
+    for (const size_t _producer_count : {1, 4})
+    {
+        RunComparison(_directory, _producer_count);
+    }
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
@@ -0,0 +1,272 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <random>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "k_way_merge.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr size_t TotalEventCount = 1 << 20;
+    constexpr size_t StreamQueueCapacity = 49;
+    constexpr size_t WatermarkInterval = 64;
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double events_per_sec;
+        bool valid;
+    };
+
+    // 기준선: 보이는 이벤트를 모두 pop해서 최소 힙 버퍼에 복사하고,
+    // 모든 스트림의 하한(마지막으로 꺼낸 타임스탬프 또는 워터마크) 중 최솟값 이하인 이벤트만 내보낸다.
+    class SortedBufferMerge
+    {
+    public:
+        explicit SortedBufferMerge(std::vector<SPSC_Q*> _streams)
+            : m_streams(std::move(_streams)),
+              m_watermarks(std::make_unique<std::atomic<std::int64_t>[]>(m_streams.size())),
+              m_last_keys(m_streams.size(), lfq::MERGE_NO_WATERMARK)
+        {
+            for (size_t i = 0; i < m_streams.size(); ++i)
+            {
+                m_watermarks[i].store(lfq::MERGE_NO_WATERMARK, std::memory_order_relaxed);
+            }
+        }
+
+        void PublishWatermark(size_t _stream_index, std::int64_t _timestamp) noexcept
+        {
+            m_watermarks[_stream_index].store(_timestamp, std::memory_order_release);
+        }
+
+        void CloseStream(size_t _stream_index) noexcept { PublishWatermark(_stream_index, lfq::MERGE_STREAM_CLOSED); }
+
+        template <typename Handler>
+        size_t Drain(Handler&& _handler, size_t _max_count)
+        {
+            std::int64_t _bound = lfq::MERGE_STREAM_CLOSED;
+
+            for (size_t i = 0; i < m_streams.size(); ++i)
+            {
+                PopAll(i);
+
+                // 워터마크보다 먼저 push된 이벤트를 놓치지 않도록 워터마크를 읽은 뒤 한 번 더 비운다
+                const std::int64_t _watermark = m_watermarks[i].load(std::memory_order_acquire);
+                PopAll(i);
+
+                _bound = std::min(_bound, std::max(_watermark, m_last_keys[i]));
+            }
+
+            size_t _drained_count = 0;
+            while (_drained_count < _max_count && false == m_buffer.empty() && m_buffer.top()._event <= _bound)
+            {
+                _handler(m_buffer.top()._stream_index, m_buffer.top()._event);
+                m_buffer.pop();
+                ++_drained_count;
+            }
+
+            m_finished = _bound == lfq::MERGE_STREAM_CLOSED && true == m_buffer.empty();
+            return _drained_count;
+        }
+
+        bool IsFinished() const noexcept { return m_finished; }
+
+    private:
+        struct BufferedEvent
+        {
+            std::int64_t _event;
+            size_t _stream_index;
+
+            bool operator>(const BufferedEvent& _other) const noexcept
+            {
+                return _event > _other._event || (_event == _other._event && _stream_index > _other._stream_index);
+            }
+        };
+
+        void PopAll(size_t _stream_index)
+        {
+            while (const std::optional<std::int64_t> _event = m_streams[_stream_index]->pop())
+            {
+                m_buffer.push(BufferedEvent{*_event, _stream_index});
+                m_last_keys[_stream_index] = *_event;
+            }
+        }
+
+        std::vector<SPSC_Q*> m_streams;
+        std::unique_ptr<std::atomic<std::int64_t>[]> m_watermarks;
+        std::vector<std::int64_t> m_last_keys;
+        std::priority_queue<BufferedEvent, std::vector<BufferedEvent>, std::greater<BufferedEvent>> m_buffer;
+        bool m_finished = false;
+    };
+
+    // 스트림마다 provider 스레드 하나가 임의 간격의 타임스탬프를 보내고 WatermarkInterval개마다 하트비트를 알린다.
+    // consumer 하나가 병합된 순서를 검사하며 모두 받을 때까지의 시간을 잰다.
+    template <typename MergeType>
+    BenchmarkResult RunBenchmarkOnce(size_t _stream_count)
+    {
+        const size_t _events_per_stream = TotalEventCount / _stream_count;
+
+        std::vector<std::unique_ptr<SPSC_Q>> _queues;
+        std::vector<SPSC_Q*> _streams;
+        for (size_t i = 0; i < _stream_count; ++i)
+        {
+            _queues.push_back(std::make_unique<SPSC_Q>(StreamQueueCapacity));
+            _streams.push_back(_queues.back().get());
+        }
+
+        MergeType _merge(_streams);
+        std::atomic<size_t> _ready_count{0};
+        std::atomic<bool> _start{false};
+        std::vector<std::thread> _providers;
+
+        for (size_t _stream_index = 0; _stream_index < _stream_count; ++_stream_index)
+        {
+            _providers.emplace_back([&, _stream_index]()
+            {
+                std::mt19937_64 _random(_stream_index + 1);
+                SPSC_Q& _queue = *_queues[_stream_index];
+                std::int64_t _timestamp = 0;
+
+                _ready_count.fetch_add(1);
+                while (false == _start.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                for (size_t i = 0; i < _events_per_stream; ++i)
+                {
+                    _timestamp += 1 + static_cast<std::int64_t>(_random() % 16);
+                    while (false == _queue.push(_timestamp))
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    if (i % WatermarkInterval == 0)
+                    {
+                        _merge.PublishWatermark(_stream_index, _timestamp);
+                    }
+                }
+
+                _merge.CloseStream(_stream_index);
+            });
+        }
+
+        while (_ready_count.load() < _stream_count)
+        {
+            std::this_thread::yield();
+        }
+
+        std::int64_t _last_timestamp = lfq::MERGE_NO_WATERMARK;
+        size_t _merged_count = 0;
+        bool _ordered = true;
+
+        auto _consume = [&](size_t, const std::int64_t& _event)
+        {
+            _ordered = _ordered && _event >= _last_timestamp;
+            _last_timestamp = _event;
+            ++_merged_count;
+        };
+
+        const auto _start_time = std::chrono::steady_clock::now();
+        _start.store(true, std::memory_order_release);
+
+        while (false == _merge.IsFinished())
+        {
+            if (_merge.Drain(_consume, 1024) == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        for (auto& _provider : _providers)
+        {
+            _provider.join();
+        }
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(_merged_count) / _duration_sec,
+            true == _ordered && _merged_count == _events_per_stream * _stream_count};
+    }
+
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.duration_ms < _right.duration_ms;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(9) << _result.duration_ms << " ms | "
+                  << std::setw(13) << _result.events_per_sec << " merged events/sec | 순서 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+
+    // 두 방식을 번갈아 실행하고 중앙값을 출력한다
+    void RunComparison(size_t _stream_count)
+    {
+        constexpr size_t CaseCount = 2;
+        std::array<std::array<BenchmarkResult, BenchmarkRepeatCount>, CaseCount> _results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            for (size_t _offset = 0; _offset < CaseCount; ++_offset)
+            {
+                const size_t _case_index = (_repeat_index + _offset) % CaseCount;
+                _results[_case_index][_repeat_index] = _case_index == 0
+                    ? RunBenchmarkOnce<KWayMerge<>>(_stream_count)
+                    : RunBenchmarkOnce<SortedBufferMerge>(_stream_count);
+            }
+        }
+
+        std::cout << "\n스트림 " << _stream_count << "개 (스트림당 " << TotalEventCount / _stream_count << "개)\n";
+        PrintResult("KWayMerge (peek + 패자 트리)", GetMedianResult(_results[0]));
+        PrintResult("정렬 버퍼 (pop + 최소 힙)   ", GetMedianResult(_results[1]));
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "타임스탬프 순서 k-way 병합 벤치마크\n";
+    std::cout << "전체 이벤트=" << TotalEventCount
+              << " | 스트림 큐 용량=" << StreamQueueCapacity
+              << " | 하트비트=" << WatermarkInterval << "개마다"
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
+    std::cout << "스트림마다 provider 스레드 하나, consumer 스레드 하나 (하드웨어 스레드="
+              << std::thread::hardware_concurrency() << ")\n";
+
+    for (const size_t _stream_count : {2, 4, 8, 16, 32, 64})
+    {
+        RunComparison(_stream_count);
+    }
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
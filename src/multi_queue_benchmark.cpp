@@ -0,0 +1,577 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mpmc_queue.h"
+#include "multi_queue.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+
+    // 우선순위는 16비트 균등 분포. 꺼내고 새 우선순위로 다시 넣는 hold 모델로 큐 크기를 유지한다.
+    constexpr size_t PriorityBits = 16;
+    constexpr size_t PriorityRange = size_t{1} << PriorityBits;
+    constexpr size_t PrefillCount = 10'000;
+    constexpr size_t OperationsPerThread = 200'000;
+    constexpr size_t RankOperationsPerThread = 50'000;
+    constexpr size_t RankThreadCount = 4;
+
+    // 단일 mutex로 보호하는 힙: 순위 오차 0의 기준선
+    class MutexHeapScheduler
+    {
+    public:
+        explicit MutexHeapScheduler(size_t) {}
+
+        class Context
+        {
+        public:
+            explicit Context(MutexHeapScheduler& _scheduler) : m_scheduler(_scheduler) {}
+
+            void Push(std::uint64_t _priority, std::uint32_t _item)
+            {
+                std::lock_guard<std::mutex> _lock(m_scheduler.m_mutex);
+                m_scheduler.m_entries.push_back(lfq::PriorityEntry<std::uint32_t>{_priority, _item});
+                std::push_heap(m_scheduler.m_entries.begin(), m_scheduler.m_entries.end(), IsLater);
+            }
+
+            bool Pop(std::uint64_t& _priority, std::uint32_t& _item)
+            {
+                std::lock_guard<std::mutex> _lock(m_scheduler.m_mutex);
+                if (true == m_scheduler.m_entries.empty())
+                {
+                    return false;
+                }
+
+                std::pop_heap(m_scheduler.m_entries.begin(), m_scheduler.m_entries.end(), IsLater);
+                _priority = m_scheduler.m_entries.back()._priority;
+                _item = m_scheduler.m_entries.back()._item;
+                m_scheduler.m_entries.pop_back();
+                return true;
+            }
+
+        private:
+            MutexHeapScheduler& m_scheduler;
+        };
+
+    private:
+        static bool IsLater(const lfq::PriorityEntry<std::uint32_t>& _left, const lfq::PriorityEntry<std::uint32_t>& _right)
+        {
+            return _left._priority > _right._priority;
+        }
+
+        std::mutex m_mutex;
+        std::vector<lfq::PriorityEntry<std::uint32_t>> m_entries;
+    };
+
+    // 우선순위 구간마다 MPMCQueue를 하나씩 두고 Pop이 낮은 구간부터 훑는 엄격한 다단계 큐
+    // 구간 사이의 순서는 엄격하고 구간 안은 FIFO다.
+    class LeveledScheduler
+    {
+    public:
+        static constexpr size_t LevelCount = 16;
+        static constexpr size_t LevelCapacity = 16384;
+
+        explicit LeveledScheduler(size_t) : m_levels(std::make_unique<Level[]>(LevelCount)) {}
+
+        class Context
+        {
+        public:
+            explicit Context(LeveledScheduler& _scheduler) : m_scheduler(_scheduler) {}
+
+            void Push(std::uint64_t _priority, std::uint32_t _item)
+            {
+                Level& _level = m_scheduler.m_levels[static_cast<size_t>(_priority >> (PriorityBits - 4))];
+                while (false == _level.Push(lfq::PriorityEntry<std::uint32_t>{_priority, _item}))
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            bool Pop(std::uint64_t& _priority, std::uint32_t& _item)
+            {
+                lfq::PriorityEntry<std::uint32_t> _entry{};
+                for (size_t i = 0; i < LevelCount; ++i)
+                {
+                    if (true == m_scheduler.m_levels[i].Pop(_entry))
+                    {
+                        _priority = _entry._priority;
+                        _item = _entry._item;
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+        private:
+            LeveledScheduler& m_scheduler;
+        };
+
+    private:
+        static_assert(LevelCount == 16, "구간 번호는 우선순위 상위 4비트");
+
+        using Level = MPMCQueue<lfq::PriorityEntry<std::uint32_t>, LevelCapacity>;
+        std::unique_ptr<Level[]> m_levels;
+    };
+
+    // MultiQueue를 직접 호출. 힙 개수 = QueuesPerThread × 스레드 수
+    template <size_t QueuesPerThread>
+    class MultiQueueScheduler
+    {
+    public:
+        explicit MultiQueueScheduler(size_t _thread_count) : m_queue(QueuesPerThread * _thread_count) {}
+
+        class Context
+        {
+        public:
+            explicit Context(MultiQueueScheduler& _scheduler) : m_queue(_scheduler.m_queue) {}
+
+            void Push(std::uint64_t _priority, std::uint32_t _item) { m_queue.Push(_priority, _item); }
+            bool Pop(std::uint64_t& _priority, std::uint32_t& _item) { return m_queue.Pop(_priority, _item); }
+
+        private:
+            MultiQueue<std::uint32_t>& m_queue;
+        };
+
+    private:
+        MultiQueue<std::uint32_t> m_queue;
+    };
+
+    // 스레드마다 MultiQueueHandle로 삽입/삭제를 묶는다
+    template <size_t QueuesPerThread, size_t BufferSize>
+    class BufferedMultiQueueScheduler
+    {
+    public:
+        explicit BufferedMultiQueueScheduler(size_t _thread_count) : m_queue(QueuesPerThread * _thread_count) {}
+
+        class Context
+        {
+        public:
+            explicit Context(BufferedMultiQueueScheduler& _scheduler) : m_handle(_scheduler.m_queue, BufferSize, BufferSize) {}
+
+            void Push(std::uint64_t _priority, std::uint32_t _item) { m_handle.Push(_priority, _item); }
+            bool Pop(std::uint64_t& _priority, std::uint32_t& _item) { return m_handle.Pop(_priority, _item); }
+
+        private:
+            MultiQueueHandle<std::uint32_t> m_handle;
+        };
+
+    private:
+        MultiQueue<std::uint32_t> m_queue;
+    };
+
+    struct ThroughputResult
+    {
+        double duration_ms;
+        double operations_per_sec;
+        size_t empty_pop_count;
+    };
+
+    // 순위 오차 측정용 이벤트. 삽입은 Push 직전, 삭제는 Pop 직후의 시각으로 기록해 재생 순서가 실제 순서를 거스르지 않게 한다.
+    struct RankEvent
+    {
+        std::uint64_t _timestamp_ns;
+        std::uint32_t _priority;
+        bool _is_delete;
+    };
+
+    struct RankErrorResult
+    {
+        double mean;
+        std::uint64_t p50;
+        std::uint64_t p99;
+        std::uint64_t max;
+        std::array<double, 6> histogram;  // 0, 1-3, 4-15, 16-63, 64-255, 256 이상 (%)
+    };
+
+    std::uint64_t GetElapsedNs(std::chrono::steady_clock::time_point _start_time)
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start_time).count());
+    }
+
+    template <typename Scheduler>
+    void Prefill(Scheduler& _scheduler)
+    {
+        typename Scheduler::Context _context(_scheduler);
+        std::mt19937_64 _random(99);
+
+        for (size_t i = 0; i < PrefillCount; ++i)
+        {
+            _context.Push(_random() % PriorityRange, static_cast<std::uint32_t>(i));
+        }
+    }
+
+    // 스레드마다 Pop 한 번과 Push 한 번을 OperationsPerThread번 반복한다
+    template <typename Scheduler>
+    ThroughputResult RunThroughputOnce(size_t _thread_count)
+    {
+        auto _scheduler = std::make_unique<Scheduler>(_thread_count);
+        Prefill(*_scheduler);
+
+        std::atomic<size_t> _ready_count{0};
+        std::atomic<bool> _start{false};
+        std::atomic<size_t> _empty_pop_count{0};
+        std::vector<std::thread> _threads;
+
+        for (size_t _thread_index = 0; _thread_index < _thread_count; ++_thread_index)
+        {
+            _threads.emplace_back([&, _thread_index]()
+            {
+                typename Scheduler::Context _context(*_scheduler);
+                std::mt19937_64 _random(_thread_index + 1);
+                std::uint64_t _priority = 0;
+                std::uint32_t _item = 0;
+                size_t _local_empty_count = 0;
+
+                _ready_count.fetch_add(1);
+                while (false == _start.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                for (size_t i = 0; i < OperationsPerThread; ++i)
+                {
+                    if (false == _context.Pop(_priority, _item))
+                    {
+                        ++_local_empty_count;
+                    }
+
+                    _context.Push(_random() % PriorityRange, _item);
+                }
+
+                _empty_pop_count.fetch_add(_local_empty_count, std::memory_order_relaxed);
+            });
+        }
+
+        while (_ready_count.load() < _thread_count)
+        {
+            std::this_thread::yield();
+        }
+
+        const auto _start_time = std::chrono::steady_clock::now();
+        _start.store(true, std::memory_order_release);
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        return ThroughputResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(2 * OperationsPerThread * _thread_count) / _duration_sec,
+            _empty_pop_count.load()};
+    }
+
+    // 우선순위 값별 개수로 "남은 항목 중 더 작은 항목 수"를 세는 Fenwick 트리
+    class RankCounter
+    {
+    public:
+        explicit RankCounter(size_t _value_count) : m_tree(_value_count + 1, 0) {}
+
+        void Add(size_t _value, long long _delta)
+        {
+            for (size_t i = _value + 1; i < m_tree.size(); i += i & (~i + 1))
+            {
+                m_tree[i] += _delta;
+            }
+        }
+
+        long long CountLess(size_t _value) const
+        {
+            long long _count = 0;
+            for (size_t i = _value; i > 0; i -= i & (~i + 1))
+            {
+                _count += m_tree[i];
+            }
+
+            return _count;
+        }
+
+    private:
+        std::vector<long long> m_tree;
+    };
+
+    // 스레드별 이벤트 기록을 시각 순으로 재생하며, 꺼낸 항목보다 작은 항목이 몇 개 남아 있었는지 센다
+    template <typename Scheduler>
+    RankErrorResult MeasureRankError()
+    {
+        auto _scheduler = std::make_unique<Scheduler>(RankThreadCount);
+
+        std::vector<RankEvent> _events;
+        {
+            typename Scheduler::Context _context(*_scheduler);
+            std::mt19937_64 _random(99);
+            for (size_t i = 0; i < PrefillCount; ++i)
+            {
+                const std::uint64_t _priority = _random() % PriorityRange;
+                _context.Push(_priority, static_cast<std::uint32_t>(i));
+                _events.push_back(RankEvent{0, static_cast<std::uint32_t>(_priority), false});
+            }
+        }
+
+        std::atomic<size_t> _ready_count{0};
+        std::atomic<bool> _start{false};
+        std::chrono::steady_clock::time_point _start_time;
+        std::vector<std::vector<RankEvent>> _thread_events(RankThreadCount);
+        std::vector<std::thread> _threads;
+
+        for (size_t _thread_index = 0; _thread_index < RankThreadCount; ++_thread_index)
+        {
+            _threads.emplace_back([&, _thread_index]()
+            {
+                typename Scheduler::Context _context(*_scheduler);
+                std::mt19937_64 _random(_thread_index + 1);
+                std::vector<RankEvent>& _local_events = _thread_events[_thread_index];
+                _local_events.reserve(2 * RankOperationsPerThread);
+                std::uint64_t _priority = 0;
+                std::uint32_t _item = 0;
+
+                _ready_count.fetch_add(1);
+                while (false == _start.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                for (size_t i = 0; i < RankOperationsPerThread; ++i)
+                {
+                    if (true == _context.Pop(_priority, _item))
+                    {
+                        _local_events.push_back(RankEvent{GetElapsedNs(_start_time) + 1, static_cast<std::uint32_t>(_priority), true});
+                    }
+
+                    const std::uint64_t _new_priority = _random() % PriorityRange;
+                    _local_events.push_back(RankEvent{GetElapsedNs(_start_time) + 1, static_cast<std::uint32_t>(_new_priority), false});
+                    _context.Push(_new_priority, _item);
+                }
+            });
+        }
+
+        while (_ready_count.load() < RankThreadCount)
+        {
+            std::this_thread::yield();
+        }
+
+        _start_time = std::chrono::steady_clock::now();
+        _start.store(true, std::memory_order_release);
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        for (const auto& _local_events : _thread_events)
+        {
+            _events.insert(_events.end(), _local_events.begin(), _local_events.end());
+        }
+
+        // 같은 시각이면 삽입을 먼저 재생한다
+        std::stable_sort(_events.begin(), _events.end(), [](const RankEvent& _left, const RankEvent& _right)
+        {
+            return _left._timestamp_ns != _right._timestamp_ns ? _left._timestamp_ns < _right._timestamp_ns : (false == _left._is_delete && true == _right._is_delete);
+        });
+
+        RankCounter _counter(PriorityRange);
+        std::vector<std::uint64_t> _rank_errors;
+        for (const RankEvent& _event : _events)
+        {
+            if (false == _event._is_delete)
+            {
+                _counter.Add(_event._priority, 1);
+                continue;
+            }
+
+            _rank_errors.push_back(static_cast<std::uint64_t>(std::max(0LL, _counter.CountLess(_event._priority))));
+            _counter.Add(_event._priority, -1);
+        }
+
+        RankErrorResult _result{};
+        if (true == _rank_errors.empty())
+        {
+            return _result;
+        }
+
+        std::uint64_t _total = 0;
+        for (const std::uint64_t _rank_error : _rank_errors)
+        {
+            _total += _rank_error;
+
+            size_t _bucket = 5;
+            if (_rank_error == 0)
+            {
+                _bucket = 0;
+            }
+            else if (_rank_error < 4)
+            {
+                _bucket = 1;
+            }
+            else if (_rank_error < 16)
+            {
+                _bucket = 2;
+            }
+            else if (_rank_error < 64)
+            {
+                _bucket = 3;
+            }
+            else if (_rank_error < 256)
+            {
+                _bucket = 4;
+            }
+
+            _result.histogram[_bucket] += 100.0 / static_cast<double>(_rank_errors.size());
+        }
+
+        std::sort(_rank_errors.begin(), _rank_errors.end());
+        _result.mean = static_cast<double>(_total) / static_cast<double>(_rank_errors.size());
+        _result.p50 = _rank_errors[_rank_errors.size() / 2];
+        _result.p99 = _rank_errors[std::min(_rank_errors.size() - 1, _rank_errors.size() * 99 / 100)];
+        _result.max = _rank_errors.back();
+        return _result;
+    }
+
+    ThroughputResult GetMedianResult(std::array<ThroughputResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const ThroughputResult& _left, const ThroughputResult& _right)
+        {
+            return _left.operations_per_sec < _right.operations_per_sec;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    using Buffered = BufferedMultiQueueScheduler<2, 16>;
+
+    constexpr size_t CaseCount = 5;
+    const std::array<const char*, CaseCount> CaseNames = {
+        "mutex 힙                ",
+        "다단계 MPMCQueue (16단) ",
+        "MultiQueue c=2          ",
+        "MultiQueue c=4          ",
+        "MultiQueue c=2 버퍼 16  "};
+
+    ThroughputResult RunThroughputCase(size_t _case_index, size_t _thread_count)
+    {
+        switch (_case_index)
+        {
+        case 0:
+            return RunThroughputOnce<MutexHeapScheduler>(_thread_count);
+        case 1:
+            return RunThroughputOnce<LeveledScheduler>(_thread_count);
+        case 2:
+            return RunThroughputOnce<MultiQueueScheduler<2>>(_thread_count);
+        case 3:
+            return RunThroughputOnce<MultiQueueScheduler<4>>(_thread_count);
+        default:
+            return RunThroughputOnce<Buffered>(_thread_count);
+        }
+    }
+
+    RankErrorResult MeasureRankErrorCase(size_t _case_index)
+    {
+        switch (_case_index)
+        {
+        case 0:
+            return MeasureRankError<MutexHeapScheduler>();
+        case 1:
+            return MeasureRankError<LeveledScheduler>();
+        case 2:
+            return MeasureRankError<MultiQueueScheduler<2>>();
+        case 3:
+            return MeasureRankError<MultiQueueScheduler<4>>();
+        default:
+            return MeasureRankError<Buffered>();
+        }
+    }
+
+    // 모든 방식을 번갈아 실행하고 중앙값을 출력한다
+    void RunThroughputComparison(size_t _thread_count)
+    {
+        std::array<std::array<ThroughputResult, BenchmarkRepeatCount>, CaseCount> _results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            for (size_t _offset = 0; _offset < CaseCount; ++_offset)
+            {
+                const size_t _case_index = (_repeat_index + _offset) % CaseCount;
+                _results[_case_index][_repeat_index] = RunThroughputCase(_case_index, _thread_count);
+            }
+        }
+
+        std::cout << "\n스레드 " << _thread_count << "개\n";
+        for (size_t _case_index = 0; _case_index < CaseCount; ++_case_index)
+        {
+            const ThroughputResult _result = GetMedianResult(_results[_case_index]);
+            std::cout << "  " << CaseNames[_case_index] << ": "
+                      << std::fixed << std::setprecision(2)
+                      << std::setw(9) << _result.duration_ms << " ms | "
+                      << std::setw(12) << _result.operations_per_sec << " ops/sec | 빈 Pop "
+                      << _result.empty_pop_count << '\n';
+        }
+    }
+
+    void RunRankErrorComparison()
+    {
+        std::cout << "\n순위 오차 분포 (스레드 " << RankThreadCount << "개, 스레드당 Pop+Push " << RankOperationsPerThread << "회)\n";
+        std::cout << "  순위 오차 = 꺼낸 순간 큐에 남아 있던 더 작은 우선순위 항목 수 (버퍼에 든 항목 포함)\n";
+        std::cout << "  방식                      :   평균     p50     p99     최대 |    0   1-3  4-15 16-63 64-255  256+ (%)\n";
+
+        for (size_t _case_index = 0; _case_index < CaseCount; ++_case_index)
+        {
+            const RankErrorResult _result = MeasureRankErrorCase(_case_index);
+            std::cout << "  " << CaseNames[_case_index] << ": "
+                      << std::fixed << std::setprecision(2)
+                      << std::setw(6) << _result.mean << ' '
+                      << std::setw(7) << _result.p50 << ' '
+                      << std::setw(7) << _result.p99 << ' '
+                      << std::setw(8) << _result.max << " |"
+                      << std::setprecision(1);
+
+            for (const double _percent : _result.histogram)
+            {
+                std::cout << std::setw(6) << _percent;
+            }
+
+            std::cout << '\n';
+        }
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "MultiQueue 우선순위 스케줄러 벤치마크\n";
+    std::cout << "hold 모델: 스레드마다 Pop 한 번 + 새 우선순위로 Push 한 번 반복"
+              << " | 초기 항목=" << PrefillCount
+              << " | 우선순위=" << PriorityBits << "비트 균등 분포"
+              << " | 스레드당 반복=" << OperationsPerThread
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
+    std::cout << "MultiQueue 힙 개수 = c x 스레드 수 | 다단계 MPMCQueue는 우선순위 상위 4비트로 구간을 고름\n";
+
+    for (const size_t _thread_count : {1, 2, 4, 8})
+    {
+        RunThroughputComparison(_thread_count);
+    }
+
+    RunRankErrorComparison();
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
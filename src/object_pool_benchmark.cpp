@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mpmc_queue.h"
+#include "object_pool.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr size_t OperationsPerThread = 1'000'000;
+
+    // 풀 용량은 큐가 가득 찬 상태에서도 생산자 매거진이 고갈되지 않도록 큐 크기의 두 배로 둔다.
+    constexpr size_t PoolCapacity = lfq::QUEUE_SIZE * 2;
+
+    // 실제 서비스의 1~4 KiB 버퍼를 흉내 내는 페이로드
+    template <size_t PayloadSize>
+    struct Payload
+    {
+        std::uint64_t value;
+        char bytes[PayloadSize - sizeof(std::uint64_t)];
+    };
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double messages_per_sec;
+        double payload_mb_per_sec;
+        std::uint64_t checksum;
+        std::uint64_t expected_checksum;
+    };
+
+    // 페이로드 전체를 큐 슬롯에 복사해 전달한다.
+    template <size_t PayloadSize>
+    struct CopyScenario
+    {
+        using PayloadType = Payload<PayloadSize>;
+        using QueueType = MPMCQueue<PayloadType, lfq::QUEUE_SIZE>;
+
+        std::unique_ptr<QueueType> m_queue = std::make_unique<QueueType>();
+
+        void Produce(size_t _thread_id)
+        {
+            auto _data = std::make_unique<PayloadType>();
+
+            for (size_t _operation_index = 0; _operation_index < OperationsPerThread; ++_operation_index)
+            {
+                _data->value = _thread_id * OperationsPerThread + _operation_index;
+
+                while (false == m_queue->Push(*_data))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        std::uint64_t Consume(size_t _operation_count)
+        {
+            auto _data = std::make_unique<PayloadType>();
+            std::uint64_t _checksum = 0;
+
+            for (size_t _success_count = 0; _success_count < _operation_count;)
+            {
+                if (true == m_queue->Pop(*_data))
+                {
+                    _checksum += _data->value;
+                    ++_success_count;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            return _checksum;
+        }
+    };
+
+    // 풀에서 획득한 객체에 직접 쓰고 32비트 핸들만 큐로 전달한다.
+    template <size_t PayloadSize>
+    struct PoolScenario
+    {
+        using PayloadType = Payload<PayloadSize>;
+        using PoolType = ObjectPool<PayloadType, PoolCapacity>;
+        using QueueType = MPMCQueue<typename PoolType::Handle, lfq::QUEUE_SIZE>;
+
+        std::unique_ptr<PoolType> m_pool = std::make_unique<PoolType>();
+        std::unique_ptr<QueueType> m_queue = std::make_unique<QueueType>();
+
+        void Produce(size_t _thread_id)
+        {
+            typename PoolType::Cache _cache(*m_pool);
+
+            for (size_t _operation_index = 0; _operation_index < OperationsPerThread; ++_operation_index)
+            {
+                typename PoolType::Handle _handle = PoolType::INVALID_HANDLE;
+                while ((_handle = m_pool->Acquire(_cache)) == PoolType::INVALID_HANDLE)
+                {
+                    std::this_thread::yield();
+                }
+
+                m_pool->Get(_handle).value = _thread_id * OperationsPerThread + _operation_index;
+
+                while (false == m_queue->Push(_handle))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        std::uint64_t Consume(size_t _operation_count)
+        {
+            typename PoolType::Cache _cache(*m_pool);
+            std::uint64_t _checksum = 0;
+
+            for (size_t _success_count = 0; _success_count < _operation_count;)
+            {
+                typename PoolType::Handle _handle = PoolType::INVALID_HANDLE;
+
+                if (true == m_queue->Pop(_handle))
+                {
+                    _checksum += m_pool->Get(_handle).value;
+                    m_pool->Release(_cache, _handle);
+                    ++_success_count;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            return _checksum;
+        }
+    };
+
+    // 한 번의 벤치마크를 실행하고 시간, 처리량과 체크섬 결과를 반환한다.
+    template <typename ScenarioType, size_t PayloadSize>
+    BenchmarkResult RunBenchmarkOnce(size_t _thread_pair_count)
+    {
+        auto _scenario = std::make_unique<ScenarioType>();
+        std::atomic<std::uint64_t> _checksum{0};
+
+        const size_t _total_operation_count = _thread_pair_count * OperationsPerThread;
+
+        std::vector<std::thread> _threads;
+        _threads.reserve(_thread_pair_count * 2);
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        for (size_t _thread_index = 0; _thread_index < _thread_pair_count; ++_thread_index)
+        {
+            _threads.emplace_back([&_scenario, _thread_index]() { _scenario->Produce(_thread_index); });
+            _threads.emplace_back([&_scenario, &_checksum]()
+            {
+                _checksum.fetch_add(_scenario->Consume(OperationsPerThread), std::memory_order_relaxed);
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const auto _end_time = std::chrono::steady_clock::now();
+        const double _duration_sec = std::chrono::duration<double>(_end_time - _start_time).count();
+        const double _messages_per_sec = static_cast<double>(_total_operation_count) / _duration_sec;
+        const std::uint64_t _total_operation_count64 = static_cast<std::uint64_t>(_total_operation_count);
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            _messages_per_sec,
+            (_messages_per_sec * PayloadSize) / (1024.0 * 1024.0),
+            _checksum.load(std::memory_order_relaxed),
+            (_total_operation_count64 * (_total_operation_count64 - 1)) / 2};
+    }
+
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.duration_ms < _right.duration_ms;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        const bool _checksum_valid = _result.checksum == _result.expected_checksum;
+
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(10) << _result.duration_ms << " ms | "
+                  << std::setw(14) << _result.messages_per_sec << " messages/sec | "
+                  << std::setw(10) << _result.payload_mb_per_sec << " MB/s | 체크섬 "
+                  << (true == _checksum_valid ? "정상" : "오류") << '\n';
+    }
+
+    // 복사 방식과 핸들 방식을 번갈아 세 번 측정하고 각각의 중앙값을 출력한다.
+    template <size_t PayloadSize>
+    void RunComparison(size_t _thread_pair_count)
+    {
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _copy_results;
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _pool_results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            if ((_repeat_index % 2) == 0)
+            {
+                _copy_results[_repeat_index] = RunBenchmarkOnce<CopyScenario<PayloadSize>, PayloadSize>(_thread_pair_count);
+                _pool_results[_repeat_index] = RunBenchmarkOnce<PoolScenario<PayloadSize>, PayloadSize>(_thread_pair_count);
+            }
+            else
+            {
+                _pool_results[_repeat_index] = RunBenchmarkOnce<PoolScenario<PayloadSize>, PayloadSize>(_thread_pair_count);
+                _copy_results[_repeat_index] = RunBenchmarkOnce<CopyScenario<PayloadSize>, PayloadSize>(_thread_pair_count);
+            }
+        }
+
+        std::cout << "\n" << PayloadSize << " B 페이로드 | " << _thread_pair_count << "P / " << _thread_pair_count << "C\n";
+        PrintResult("슬롯 복사", GetMedianResult(_copy_results));
+        PrintResult("풀 핸들", GetMedianResult(_pool_results));
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "페이로드 복사 vs ObjectPool 핸들 전달 벤치마크\n";
+    std::cout << "큐 크기=" << lfq::QUEUE_SIZE
+              << " | 풀 용량=" << PoolCapacity
+              << " | 스레드당 작업=" << OperationsPerThread
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
+
+    for (const size_t _thread_pair_count : {1, 2, 4})
+    {
+        RunComparison<1024>(_thread_pair_count);
+        RunComparison<4096>(_thread_pair_count);
+    }
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
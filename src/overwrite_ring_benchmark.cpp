@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mpmc_queue.h"
+#include "overwrite_ring.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr size_t RingSize = 1024;
+    constexpr std::uint64_t EventsPerCase = 4'000'000;
+
+    struct TraceEvent
+    {
+        std::uint64_t _timestamp;
+        std::uint32_t _thread;
+        std::uint32_t _kind;
+        std::uint64_t _argument[2];
+    };
+
+    // 기존 방식: 가득 차면 생산자가 소비자를 기다린다
+    struct BlockingRing
+    {
+        MPMCQueue<TraceEvent, RingSize> _queue;
+
+        std::uint64_t Push(const TraceEvent& _event)
+        {
+            std::uint64_t _retry_count = 0;
+            while (false == _queue.Push(_event))
+            {
+                ++_retry_count;
+                std::this_thread::yield();
+            }
+
+            return _retry_count;
+        }
+
+        bool Pop(TraceEvent& _event) { return _queue.Pop(_event); }
+        std::uint64_t GetLostCount() const { return 0; }
+    };
+
+    struct LossyRing
+    {
+        OverwriteRing<TraceEvent, RingSize> _ring;
+
+        std::uint64_t Push(const TraceEvent& _event)
+        {
+            _ring.Push(_event);
+            return 0;
+        }
+
+        bool Pop(TraceEvent& _event) { return _ring.Pop(_event); }
+        std::uint64_t GetLostCount() const { return _ring.GetLostCount(); }
+    };
+
+    struct BenchmarkResult
+    {
+        double producer_ns_per_push;
+        double duration_ms;
+        std::uint64_t received_count;
+        std::uint64_t lost_count;
+        std::uint64_t retry_count;
+        bool valid;
+    };
+
+    // 생산자들이 이벤트를 모두 넣는 데 걸린 시간을 잰다. 소비자는 생산자가 끝날 때까지 계속 비운다.
+    template <typename RingType>
+    BenchmarkResult RunBenchmarkOnce(size_t _producer_count, bool _with_consumer)
+    {
+        auto _ring = std::make_unique<RingType>();
+        std::atomic<size_t> _finished_count{0};
+        std::atomic<std::uint64_t> _retry_count{0};
+        std::atomic<std::uint64_t> _producer_ns{0};
+        std::uint64_t _received_count = 0;
+
+        const std::uint64_t _events_per_producer = EventsPerCase / _producer_count;
+        std::vector<std::thread> _threads;
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        for (size_t _producer = 0; _producer < _producer_count; ++_producer)
+        {
+            _threads.emplace_back([&, _producer]()
+            {
+                const auto _producer_start = std::chrono::steady_clock::now();
+                std::uint64_t _local_retry_count = 0;
+
+                for (std::uint64_t i = 0; i < _events_per_producer; ++i)
+                {
+                    _local_retry_count += _ring->Push(TraceEvent{i, static_cast<std::uint32_t>(_producer), 1, {i, i}});
+                }
+
+                const auto _elapsed = std::chrono::steady_clock::now() - _producer_start;
+                _producer_ns.fetch_add(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(_elapsed).count()), std::memory_order_relaxed);
+                _retry_count.fetch_add(_local_retry_count, std::memory_order_relaxed);
+                _finished_count.fetch_add(1, std::memory_order_release);
+            });
+        }
+
+        if (true == _with_consumer)
+        {
+            _threads.emplace_back([&]()
+            {
+                TraceEvent _event{};
+
+                while (true)
+                {
+                    const bool _finished = _finished_count.load(std::memory_order_acquire) == _producer_count;
+
+                    while (true == _ring->Pop(_event))
+                    {
+                        ++_received_count;
+                    }
+
+                    if (true == _finished)
+                    {
+                        break;
+                    }
+
+                    std::this_thread::yield();
+                }
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+        const std::uint64_t _pushed_count = _events_per_producer * _producer_count;
+
+        // 생산자 한 명의 Push 한 번에 걸린 평균 시간
+        return BenchmarkResult{
+            static_cast<double>(_producer_ns.load()) / static_cast<double>(_pushed_count),
+            _duration_sec * 1000.0,
+            _received_count,
+            _ring->GetLostCount(),
+            _retry_count.load(),
+            false == _with_consumer || _received_count + _ring->GetLostCount() == _pushed_count};
+    }
+
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.producer_ns_per_push < _right.producer_ns_per_push;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(8) << _result.producer_ns_per_push << " ns/Push | "
+                  << std::setw(9) << _result.duration_ms << " ms | 받음 "
+                  << _result.received_count << " | 손실 "
+                  << _result.lost_count << " | Push 재시도 "
+                  << _result.retry_count << " | 검증 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+
+    void RunComparison(size_t _producer_count)
+    {
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _blocking_results;
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _lossy_results;
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _lossy_alone_results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            // 측정 순서에 따른 편향을 줄이기 위해 반복마다 순서를 바꾼다
+            if (_repeat_index % 2 == 0)
+            {
+                _blocking_results[_repeat_index] = RunBenchmarkOnce<BlockingRing>(_producer_count, true);
+                _lossy_results[_repeat_index] = RunBenchmarkOnce<LossyRing>(_producer_count, true);
+            }
+            else
+            {
+                _lossy_results[_repeat_index] = RunBenchmarkOnce<LossyRing>(_producer_count, true);
+                _blocking_results[_repeat_index] = RunBenchmarkOnce<BlockingRing>(_producer_count, true);
+            }
+
+            _lossy_alone_results[_repeat_index] = RunBenchmarkOnce<LossyRing>(_producer_count, false);
+        }
+
+        std::cout << "\n생산자 " << _producer_count << "명\n";
+        PrintResult("MPMCQueue::Push (소비자 1)    ", GetMedianResult(_blocking_results));
+        PrintResult("OverwriteRing::Push (소비자 1)", GetMedianResult(_lossy_results));
+        PrintResult("OverwriteRing::Push (소비자 0)", GetMedianResult(_lossy_alone_results));
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "트레이스 링: OverwriteRing vs MPMCQueue 생산자 비용 벤치마크\n";
+    std::cout << "링 크기=" << RingSize
+              << " | 이벤트=" << sizeof(TraceEvent) << " B x " << EventsPerCase
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
+
+    for (const size_t _producer_count : {1, 4})
+    {
+        RunComparison(_producer_count);
+    }
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
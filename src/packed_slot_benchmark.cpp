@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mpmc_queue.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double messages_per_sec;
+        size_t push_retry_count;
+        size_t pop_retry_count;
+        std::uint64_t checksum;
+        std::uint64_t expected_checksum;
+    };
+
+    template <typename QueueType>
+    void ProducerThread(QueueType& _queue, size_t _thread_id, std::atomic<size_t>& _retry_count)
+    {
+        size_t _local_retry_count = 0;
+
+        for (size_t _operation_index = 0; _operation_index < lfq::OPERATIONS_PER_THREAD; ++_operation_index)
+        {
+            const std::uint32_t _value = static_cast<std::uint32_t>(_thread_id * lfq::OPERATIONS_PER_THREAD + _operation_index);
+
+            while (false == _queue.Push(_value))
+            {
+                ++_local_retry_count;
+                std::this_thread::yield();
+            }
+        }
+
+        _retry_count.fetch_add(_local_retry_count, std::memory_order_relaxed);
+    }
+
+    template <typename QueueType>
+    void ConsumerThread(QueueType& _queue, size_t _operation_count, std::atomic<size_t>& _retry_count, std::atomic<std::uint64_t>& _checksum)
+    {
+        size_t _success_count = 0;
+        size_t _local_retry_count = 0;
+        std::uint64_t _local_checksum = 0;
+        std::uint32_t _value = 0;
+
+        while (_success_count < _operation_count)
+        {
+            if (true == _queue.Pop(_value))
+            {
+                ++_success_count;
+                _local_checksum += _value;
+            }
+            else
+            {
+                ++_local_retry_count;
+                std::this_thread::yield();
+            }
+        }
+
+        _retry_count.fetch_add(_local_retry_count, std::memory_order_relaxed);
+        _checksum.fetch_add(_local_checksum, std::memory_order_relaxed);
+    }
+
+    template <typename QueueType>
+    BenchmarkResult RunBenchmarkOnce(size_t _thread_pair_count)
+    {
+        auto _queue = std::make_unique<QueueType>();
+        std::atomic<size_t> _push_retry_count{0};
+        std::atomic<size_t> _pop_retry_count{0};
+        std::atomic<std::uint64_t> _checksum{0};
+
+        const size_t _total_operation_count = _thread_pair_count * lfq::OPERATIONS_PER_THREAD;
+
+        std::vector<std::thread> _threads;
+        _threads.reserve(_thread_pair_count * 2);
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        for (size_t _thread_index = 0; _thread_index < _thread_pair_count; ++_thread_index)
+        {
+            _threads.emplace_back(ProducerThread<QueueType>, std::ref(*_queue), _thread_index, std::ref(_push_retry_count));
+            _threads.emplace_back(ConsumerThread<QueueType>, std::ref(*_queue), lfq::OPERATIONS_PER_THREAD, std::ref(_pop_retry_count), std::ref(_checksum));
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const auto _end_time = std::chrono::steady_clock::now();
+        const double _duration_sec = std::chrono::duration<double>(_end_time - _start_time).count();
+        const std::uint64_t _total_operation_count64 = static_cast<std::uint64_t>(_total_operation_count);
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(_total_operation_count) / _duration_sec,
+            _push_retry_count.load(std::memory_order_relaxed),
+            _pop_retry_count.load(std::memory_order_relaxed),
+            _checksum.load(std::memory_order_relaxed),
+            (_total_operation_count64 * (_total_operation_count64 - 1)) / 2};
+    }
+
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.duration_ms < _right.duration_ms;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        const bool _checksum_valid = _result.checksum == _result.expected_checksum;
+
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(10) << _result.duration_ms << " ms | "
+                  << std::setw(14) << _result.messages_per_sec << " messages/sec | Push 재시도 "
+                  << _result.push_retry_count << " | Pop 재시도 " << _result.pop_retry_count << " | 체크섬 "
+                  << (true == _checksum_valid ? "정상" : "오류") << '\n';
+    }
+
+    // 일반 슬롯과 packed 슬롯을 번갈아 세 번 측정하고 각각의 중앙값을 출력한다.
+    void RunComparison(size_t _thread_pair_count)
+    {
+        using GenericQueue = MPMCQueue<std::uint32_t, lfq::QUEUE_SIZE, false>;
+        using PackedQueue = MPMCQueue<std::uint32_t, lfq::QUEUE_SIZE, true>;
+
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _generic_results;
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _packed_results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            if ((_repeat_index % 2) == 0)
+            {
+                _generic_results[_repeat_index] = RunBenchmarkOnce<GenericQueue>(_thread_pair_count);
+                _packed_results[_repeat_index] = RunBenchmarkOnce<PackedQueue>(_thread_pair_count);
+            }
+            else
+            {
+                _packed_results[_repeat_index] = RunBenchmarkOnce<PackedQueue>(_thread_pair_count);
+                _generic_results[_repeat_index] = RunBenchmarkOnce<GenericQueue>(_thread_pair_count);
+            }
+        }
+
+        std::cout << "\n" << _thread_pair_count << "P / " << _thread_pair_count << "C\n";
+        PrintResult("일반 슬롯", GetMedianResult(_generic_results));
+        PrintResult("packed 슬롯", GetMedianResult(_packed_results));
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "MPMCQueue<uint32_t> 일반 슬롯 vs packed 슬롯 벤치마크\n";
+    std::cout << "큐 크기=" << lfq::QUEUE_SIZE
+              << " | 스레드당 작업=" << lfq::OPERATIONS_PER_THREAD
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
+
+    for (const size_t _thread_pair_count : {1, 2, 4, 8})
+    {
+        RunComparison(_thread_pair_count);
+    }
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
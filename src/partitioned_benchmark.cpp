@@ -0,0 +1,326 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mpmc_queue.h"
+#include "partitioned_queue.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr size_t ItemsPerCase = 1'000'000;
+    constexpr size_t KeyCount = 1024;
+    constexpr size_t ConsumerCount = 4;
+    constexpr size_t ShardSize = 8192;
+    constexpr size_t PartitionCount = 64;
+    constexpr size_t PartitionSize = 1024;
+    constexpr size_t ConsumeBatchSize = 32;
+
+    // 항목 하나를 처리하는 비용을 흉내 내는 반복 수
+    constexpr std::uint32_t WorkIterations = 64;
+
+    struct Item
+    {
+        std::uint32_t _key;
+        std::uint32_t _sequence;
+    };
+
+    using ShardQueue = MPMCQueue<Item, ShardSize>;
+    using KeyPartitionedQueue = PartitionedQueue<Item, PartitionCount, PartitionSize>;
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double items_per_sec;
+        double max_consumer_share;
+        bool valid;
+    };
+
+    // 키 순위 k의 확률이 1 / (k + 1)^_exponent에 비례하는 키 열 (0이면 균등)
+    std::vector<std::uint32_t> MakeZipfKeys(double _exponent)
+    {
+        std::vector<double> _cumulative(KeyCount);
+        double _total = 0.0;
+
+        for (size_t _rank = 0; _rank < KeyCount; ++_rank)
+        {
+            _total += 1.0 / std::pow(static_cast<double>(_rank + 1), _exponent);
+            _cumulative[_rank] = _total;
+        }
+
+        std::mt19937_64 _random(42);
+        std::uniform_real_distribution<double> _distribution(0.0, _total);
+        std::vector<std::uint32_t> _keys(ItemsPerCase);
+
+        for (std::uint32_t& _key : _keys)
+        {
+            const auto _found = std::lower_bound(_cumulative.begin(), _cumulative.end(), _distribution(_random));
+            _key = static_cast<std::uint32_t>(std::min<size_t>(static_cast<size_t>(_found - _cumulative.begin()), KeyCount - 1));
+        }
+
+        return _keys;
+    }
+
+    // 항목 처리: 키별 순서 확인 후 고정 비용의 계산
+    struct ItemProcessor
+    {
+        std::vector<std::int64_t>& _last_sequences;
+        std::atomic<bool>& _reordered;
+        std::uint64_t _processed_count = 0;
+
+        void operator()(Item& _item)
+        {
+            std::int64_t& _last_sequence = _last_sequences[_item._key];
+            if (static_cast<std::int64_t>(_item._sequence) <= _last_sequence)
+            {
+                _reordered.store(true, std::memory_order_relaxed);
+            }
+
+            _last_sequence = _item._sequence;
+
+            volatile std::uint32_t _sink = _item._sequence;
+            for (std::uint32_t i = 0; i < WorkIterations; ++i)
+            {
+                _sink = _sink * 31 + i;
+            }
+
+            ++_processed_count;
+        }
+    };
+
+    BenchmarkResult MakeResult(double _duration_sec, const std::vector<std::uint64_t>& _consumer_counts, bool _valid)
+    {
+        std::uint64_t _total_count = 0;
+        std::uint64_t _max_count = 0;
+
+        for (const std::uint64_t _count : _consumer_counts)
+        {
+            _total_count += _count;
+            _max_count = std::max(_max_count, _count);
+        }
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(ItemsPerCase) / _duration_sec,
+            static_cast<double>(_max_count) / static_cast<double>(_total_count),
+            true == _valid && _total_count == ItemsPerCase};
+    }
+
+    // 정적 샤딩: 키의 샤드를 정해 두고 소비자 하나가 샤드 하나만 처리한다
+    BenchmarkResult RunStaticShardingOnce(const std::vector<std::uint32_t>& _keys)
+    {
+        std::vector<std::unique_ptr<ShardQueue>> _shards;
+        for (size_t i = 0; i < ConsumerCount; ++i)
+        {
+            _shards.push_back(std::make_unique<ShardQueue>());
+        }
+
+        std::vector<std::int64_t> _last_sequences(KeyCount, -1);
+        std::vector<std::uint64_t> _consumer_counts(ConsumerCount, 0);
+        std::array<std::uint64_t, ConsumerCount> _shard_item_counts{};
+        std::atomic<bool> _reordered{false};
+
+        for (const std::uint32_t _key : _keys)
+        {
+            ++_shard_item_counts[lfq::GetPartitionIndex(_key, ConsumerCount)];
+        }
+
+        const auto _start_time = std::chrono::steady_clock::now();
+        std::vector<std::thread> _consumers;
+
+        for (size_t _consumer_index = 0; _consumer_index < ConsumerCount; ++_consumer_index)
+        {
+            _consumers.emplace_back([&, _consumer_index]()
+            {
+                ItemProcessor _processor{_last_sequences, _reordered};
+                ShardQueue& _shard = *_shards[_consumer_index];
+                Item _item{};
+
+                while (_processor._processed_count < _shard_item_counts[_consumer_index])
+                {
+                    if (true == _shard.Pop(_item))
+                    {
+                        _processor(_item);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                _consumer_counts[_consumer_index] = _processor._processed_count;
+            });
+        }
+
+        for (size_t i = 0; i < _keys.size(); ++i)
+        {
+            ShardQueue& _shard = *_shards[lfq::GetPartitionIndex(_keys[i], ConsumerCount)];
+
+            while (false == _shard.Push(Item{_keys[i], static_cast<std::uint32_t>(i)}))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        for (auto& _consumer : _consumers)
+        {
+            _consumer.join();
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+        return MakeResult(_duration_sec, _consumer_counts, false == _reordered.load());
+    }
+
+    // 키 파티션 큐: 어떤 소비자든 준비된 파티션을 가져가 처리한다
+    BenchmarkResult RunPartitionedOnce(const std::vector<std::uint32_t>& _keys)
+    {
+        auto _queue = std::make_unique<KeyPartitionedQueue>();
+
+        std::vector<std::int64_t> _last_sequences(KeyCount, -1);
+        std::vector<std::uint64_t> _consumer_counts(ConsumerCount, 0);
+        std::atomic<std::uint64_t> _remaining_count{ItemsPerCase};
+        std::atomic<bool> _reordered{false};
+
+        const auto _start_time = std::chrono::steady_clock::now();
+        std::vector<std::thread> _consumers;
+
+        for (size_t _consumer_index = 0; _consumer_index < ConsumerCount; ++_consumer_index)
+        {
+            _consumers.emplace_back([&, _consumer_index]()
+            {
+                ItemProcessor _processor{_last_sequences, _reordered};
+
+                while (_remaining_count.load(std::memory_order_relaxed) != 0)
+                {
+                    const size_t _count = _queue->Consume(_processor, ConsumeBatchSize);
+                    if (_count == 0)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    _remaining_count.fetch_sub(_count, std::memory_order_relaxed);
+                }
+
+                _consumer_counts[_consumer_index] = _processor._processed_count;
+            });
+        }
+
+        for (size_t i = 0; i < _keys.size(); ++i)
+        {
+            while (false == _queue->Push(_keys[i], Item{_keys[i], static_cast<std::uint32_t>(i)}))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        for (auto& _consumer : _consumers)
+        {
+            _consumer.join();
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+        return MakeResult(_duration_sec, _consumer_counts, false == _reordered.load());
+    }
+
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.duration_ms < _right.duration_ms;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(9) << _result.duration_ms << " ms | "
+                  << std::setw(12) << _result.items_per_sec << " items/sec | 최대 소비자 몫 "
+                  << _result.max_consumer_share * 100.0 << "% | 키별 순서 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+
+    // 같은 키 열로 정적 샤딩과 키 파티션 큐를 번갈아 세 번 측정하고 중앙값을 출력한다.
+    void RunComparison(double _exponent)
+    {
+        const std::vector<std::uint32_t> _keys = MakeZipfKeys(_exponent);
+
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _static_results;
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _partitioned_results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            if (_repeat_index % 2 == 0)
+            {
+                _static_results[_repeat_index] = RunStaticShardingOnce(_keys);
+                _partitioned_results[_repeat_index] = RunPartitionedOnce(_keys);
+            }
+            else
+            {
+                _partitioned_results[_repeat_index] = RunPartitionedOnce(_keys);
+                _static_results[_repeat_index] = RunStaticShardingOnce(_keys);
+            }
+        }
+
+        const size_t _hottest_key_count = static_cast<size_t>(std::count(_keys.begin(), _keys.end(), 0u));
+
+        // 코어가 소비자 수만큼 있을 때의 임계 경로(직렬로 처리해야 하는 항목 수)
+        // 정적 샤딩은 가장 큰 샤드, 파티션 큐는 균등 분배와 가장 큰 파티션 중 큰 쪽이다
+        std::array<size_t, ConsumerCount> _shard_item_counts{};
+        std::array<size_t, PartitionCount> _partition_item_counts{};
+        for (const std::uint32_t _key : _keys)
+        {
+            ++_shard_item_counts[lfq::GetPartitionIndex(_key, ConsumerCount)];
+            ++_partition_item_counts[lfq::GetPartitionIndex(_key, PartitionCount)];
+        }
+
+        const size_t _static_critical_count = *std::max_element(_shard_item_counts.begin(), _shard_item_counts.end());
+        const size_t _partitioned_critical_count = std::max(ItemsPerCase / ConsumerCount,
+            *std::max_element(_partition_item_counts.begin(), _partition_item_counts.end()));
+
+        std::cout << "\nZipf s=" << std::fixed << std::setprecision(2) << _exponent
+                  << " | 가장 뜨거운 키 비율=" << static_cast<double>(_hottest_key_count) / static_cast<double>(ItemsPerCase) * 100.0 << "%\n";
+        PrintResult("정적 샤딩 (소비자당 샤드 1개)  ", GetMedianResult(_static_results));
+        PrintResult("PartitionedQueue (파티션 64개)", GetMedianResult(_partitioned_results));
+        std::cout << "  임계 경로 (소비자 수만큼 코어가 있을 때): 정적 샤딩 " << _static_critical_count
+                  << "개 | PartitionedQueue " << _partitioned_critical_count << "개\n";
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "키 파티션 소비 vs 정적 샤딩 벤치마크\n";
+    std::cout << "생산자=1 | 소비자=" << ConsumerCount
+              << " | 키=" << KeyCount
+              << " | 경우별 항목=" << ItemsPerCase
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
+    std::cout << "최대 소비자 몫: 가장 많이 처리한 소비자의 비율 (균등하면 " << 100.0 / ConsumerCount << "%)\n";
+
+    for (const double _exponent : {0.0, 0.99, 1.2})
+    {
+        RunComparison(_exponent);
+    }
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// 벤치마크 측정 구간의 하드웨어/소프트웨어 성능 카운터 수집
+// Linux에서는 호출 스레드에 perf_event_open 카운터를 연결한다.
+// 커널이 이벤트를 지원하지 않거나 컨테이너/perf_event_paranoid 설정으로 권한이 없으면
+// 해당 카운터만 사용 불가로 표시되고 벤치마크는 그대로 진행된다.
+// 캐시 라인 전송(HITM 등)은 CPU마다 이벤트 번호가 달라 기본으로 수집하지 않는다.
+// LFQ_PERF_COHERENCE_EVENT 환경 변수에 raw 이벤트 코드(예: Intel 0x04d2)를 주면
+// 해당 이벤트를 CoherenceTransfers 항목으로 수집한다.
+namespace lfq
+{
+    enum class PerfCounter : size_t
+    {
+        Cycles,
+        Instructions,
+        L1DReadMisses,
+        LLCMisses,
+        CoherenceTransfers,
+        ContextSwitches,
+        CpuMigrations,
+        Count
+    };
+
+    constexpr size_t PERF_COUNTER_COUNT = static_cast<size_t>(PerfCounter::Count);
+
+    inline const char* GetPerfCounterName(size_t _index)
+    {
+        constexpr std::array<const char*, PERF_COUNTER_COUNT> _names = {
+            "cycles", "instructions", "L1D-miss", "LLC-miss", "coherence", "ctx-switch", "migration"};
+        return _names[_index];
+    }
+
+    // 스레드 하나의 측정 결과 (사용 불가 카운터는 _valid가 false)
+    struct PerfCounterValues
+    {
+        std::array<std::uint64_t, PERF_COUNTER_COUNT> _values{};
+        std::array<bool, PERF_COUNTER_COUNT> _valid{};
+
+        PerfCounterValues& operator+=(const PerfCounterValues& _other)
+        {
+            for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+            {
+                _values[i] += _other._values[i];
+                _valid[i] = _valid[i] || _other._valid[i];
+            }
+            return *this;
+        }
+
+        bool HasAnyValid() const
+        {
+            for (const bool _counter_valid : _valid)
+            {
+                if (true == _counter_valid)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    // 생성한 스레드에서만 사용해야 하는 카운터 묶음
+    // 각 카운터를 독립적으로 열어 일부 이벤트가 없어도 나머지는 수집된다.
+    class ThreadPerfCounters
+    {
+    public:
+        ThreadPerfCounters()
+        {
+            m_fds.fill(-1);
+
+#if defined(__linux__)
+            Open(PerfCounter::Cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+            Open(PerfCounter::Instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+            Open(PerfCounter::L1DReadMisses, PERF_TYPE_HW_CACHE,
+                 PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+            Open(PerfCounter::LLCMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+            Open(PerfCounter::ContextSwitches, PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES);
+            Open(PerfCounter::CpuMigrations, PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CPU_MIGRATIONS);
+
+            if (const char* _raw_event = std::getenv("LFQ_PERF_COHERENCE_EVENT"))
+            {
+                Open(PerfCounter::CoherenceTransfers, PERF_TYPE_RAW, std::strtoull(_raw_event, nullptr, 0));
+            }
+#endif
+        }
+
+        ~ThreadPerfCounters()
+        {
+#if defined(__linux__)
+            for (const int _fd : m_fds)
+            {
+                if (_fd >= 0)
+                {
+                    close(_fd);
+                }
+            }
+#endif
+        }
+
+        ThreadPerfCounters(ThreadPerfCounters&&) = delete;
+        ThreadPerfCounters(const ThreadPerfCounters&) = delete;
+        ThreadPerfCounters& operator=(ThreadPerfCounters&&) = delete;
+        ThreadPerfCounters& operator=(const ThreadPerfCounters&) = delete;
+
+        void Start()
+        {
+#if defined(__linux__)
+            for (const int _fd : m_fds)
+            {
+                if (_fd >= 0)
+                {
+                    ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+                    ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+#endif
+        }
+
+        PerfCounterValues Stop()
+        {
+            PerfCounterValues _result;
+
+#if defined(__linux__)
+            for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+            {
+                if (m_fds[i] >= 0)
+                {
+                    ioctl(m_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+                }
+            }
+
+            for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+            {
+                // value, time_enabled, time_running
+                std::uint64_t _data[3] = {};
+
+                if (m_fds[i] < 0 || read(m_fds[i], _data, sizeof(_data)) != static_cast<ssize_t>(sizeof(_data)) || _data[2] == 0)
+                {
+                    continue;
+                }
+
+                // PMU보다 많은 카운터를 열어 다중화된 경우 실행 시간 비율로 보정
+                const double _scale = static_cast<double>(_data[1]) / static_cast<double>(_data[2]);
+                _result._values[i] = static_cast<std::uint64_t>(static_cast<double>(_data[0]) * _scale);
+                _result._valid[i] = true;
+            }
+#endif
+
+            return _result;
+        }
+
+    private:
+#if defined(__linux__)
+        void Open(PerfCounter _counter, std::uint32_t _type, std::uint64_t _config)
+        {
+            perf_event_attr _attr{};
+            _attr.size = sizeof(_attr);
+            _attr.type = _type;
+            _attr.config = _config;
+            _attr.disabled = 1;
+            _attr.exclude_hv = 1;
+            _attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            // 커널 구간까지 포함해 시도하고, 권한이 없으면 사용자 구간만 측정
+            int _fd = static_cast<int>(syscall(SYS_perf_event_open, &_attr, 0, -1, -1, 0));
+            if (_fd < 0)
+            {
+                _attr.exclude_kernel = 1;
+                _fd = static_cast<int>(syscall(SYS_perf_event_open, &_attr, 0, -1, -1, 0));
+            }
+
+            m_fds[static_cast<size_t>(_counter)] = _fd;
+        }
+#endif
+
+        std::array<int, PERF_COUNTER_COUNT> m_fds;
+    };
+}
@@ -0,0 +1,476 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mpmc_queue.h"
+#include "mutex_queue.h"
+#include "ring_queue.h"
+#include "thread_cpu_time.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr std::uint64_t PipelineMessageCount = 200'000;
+    constexpr std::uint64_t RoundTripCount = 50'000;
+
+    // 모든 메시지의 지연을 모으면 측정 자체가 결과를 바꾸므로 일부만 기록한다
+    constexpr std::uint64_t LatencySampleInterval = 16;
+
+    // 단계마다 메시지 하나를 처리하는 가짜 작업량 (파싱/로직 흉내)
+    constexpr size_t StageWorkIterations = 100;
+
+    constexpr size_t DefaultCapacity = 1024;
+
+    // 라이브러리의 큐를 같은 모양(템플릿 인자 2개)으로 맞춘다
+    template <typename T, size_t Size>
+    using LockFreeQueue = MPMCQueue<T, Size>;
+
+    struct Message
+    {
+        std::uint64_t _id;
+        std::int64_t _origin_ns; // 소스가 만든 시각
+        std::int64_t _send_ns;   // 현재 hop에 넣은 시각
+        std::uint64_t _payload;
+    };
+
+    std::int64_t NowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    std::uint64_t DoStageWork(std::uint64_t _value)
+    {
+        for (size_t i = 0; i < StageWorkIterations; ++i)
+        {
+            _value = _value * 6364136223846793005ull + 1442695040888963407ull;
+        }
+
+        return _value;
+    }
+
+    // 단계(스레드 하나)의 관찰 결과
+    struct WorkerStats
+    {
+        std::vector<std::int64_t> _latencies_ns; // 입력 hop에서 머문 시간 (소스는 비어 있음)
+        std::vector<std::int64_t> _end_to_end_ns; // 싱크만 사용
+        std::int64_t _cpu_time_ns = 0;
+        std::uint64_t _processed_count = 0;
+        std::uint64_t _checksum = 0;
+    };
+
+    struct StageResult
+    {
+        std::string _name;
+        double _latency_p50_us = 0.0; // 입력 hop의 지연
+        double _latency_p99_us = 0.0;
+        double _cpu_ns_per_message = 0.0;
+    };
+
+    struct BenchmarkResult
+    {
+        double duration_ms = 0.0;
+        double messages_per_sec = 0.0;
+        double latency_p50_us = 0.0; // 종단 간 (ping-pong은 왕복)
+        double latency_p99_us = 0.0;
+        std::vector<StageResult> stages;
+        bool valid = false;
+    };
+
+    double GetPercentileUs(std::vector<std::int64_t>& _samples, double _fraction)
+    {
+        if (true == _samples.empty())
+        {
+            return 0.0;
+        }
+
+        const size_t _index = std::min(_samples.size() - 1, static_cast<size_t>(_fraction * static_cast<double>(_samples.size())));
+        std::nth_element(_samples.begin(), _samples.begin() + static_cast<std::ptrdiff_t>(_index), _samples.end());
+        return static_cast<double>(_samples[_index]) / 1000.0;
+    }
+
+    template <typename QueueType>
+    void PushWithBackoff(QueueType& _queue, const Message& _message)
+    {
+        while (false == _queue.Push(_message))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // 소스 → hop 0 → 단계 1 → hop 1 → ... → 싱크 형태의 파이프라인
+    // _stage_widths[i]는 hop i와 hop i + 1 사이 단계의 스레드 수이며, hop 수는 단계 수 + 1이다.
+    // 선형 파이프라인은 모든 폭이 1이고, fan-out/fan-in은 폭이 1보다 큰 단계를 둔다.
+    template <template <typename, size_t> class QueueTemplate, size_t Capacity>
+    BenchmarkResult RunPipelineOnce(const std::vector<size_t>& _stage_widths)
+    {
+        using QueueType = QueueTemplate<Message, Capacity>;
+
+        const size_t _hop_count = _stage_widths.size() + 1;
+        std::vector<std::unique_ptr<QueueType>> _queues;
+        for (size_t i = 0; i < _hop_count; ++i)
+        {
+            _queues.push_back(std::make_unique<QueueType>());
+        }
+
+        // 단계별 처리 완료 수: 같은 단계의 스레드가 모두 끝날 시점을 판단
+        auto _stage_done = std::make_unique<std::atomic<std::uint64_t>[]>(_stage_widths.size());
+        for (size_t i = 0; i < _stage_widths.size(); ++i)
+        {
+            _stage_done[i].store(0);
+        }
+
+        // [0]: 소스, [1..]: 중간 단계 스레드들, [마지막]: 싱크
+        std::vector<std::vector<WorkerStats>> _stats(_stage_widths.size() + 2);
+        _stats[0].resize(1);
+        for (size_t i = 0; i < _stage_widths.size(); ++i)
+        {
+            _stats[i + 1].resize(_stage_widths[i]);
+        }
+        _stats.back().resize(1);
+
+        std::vector<std::thread> _threads;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        // 싱크
+        _threads.emplace_back([&]()
+        {
+            WorkerStats& _worker = _stats.back()[0];
+            QueueType& _input = *_queues.back();
+            const std::int64_t _cpu_start_ns = lfq::GetThreadCpuTimeNs();
+            Message _message{};
+
+            while (_worker._processed_count < PipelineMessageCount)
+            {
+                if (false == _input.Pop(_message))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                if (_message._id % LatencySampleInterval == 0)
+                {
+                    const std::int64_t _now = NowNs();
+                    _worker._latencies_ns.push_back(_now - _message._send_ns);
+                    _worker._end_to_end_ns.push_back(_now - _message._origin_ns);
+                }
+
+                _worker._checksum += _message._payload;
+                ++_worker._processed_count;
+            }
+
+            _worker._cpu_time_ns = lfq::GetThreadCpuTimeNs() - _cpu_start_ns;
+        });
+
+        // 중간 단계
+        for (size_t _stage = 0; _stage < _stage_widths.size(); ++_stage)
+        {
+            for (size_t _worker_index = 0; _worker_index < _stage_widths[_stage]; ++_worker_index)
+            {
+                _threads.emplace_back([&, _stage, _worker_index]()
+                {
+                    WorkerStats& _worker = _stats[_stage + 1][_worker_index];
+                    QueueType& _input = *_queues[_stage];
+                    QueueType& _output = *_queues[_stage + 1];
+                    std::atomic<std::uint64_t>& _done = _stage_done[_stage];
+                    const std::int64_t _cpu_start_ns = lfq::GetThreadCpuTimeNs();
+                    Message _message{};
+
+                    while (_done.load(std::memory_order_relaxed) < PipelineMessageCount)
+                    {
+                        if (false == _input.Pop(_message))
+                        {
+                            std::this_thread::yield();
+                            continue;
+                        }
+
+                        const std::int64_t _now = NowNs();
+                        if (_message._id % LatencySampleInterval == 0)
+                        {
+                            _worker._latencies_ns.push_back(_now - _message._send_ns);
+                        }
+
+                        // 작업 결과가 최적화로 사라지지 않게 단계 체크섬에 더하고, payload는 그대로 전달한다
+                        _worker._checksum += DoStageWork(_message._payload) & 1;
+                        _message._send_ns = NowNs();
+                        PushWithBackoff(_output, _message);
+
+                        ++_worker._processed_count;
+                        _done.fetch_add(1, std::memory_order_relaxed);
+                    }
+
+                    _worker._cpu_time_ns = lfq::GetThreadCpuTimeNs() - _cpu_start_ns;
+                });
+            }
+        }
+
+        // 소스
+        _threads.emplace_back([&]()
+        {
+            WorkerStats& _worker = _stats[0][0];
+            QueueType& _output = *_queues[0];
+            const std::int64_t _cpu_start_ns = lfq::GetThreadCpuTimeNs();
+
+            for (std::uint64_t _id = 0; _id < PipelineMessageCount; ++_id)
+            {
+                const std::int64_t _now = NowNs();
+                PushWithBackoff(_output, Message{_id, _now, _now, _id});
+                ++_worker._processed_count;
+            }
+
+            _worker._cpu_time_ns = lfq::GetThreadCpuTimeNs() - _cpu_start_ns;
+        });
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        BenchmarkResult _result;
+        _result.duration_ms = _duration_sec * 1000.0;
+        _result.messages_per_sec = static_cast<double>(PipelineMessageCount) / _duration_sec;
+
+        for (size_t _stage = 0; _stage < _stats.size(); ++_stage)
+        {
+            WorkerStats _merged;
+            for (WorkerStats& _worker : _stats[_stage])
+            {
+                _merged._latencies_ns.insert(_merged._latencies_ns.end(), _worker._latencies_ns.begin(), _worker._latencies_ns.end());
+                _merged._cpu_time_ns += _worker._cpu_time_ns;
+                _merged._processed_count += _worker._processed_count;
+            }
+
+            StageResult _stage_result;
+            if (_stage == 0)
+            {
+                _stage_result._name = "소스";
+            }
+            else if (_stage + 1 == _stats.size())
+            {
+                _stage_result._name = "싱크";
+            }
+            else
+            {
+                _stage_result._name = "단계 " + std::to_string(_stage) + " (x" + std::to_string(_stats[_stage].size()) + ")";
+            }
+
+            _stage_result._latency_p50_us = GetPercentileUs(_merged._latencies_ns, 0.5);
+            _stage_result._latency_p99_us = GetPercentileUs(_merged._latencies_ns, 0.99);
+            _stage_result._cpu_ns_per_message = static_cast<double>(_merged._cpu_time_ns) / static_cast<double>(PipelineMessageCount);
+            _result.stages.push_back(_stage_result);
+        }
+
+        WorkerStats& _sink = _stats.back()[0];
+        _result.latency_p50_us = GetPercentileUs(_sink._end_to_end_ns, 0.5);
+        _result.latency_p99_us = GetPercentileUs(_sink._end_to_end_ns, 0.99);
+        _result.valid = _sink._processed_count == PipelineMessageCount && _sink._checksum == PipelineMessageCount * (PipelineMessageCount - 1) / 2;
+        return _result;
+    }
+
+    // 요청 큐와 응답 큐로 메시지 하나를 주고받아 왕복 지연을 잰다.
+    template <template <typename, size_t> class QueueTemplate, size_t Capacity>
+    BenchmarkResult RunPingPongOnce(const std::vector<size_t>&)
+    {
+        using QueueType = QueueTemplate<Message, Capacity>;
+
+        auto _requests = std::make_unique<QueueType>();
+        auto _replies = std::make_unique<QueueType>();
+        std::array<WorkerStats, 2> _stats;
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::thread _responder([&]()
+        {
+            WorkerStats& _worker = _stats[1];
+            const std::int64_t _cpu_start_ns = lfq::GetThreadCpuTimeNs();
+            Message _message{};
+
+            while (_worker._processed_count < RoundTripCount)
+            {
+                if (false == _requests->Pop(_message))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                const std::int64_t _now = NowNs();
+                _worker._latencies_ns.push_back(_now - _message._send_ns);
+                _message._send_ns = _now;
+                PushWithBackoff(*_replies, _message);
+                ++_worker._processed_count;
+            }
+
+            _worker._cpu_time_ns = lfq::GetThreadCpuTimeNs() - _cpu_start_ns;
+        });
+
+        {
+            WorkerStats& _worker = _stats[0];
+            const std::int64_t _cpu_start_ns = lfq::GetThreadCpuTimeNs();
+            Message _message{};
+
+            for (std::uint64_t _id = 0; _id < RoundTripCount; ++_id)
+            {
+                const std::int64_t _now = NowNs();
+                PushWithBackoff(*_requests, Message{_id, _now, _now, _id});
+
+                while (false == _replies->Pop(_message))
+                {
+                    std::this_thread::yield();
+                }
+
+                const std::int64_t _reply_time = NowNs();
+                _worker._latencies_ns.push_back(_reply_time - _message._send_ns);
+                _worker._end_to_end_ns.push_back(_reply_time - _message._origin_ns);
+                _worker._checksum += _message._payload;
+                ++_worker._processed_count;
+            }
+
+            _worker._cpu_time_ns = lfq::GetThreadCpuTimeNs() - _cpu_start_ns;
+        }
+
+        _responder.join();
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        BenchmarkResult _result;
+        _result.duration_ms = _duration_sec * 1000.0;
+        _result.messages_per_sec = static_cast<double>(RoundTripCount) / _duration_sec;
+        _result.latency_p50_us = GetPercentileUs(_stats[0]._end_to_end_ns, 0.5);
+        _result.latency_p99_us = GetPercentileUs(_stats[0]._end_to_end_ns, 0.99);
+
+        const std::array<const char*, 2> _names = {"요청자 (응답 hop)", "응답자 (요청 hop)"};
+        for (size_t i = 0; i < _stats.size(); ++i)
+        {
+            StageResult _stage_result;
+            _stage_result._name = _names[i];
+            _stage_result._latency_p50_us = GetPercentileUs(_stats[i]._latencies_ns, 0.5);
+            _stage_result._latency_p99_us = GetPercentileUs(_stats[i]._latencies_ns, 0.99);
+            _stage_result._cpu_ns_per_message = static_cast<double>(_stats[i]._cpu_time_ns) / static_cast<double>(RoundTripCount);
+            _result.stages.push_back(_stage_result);
+        }
+
+        _result.valid = _stats[0]._checksum == RoundTripCount * (RoundTripCount - 1) / 2;
+        return _result;
+    }
+
+    using ScenarioFunction = BenchmarkResult (*)(const std::vector<size_t>&);
+
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.duration_ms < _right.duration_ms;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(9) << _result.duration_ms << " ms | "
+                  << std::setw(12) << _result.messages_per_sec << " messages/sec | 종단 지연 p50 "
+                  << _result.latency_p50_us << " us, p99 "
+                  << _result.latency_p99_us << " us | 검증 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+
+        for (const StageResult& _stage : _result.stages)
+        {
+            std::cout << "      " << std::left << std::setw(24) << _stage._name << std::right
+                      << " 입력 hop p50 " << std::setw(9) << _stage._latency_p50_us << " us, p99 "
+                      << std::setw(9) << _stage._latency_p99_us << " us | CPU "
+                      << std::setw(8) << _stage._cpu_ns_per_message << " ns/message\n";
+        }
+    }
+
+    // 같은 토폴로지를 큐 종류마다 번갈아 세 번 측정하고 각각의 중앙값을 출력한다.
+    template <size_t CaseCount>
+    void RunScenario(const char* _scenario_name, const std::vector<size_t>& _stage_widths,
+                     const std::array<const char*, CaseCount>& _case_names, const std::array<ScenarioFunction, CaseCount>& _cases)
+    {
+        std::array<std::array<BenchmarkResult, BenchmarkRepeatCount>, CaseCount> _results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            // 측정 순서에 따른 편향을 줄이기 위해 반복마다 시작 경우를 바꾼다
+            for (size_t _offset = 0; _offset < CaseCount; ++_offset)
+            {
+                const size_t _case_index = (_repeat_index + _offset) % CaseCount;
+                _results[_case_index][_repeat_index] = _cases[_case_index](_stage_widths);
+            }
+        }
+
+        std::cout << '\n' << _scenario_name << '\n';
+        for (size_t _case_index = 0; _case_index < CaseCount; ++_case_index)
+        {
+            PrintResult(_case_names[_case_index], GetMedianResult(_results[_case_index]));
+        }
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "다단계 파이프라인 토폴로지 벤치마크\n";
+    std::cout << "파이프라인 메시지=" << PipelineMessageCount
+              << " | 왕복=" << RoundTripCount
+              << " | 단계 작업=" << StageWorkIterations << "회"
+              << " | 지연 샘플=1/" << LatencySampleInterval
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
+
+    // 한 단계에 스레드가 하나뿐인 선형 파이프라인은 SPSC 링도 사용할 수 있다
+    const std::array<const char*, 4> _linear_names = {"MPMCQueue    ", "SPSCRingQueue", "MPMCRingQueue", "MutexQueue   "};
+    const std::array<ScenarioFunction, 4> _linear_cases = {
+        RunPipelineOnce<LockFreeQueue, DefaultCapacity>,
+        RunPipelineOnce<SPSCRingQueue, DefaultCapacity>,
+        RunPipelineOnce<MPMCRingQueue, DefaultCapacity>,
+        RunPipelineOnce<MutexQueue, DefaultCapacity>};
+
+    RunScenario("선형 3 hop (소스 → 파싱 → 로직 → 싱크), 용량=1024", {1, 1}, _linear_names, _linear_cases);
+    RunScenario("선형 5 hop (소스 → 4단계 → 싱크), 용량=1024", {1, 1, 1, 1}, _linear_names, _linear_cases);
+
+    const std::array<const char*, 3> _fan_names = {"MPMCQueue    ", "MPMCRingQueue", "MutexQueue   "};
+    const std::array<ScenarioFunction, 3> _fan_cases = {
+        RunPipelineOnce<LockFreeQueue, DefaultCapacity>,
+        RunPipelineOnce<MPMCRingQueue, DefaultCapacity>,
+        RunPipelineOnce<MutexQueue, DefaultCapacity>};
+
+    RunScenario("fan-out/fan-in (소스 → 작업 스레드 4 → 싱크), 용량=1024", {4}, _fan_names, _fan_cases);
+
+    const std::array<const char*, 4> _capacity_names = {"MPMCQueue 16  ", "MPMCQueue 256 ", "MPMCQueue 1024", "MPMCQueue 8192"};
+    const std::array<ScenarioFunction, 4> _capacity_cases = {
+        RunPipelineOnce<LockFreeQueue, 16>,
+        RunPipelineOnce<LockFreeQueue, 256>,
+        RunPipelineOnce<LockFreeQueue, 1024>,
+        RunPipelineOnce<LockFreeQueue, 8192>};
+
+    RunScenario("hop 용량 영향 (선형 3 hop)", {1, 1}, _capacity_names, _capacity_cases);
+
+    const std::array<ScenarioFunction, 4> _ping_pong_cases = {
+        RunPingPongOnce<LockFreeQueue, DefaultCapacity>,
+        RunPingPongOnce<SPSCRingQueue, DefaultCapacity>,
+        RunPingPongOnce<MPMCRingQueue, DefaultCapacity>,
+        RunPingPongOnce<MutexQueue, DefaultCapacity>};
+
+    RunScenario("ping-pong 왕복 (메시지 1개 순환)", {}, _linear_names, _ping_pong_cases);
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
@@ -0,0 +1,299 @@
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "mpmc_queue.h"
+#include "queue_notifier.h"
+
+namespace
+{
+    // Push마다 시스템 호출을 하는 비교 대상이 있으므로 기본 벤치마크보다 작업 수를 줄인다.
+    constexpr size_t MessagesPerProducer = 1'000'000;
+    constexpr size_t LatencySampleCount = 10'000;
+    constexpr auto LatencySendInterval = std::chrono::microseconds(100);
+
+    using QueueType = MPMCQueue<std::int64_t, lfq::QUEUE_SIZE>;
+
+    std::int64_t NowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // 비교 대상: Push마다 eventfd에 쓰고, 깨어날 때마다 읽은 뒤 큐를 비운다.
+    struct NaiveScenario
+    {
+        std::unique_ptr<QueueType> m_queue = std::make_unique<QueueType>();
+        int m_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        std::atomic<size_t> m_write_count{0};
+        size_t m_read_count = 0;
+
+        ~NaiveScenario() { close(m_fd); }
+
+        int GetFd() const { return m_fd; }
+
+        bool Push(std::int64_t _value)
+        {
+            if (false == m_queue->Push(_value))
+            {
+                return false;
+            }
+
+            const std::uint64_t _signal = 1;
+            m_write_count.fetch_add(1, std::memory_order_relaxed);
+            [[maybe_unused]] const ssize_t _result = write(m_fd, &_signal, sizeof(_signal));
+            return true;
+        }
+
+        template <typename Handler>
+        void Drain(Handler&& _handler)
+        {
+            std::uint64_t _signal = 0;
+            ++m_read_count;
+            [[maybe_unused]] const ssize_t _result = read(m_fd, &_signal, sizeof(_signal));
+
+            std::int64_t _value = 0;
+            while (true == m_queue->Pop(_value))
+            {
+                _handler(_value);
+            }
+        }
+
+        size_t GetWriteCount() const { return m_write_count.load(std::memory_order_relaxed); }
+        size_t GetReadCount() const { return m_read_count; }
+    };
+
+    // QueueNotifier: 소비자가 잠들겠다고 알린 경우에만 eventfd에 쓴다.
+    struct NotifierScenario
+    {
+        std::unique_ptr<QueueType> m_queue = std::make_unique<QueueType>();
+        QueueNotifier m_notifier;
+
+        int GetFd() const { return m_notifier.GetFd(); }
+
+        bool Push(std::int64_t _value) { return PushAndNotify(*m_queue, m_notifier, _value); }
+
+        template <typename Handler>
+        void Drain(Handler&& _handler) { DrainQueue(*m_queue, m_notifier, _handler); }
+
+        size_t GetWriteCount() const { return m_notifier.GetWriteCount(); }
+        size_t GetReadCount() const { return m_notifier.GetReadCount(); }
+    };
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double messages_per_sec;
+        double syscalls_per_message;
+        size_t write_count;
+        size_t read_count;
+        size_t epoll_wait_count;
+        double latency_p50_us;
+        double latency_p99_us;
+        bool valid;
+    };
+
+    double GetPercentileUs(const std::vector<std::int64_t>& _sorted_latencies_ns, double _percentile)
+    {
+        if (true == _sorted_latencies_ns.empty())
+        {
+            return 0.0;
+        }
+
+        const size_t _index = static_cast<size_t>(_percentile * static_cast<double>(_sorted_latencies_ns.size() - 1));
+        return static_cast<double>(_sorted_latencies_ns[_index]) / 1000.0;
+    }
+
+    // epoll 루프 소비자: 큐를 비우고, 다 받지 못했으면 epoll_wait로 잠든다.
+    template <typename ScenarioType, typename Handler>
+    size_t RunEpollConsumer(ScenarioType& _scenario, size_t _message_count, Handler&& _handler)
+    {
+        const int _epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (_epoll_fd < 0)
+        {
+            throw std::system_error(errno, std::generic_category(), "epoll 생성 실패");
+        }
+
+        epoll_event _event{};
+        _event.events = EPOLLIN;
+        epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _scenario.GetFd(), &_event);
+
+        size_t _received_count = 0;
+        size_t _epoll_wait_count = 0;
+
+        while (true)
+        {
+            _scenario.Drain([&_received_count, &_handler](std::int64_t _value)
+            {
+                _handler(_value);
+                ++_received_count;
+            });
+
+            if (_received_count >= _message_count)
+            {
+                break;
+            }
+
+            epoll_event _ready{};
+            ++_epoll_wait_count;
+            epoll_wait(_epoll_fd, &_ready, 1, -1);
+        }
+
+        close(_epoll_fd);
+        return _epoll_wait_count;
+    }
+
+    // 생산자들이 쉬지 않고 Push할 때 처리량과 메시지당 시스템 호출 수를 측정한다.
+    template <typename ScenarioType>
+    BenchmarkResult RunThroughputBenchmark(size_t _producer_count)
+    {
+        auto _scenario = std::make_unique<ScenarioType>();
+        const size_t _message_count = _producer_count * MessagesPerProducer;
+        std::int64_t _checksum = 0;
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> _producers;
+        for (size_t _producer_index = 0; _producer_index < _producer_count; ++_producer_index)
+        {
+            _producers.emplace_back([&_scenario, _producer_index]()
+            {
+                const std::int64_t _base = static_cast<std::int64_t>(_producer_index * MessagesPerProducer);
+
+                for (std::int64_t _offset = 0; _offset < static_cast<std::int64_t>(MessagesPerProducer); ++_offset)
+                {
+                    while (false == _scenario->Push(_base + _offset))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        const size_t _epoll_wait_count = RunEpollConsumer(*_scenario, _message_count, [&_checksum](std::int64_t _value) { _checksum += _value; });
+
+        for (auto& _producer : _producers)
+        {
+            _producer.join();
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+        const std::int64_t _message_count64 = static_cast<std::int64_t>(_message_count);
+        const size_t _syscall_count = _scenario->GetWriteCount() + _scenario->GetReadCount() + _epoll_wait_count;
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(_message_count) / _duration_sec,
+            static_cast<double>(_syscall_count) / static_cast<double>(_message_count),
+            _scenario->GetWriteCount(),
+            _scenario->GetReadCount(),
+            _epoll_wait_count,
+            0.0,
+            0.0,
+            _checksum == (_message_count64 * (_message_count64 - 1)) / 2};
+    }
+
+    // 생산자가 간격을 두고 하나씩 보내 소비자가 매번 잠든 상태에서 깨어나는 지연 시간을 측정한다.
+    template <typename ScenarioType>
+    BenchmarkResult RunWakeupLatencyBenchmark()
+    {
+        auto _scenario = std::make_unique<ScenarioType>();
+        std::vector<std::int64_t> _latencies_ns;
+        _latencies_ns.reserve(LatencySampleCount);
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::thread _producer([&_scenario]()
+        {
+            for (size_t _sample_index = 0; _sample_index < LatencySampleCount; ++_sample_index)
+            {
+                std::this_thread::sleep_for(LatencySendInterval);
+
+                while (false == _scenario->Push(NowNs()))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        const size_t _epoll_wait_count = RunEpollConsumer(*_scenario, LatencySampleCount, [&_latencies_ns](std::int64_t _enqueue_ns)
+        {
+            _latencies_ns.push_back(NowNs() - _enqueue_ns);
+        });
+
+        _producer.join();
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+        const size_t _syscall_count = _scenario->GetWriteCount() + _scenario->GetReadCount() + _epoll_wait_count;
+
+        std::sort(_latencies_ns.begin(), _latencies_ns.end());
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(LatencySampleCount) / _duration_sec,
+            static_cast<double>(_syscall_count) / static_cast<double>(LatencySampleCount),
+            _scenario->GetWriteCount(),
+            _scenario->GetReadCount(),
+            _epoll_wait_count,
+            GetPercentileUs(_latencies_ns, 0.50),
+            GetPercentileUs(_latencies_ns, 0.99),
+            _latencies_ns.size() == LatencySampleCount};
+    }
+
+    void PrintThroughputResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << _result.duration_ms << " ms | "
+                  << _result.messages_per_sec << " messages/sec | 메시지당 시스템 호출="
+                  << std::setprecision(4) << _result.syscalls_per_message
+                  << " (write=" << _result.write_count
+                  << ", read=" << _result.read_count
+                  << ", epoll_wait=" << _result.epoll_wait_count << ") | 체크섬 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+
+    void PrintLatencyResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << "깨우기 지연 p50=" << _result.latency_p50_us
+                  << " us, p99=" << _result.latency_p99_us
+                  << " us | 메시지당 시스템 호출=" << std::setprecision(4) << _result.syscalls_per_message
+                  << " | 수신 " << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+}
+
+int main()
+{
+    std::cout << "eventfd 알림: Push마다 write vs QueueNotifier 벤치마크\n";
+    std::cout << "큐 크기=" << lfq::QUEUE_SIZE
+              << " | 생산자당 메시지=" << MessagesPerProducer
+              << " | 지연 표본=" << LatencySampleCount
+              << " (간격 " << LatencySendInterval.count() << " us)\n";
+
+    for (const size_t _producer_count : {1, 4})
+    {
+        std::cout << "\n처리량: " << _producer_count << "P / 1C (epoll 소비자)\n";
+        PrintThroughputResult("Push마다 write", RunThroughputBenchmark<NaiveScenario>(_producer_count));
+        PrintThroughputResult("QueueNotifier", RunThroughputBenchmark<NotifierScenario>(_producer_count));
+    }
+
+    std::cout << "\n깨우기 지연: 1P / 1C (매 메시지마다 소비자가 잠든 상태)\n";
+    PrintLatencyResult("Push마다 write", RunWakeupLatencyBenchmark<NaiveScenario>());
+    PrintLatencyResult("QueueNotifier", RunWakeupLatencyBenchmark<NotifierScenario>());
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mpmc_queue.h"
+#include "mutex_queue.h"
+#include "queue_telemetry.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr std::uint64_t ItemsPerCase = 4'000'000;
+
+    // 일반적인 주기(1ms)와 운영 환경보다 훨씬 촘촘한 주기(100us)를 함께 측정한다
+    constexpr auto CoarseSampleInterval = std::chrono::microseconds(1000);
+    constexpr auto FineSampleInterval = std::chrono::microseconds(100);
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double messages_per_sec;
+        std::uint64_t sample_count;
+        size_t high_water_mark;
+        bool valid;
+    };
+
+    // _sample_interval이 0이면 텔레메트리를 켜지 않는다
+    template <typename QueueType>
+    BenchmarkResult RunBenchmarkOnce(size_t _thread_pair_count, std::chrono::microseconds _sample_interval)
+    {
+        auto _queue = std::make_unique<QueueType>();
+        std::atomic<std::uint64_t> _remaining_count{ItemsPerCase};
+        std::atomic<std::uint64_t> _checksum{0};
+
+        QueueTelemetry _telemetry;
+        if (_sample_interval.count() != 0)
+        {
+            _telemetry.Register("benchmark", *_queue);
+            _telemetry.Start(_sample_interval);
+        }
+
+        const std::uint64_t _items_per_producer = ItemsPerCase / _thread_pair_count;
+        std::vector<std::thread> _threads;
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        for (size_t _thread_index = 0; _thread_index < _thread_pair_count; ++_thread_index)
+        {
+            _threads.emplace_back([&_queue, _thread_index, _items_per_producer]()
+            {
+                const std::uint64_t _first_value = _thread_index * _items_per_producer;
+
+                for (std::uint64_t _value = _first_value; _value < _first_value + _items_per_producer; ++_value)
+                {
+                    while (false == _queue->Push(_value))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+            _threads.emplace_back([&_queue, &_remaining_count, &_checksum]()
+            {
+                std::uint64_t _local_checksum = 0;
+                std::uint64_t _value = 0;
+
+                while (_remaining_count.load(std::memory_order_relaxed) != 0)
+                {
+                    if (true == _queue->Pop(_value))
+                    {
+                        _remaining_count.fetch_sub(1, std::memory_order_relaxed);
+                        _local_checksum += _value;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                _checksum.fetch_add(_local_checksum, std::memory_order_relaxed);
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        _telemetry.Stop();
+        const auto _snapshots = _telemetry.GetSnapshot();
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(ItemsPerCase) / _duration_sec,
+            true == _snapshots.empty() ? 0 : _snapshots[0]._sample_count,
+            true == _snapshots.empty() ? 0 : _snapshots[0]._high_water_mark,
+            _checksum.load() == ItemsPerCase * (ItemsPerCase - 1) / 2};
+    }
+
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.duration_ms < _right.duration_ms;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(10) << _result.duration_ms << " ms | "
+                  << std::setw(14) << _result.messages_per_sec << " messages/sec | 샘플 "
+                  << _result.sample_count << " | 최고 수위 " << _result.high_water_mark << " | 체크섬 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+
+    // 텔레메트리 끔, 1ms 주기, 100us 주기를 번갈아 세 번 측정하고 각각의 중앙값을 출력한다.
+    template <typename QueueType>
+    void RunComparison(const char* _queue_name, size_t _thread_pair_count)
+    {
+        constexpr size_t CaseCount = 3;
+        const std::array<std::chrono::microseconds, CaseCount> _intervals = {std::chrono::microseconds(0), CoarseSampleInterval, FineSampleInterval};
+        const std::array<const char*, CaseCount> _case_names = {"텔레메트리 끔", "텔레메트리 1ms", "텔레메트리 100us"};
+        std::array<std::array<BenchmarkResult, BenchmarkRepeatCount>, CaseCount> _results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            // 측정 순서에 따른 편향을 줄이기 위해 반복마다 시작 경우를 바꾼다
+            for (size_t _offset = 0; _offset < CaseCount; ++_offset)
+            {
+                const size_t _case_index = (_repeat_index + _offset) % CaseCount;
+                _results[_case_index][_repeat_index] = RunBenchmarkOnce<QueueType>(_thread_pair_count, _intervals[_case_index]);
+            }
+        }
+
+        std::cout << "\n" << _queue_name << " " << _thread_pair_count << "P / " << _thread_pair_count << "C\n";
+
+        const BenchmarkResult _off = GetMedianResult(_results[0]);
+        PrintResult(_case_names[0], _off);
+
+        for (size_t _case_index = 1; _case_index < CaseCount; ++_case_index)
+        {
+            const BenchmarkResult _on = GetMedianResult(_results[_case_index]);
+            PrintResult(_case_names[_case_index], _on);
+            std::cout << "    처리량 변화: " << std::showpos << (_on.messages_per_sec / _off.messages_per_sec - 1.0) * 100.0
+                      << std::noshowpos << "%\n";
+        }
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "QueueTelemetry 켬/끔 오버헤드 벤치마크\n";
+    std::cout << "큐 크기=" << lfq::QUEUE_SIZE
+              << " | 경우별 항목=" << ItemsPerCase
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
+
+    for (const size_t _thread_pair_count : {1, 4})
+    {
+        RunComparison<MPMCQueue<std::uint64_t, lfq::QUEUE_SIZE>>("MPMCQueue", _thread_pair_count);
+        RunComparison<MutexQueue<std::uint64_t, lfq::QUEUE_SIZE>>("MutexQueue", _thread_pair_count);
+    }
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
@@ -0,0 +1,661 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "flat_combining_queue.h"
+#include "mpmc_queue.h"
+#include "mutex_queue.h"
+#include "spsc_queue.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr size_t ConfirmCandidateCount = 3;
+
+    // 처리량이 요청한 도착률의 이 비율 이상이면 도착률을 감당한 것으로 본다
+    constexpr double OfferedRateTolerance = 0.95;
+
+    enum class WaitPolicy
+    {
+        Spin,    // 바로 재시도
+        Yield,   // 매번 양보
+        Backoff  // 짧게 돌다가 양보하고, 오래 실패하면 잠든다
+    };
+
+    constexpr std::array<WaitPolicy, 3> WaitPolicies = {WaitPolicy::Spin, WaitPolicy::Yield, WaitPolicy::Backoff};
+
+    const char* GetWaitPolicyName(WaitPolicy _wait_policy)
+    {
+        switch (_wait_policy)
+        {
+        case WaitPolicy::Spin:
+            return "Spin";
+        case WaitPolicy::Yield:
+            return "Yield";
+        default:
+            return "Backoff";
+        }
+    }
+
+    // Push/Pop이 실패했을 때 재시도 전 대기. 성공하면 Reset으로 단계를 되돌린다.
+    class Waiter
+    {
+    public:
+        explicit Waiter(WaitPolicy _wait_policy) noexcept : m_wait_policy(_wait_policy) {}
+
+        void Wait() noexcept
+        {
+            if (m_wait_policy == WaitPolicy::Yield)
+            {
+                std::this_thread::yield();
+            }
+            else if (m_wait_policy == WaitPolicy::Backoff)
+            {
+                if (m_failure_count < 6)
+                {
+                    for (size_t i = 0; i < (size_t{1} << m_failure_count); ++i)
+                    {
+                        m_spin_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+                else if (m_failure_count < 16)
+                {
+                    std::this_thread::yield();
+                }
+                else
+                {
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+
+                ++m_failure_count;
+            }
+        }
+
+        void Reset() noexcept { m_failure_count = 0; }
+
+    private:
+        const WaitPolicy m_wait_policy;
+        size_t m_failure_count = 0;
+
+        // 회전 루프가 최적화로 사라지지 않게 하는 스레드 지역 카운터
+        std::atomic<size_t> m_spin_count{0};
+    };
+
+    // 튜닝할 작업 부하
+    struct WorkloadDescription
+    {
+        size_t producer_count = 1;
+        size_t consumer_count = 1;
+        size_t payload_bytes = 64;
+        double offered_rate = 0.0;       // 전체 도착률 (items/sec), 0이면 최대 속도
+        double percentile = 0.99;        // 비교할 지연 백분위
+        double target_latency_us = 0.0;  // 백분위 지연 목표, 0이면 없음
+        size_t trial_ms = 100;           // 후보 하나의 측정 시간
+        std::string output_path;         // 추천 설정을 쓸 파일, 비어 있으면 쓰지 않음
+    };
+
+    // 앞 16바이트는 측정용 (도착 예정 시각과 순번)
+    template <size_t Bytes>
+    struct Payload
+    {
+        static_assert(Bytes > 2 * sizeof(std::uint64_t));
+
+        std::uint64_t _send_ns;
+        std::uint64_t _sequence;
+        char _body[Bytes - 2 * sizeof(std::uint64_t)];
+    };
+
+    // SPSC_Q는 int64 하나만 나르므로 도착 예정 시각만 전달한다 (항목 8바이트 이하일 때만 후보)
+    template <size_t Capacity>
+    class SpscAdapter
+    {
+    public:
+        template <typename Item>
+        bool Push(const Item& _item) noexcept { return m_queue.push(static_cast<std::int64_t>(_item._send_ns)); }
+
+        template <typename Item>
+        bool Pop(Item& _item) noexcept
+        {
+            const std::optional<std::int64_t> _value = m_queue.pop();
+            if (false == _value.has_value())
+            {
+                return false;
+            }
+
+            _item._send_ns = static_cast<std::uint64_t>(*_value);
+            return true;
+        }
+
+    private:
+        SPSC_Q m_queue{Capacity};
+    };
+
+    struct TrialResult
+    {
+        double items_per_sec;
+        double p50_latency_us;
+        double percentile_latency_us;
+        double max_latency_us;
+        size_t push_retry_count;
+        bool valid;
+    };
+
+    using TrialFunction = TrialResult (*)(const WorkloadDescription&, WaitPolicy);
+
+    struct Candidate
+    {
+        const char* queue_name;
+        size_t capacity;
+        WaitPolicy wait_policy;
+        TrialFunction run;
+        TrialResult result;
+    };
+
+    std::uint64_t GetElapsedNs(std::chrono::steady_clock::time_point _start_time)
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start_time).count());
+    }
+
+    // 예정 시각까지 기다린다. 멀면 잠들고 가까우면 양보하며 확인한다.
+    void WaitUntil(std::chrono::steady_clock::time_point _start_time, std::uint64_t _target_ns)
+    {
+        while (true)
+        {
+            const std::uint64_t _now_ns = GetElapsedNs(_start_time);
+            if (_now_ns >= _target_ns)
+            {
+                return;
+            }
+
+            if (_target_ns - _now_ns > 200'000)
+            {
+                std::this_thread::sleep_for(std::chrono::nanoseconds(_target_ns - _now_ns - 100'000));
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    double GetPercentileUs(std::vector<std::uint64_t>& _sorted_latencies, double _fraction)
+    {
+        if (true == _sorted_latencies.empty())
+        {
+            return 0.0;
+        }
+
+        const size_t _index = std::min(_sorted_latencies.size() - 1, static_cast<size_t>(_fraction * static_cast<double>(_sorted_latencies.size())));
+        return static_cast<double>(_sorted_latencies[_index]) / 1000.0;
+    }
+
+    // 후보 하나를 trial_ms 동안 실행한다.
+    // 도착률이 주어지면 생산자는 예정 시각에 맞춰 넣고, 지연은 예정 시각부터 Pop까지로 잰다 (밀린 시간 포함).
+    template <typename QueueType, typename Item>
+    TrialResult RunTrial(const WorkloadDescription& _workload, WaitPolicy _wait_policy)
+    {
+        auto _queue = std::make_unique<QueueType>();
+
+        const std::uint64_t _duration_ns = static_cast<std::uint64_t>(_workload.trial_ms) * 1'000'000;
+        const double _interval_ns = _workload.offered_rate > 0.0 ? 1e9 * static_cast<double>(_workload.producer_count) / _workload.offered_rate : 0.0;
+
+        std::atomic<size_t> _ready_count{0};
+        std::atomic<bool> _start{false};
+        std::atomic<bool> _producers_done{false};
+        std::atomic<size_t> _pushed_count{0};
+        std::atomic<size_t> _push_retry_count{0};
+        std::chrono::steady_clock::time_point _start_time;
+
+        std::vector<std::vector<std::uint64_t>> _latencies(_workload.consumer_count);
+        std::vector<std::thread> _producers;
+        std::vector<std::thread> _consumers;
+
+        for (size_t _producer_index = 0; _producer_index < _workload.producer_count; ++_producer_index)
+        {
+            _producers.emplace_back([&]()
+            {
+                Waiter _waiter(_wait_policy);
+                Item _item{};
+                size_t _local_count = 0;
+                size_t _local_retry_count = 0;
+
+                _ready_count.fetch_add(1);
+                while (false == _start.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                while (true)
+                {
+                    std::uint64_t _send_ns = 0;
+                    if (_interval_ns > 0.0)
+                    {
+                        _send_ns = static_cast<std::uint64_t>(_interval_ns * static_cast<double>(_local_count));
+                        if (_send_ns >= _duration_ns)
+                        {
+                            break;
+                        }
+
+                        WaitUntil(_start_time, _send_ns);
+                    }
+                    else
+                    {
+                        _send_ns = GetElapsedNs(_start_time);
+                        if (_send_ns >= _duration_ns)
+                        {
+                            break;
+                        }
+                    }
+
+                    _item._send_ns = _send_ns;
+                    _item._sequence = _local_count;
+
+                    while (false == _queue->Push(_item))
+                    {
+                        ++_local_retry_count;
+                        _waiter.Wait();
+                    }
+
+                    _waiter.Reset();
+                    ++_local_count;
+                }
+
+                _pushed_count.fetch_add(_local_count, std::memory_order_relaxed);
+                _push_retry_count.fetch_add(_local_retry_count, std::memory_order_relaxed);
+            });
+        }
+
+        for (size_t _consumer_index = 0; _consumer_index < _workload.consumer_count; ++_consumer_index)
+        {
+            _consumers.emplace_back([&, _consumer_index]()
+            {
+                Waiter _waiter(_wait_policy);
+                Item _item{};
+                std::vector<std::uint64_t>& _local_latencies = _latencies[_consumer_index];
+
+                _ready_count.fetch_add(1);
+                while (false == _start.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                while (true)
+                {
+                    if (true == _queue->Pop(_item))
+                    {
+                        const std::uint64_t _now_ns = GetElapsedNs(_start_time);
+                        _local_latencies.push_back(_now_ns > _item._send_ns ? _now_ns - _item._send_ns : 0);
+                        _waiter.Reset();
+                    }
+                    else if (true == _producers_done.load(std::memory_order_acquire))
+                    {
+                        // 생산자가 모두 끝났으므로 Pop 실패는 큐가 비었다는 뜻이다
+                        if (false == _queue->Pop(_item))
+                        {
+                            break;
+                        }
+
+                        const std::uint64_t _now_ns = GetElapsedNs(_start_time);
+                        _local_latencies.push_back(_now_ns > _item._send_ns ? _now_ns - _item._send_ns : 0);
+                    }
+                    else
+                    {
+                        _waiter.Wait();
+                    }
+                }
+            });
+        }
+
+        while (_ready_count.load() < _workload.producer_count + _workload.consumer_count)
+        {
+            std::this_thread::yield();
+        }
+
+        _start_time = std::chrono::steady_clock::now();
+        _start.store(true, std::memory_order_release);
+
+        for (auto& _producer : _producers)
+        {
+            _producer.join();
+        }
+
+        _producers_done.store(true, std::memory_order_release);
+
+        for (auto& _consumer : _consumers)
+        {
+            _consumer.join();
+        }
+
+        const double _elapsed_sec = static_cast<double>(GetElapsedNs(_start_time)) / 1e9;
+
+        std::vector<std::uint64_t> _all_latencies;
+        for (const auto& _local_latencies : _latencies)
+        {
+            _all_latencies.insert(_all_latencies.end(), _local_latencies.begin(), _local_latencies.end());
+        }
+
+        std::sort(_all_latencies.begin(), _all_latencies.end());
+
+        return TrialResult{
+            static_cast<double>(_all_latencies.size()) / _elapsed_sec,
+            GetPercentileUs(_all_latencies, 0.50),
+            GetPercentileUs(_all_latencies, _workload.percentile),
+            true == _all_latencies.empty() ? 0.0 : static_cast<double>(_all_latencies.back()) / 1000.0,
+            _push_retry_count.load(),
+            _all_latencies.size() == _pushed_count.load() && false == _all_latencies.empty()};
+    }
+
+    template <typename Item, size_t... Capacities>
+    void AddQueueCandidates(std::vector<Candidate>& _candidates, std::index_sequence<Capacities...>)
+    {
+        for (const WaitPolicy _wait_policy : WaitPolicies)
+        {
+            (_candidates.push_back(Candidate{"MPMCQueue", Capacities, _wait_policy, &RunTrial<MPMCQueue<Item, Capacities>, Item>, {}}), ...);
+            (_candidates.push_back(Candidate{"MutexQueue", Capacities, _wait_policy, &RunTrial<MutexQueue<Item, Capacities>, Item>, {}}), ...);
+            (_candidates.push_back(Candidate{"FlatCombiningQueue", Capacities, _wait_policy, &RunTrial<FlatCombiningQueue<Item, Capacities>, Item>, {}}), ...);
+        }
+    }
+
+    // 항목 크기 구간 하나의 후보 목록. SPSC_Q는 1P / 1C이고 항목이 8바이트 이하일 때만 넣는다.
+    template <size_t Bytes>
+    std::vector<Candidate> MakeCandidates(const WorkloadDescription& _workload)
+    {
+        using Item = Payload<Bytes>;
+
+        std::vector<Candidate> _candidates;
+        AddQueueCandidates<Item>(_candidates, std::index_sequence<64, 1024, lfq::QUEUE_SIZE>{});
+
+        if (_workload.producer_count == 1 && _workload.consumer_count == 1 && _workload.payload_bytes <= sizeof(std::int64_t))
+        {
+            for (const WaitPolicy _wait_policy : WaitPolicies)
+            {
+                _candidates.push_back(Candidate{"SPSC_Q", 16, _wait_policy, &RunTrial<SpscAdapter<16>, Item>, {}});
+                _candidates.push_back(Candidate{"SPSC_Q", 49, _wait_policy, &RunTrial<SpscAdapter<49>, Item>, {}});
+            }
+        }
+
+        return _candidates;
+    }
+
+    // 항목은 32/64/256/1024바이트 중 요청 크기 이상인 가장 작은 구간으로 올린다
+    std::vector<Candidate> MakeCandidatesForPayload(const WorkloadDescription& _workload, size_t& _bucket_bytes)
+    {
+        if (_workload.payload_bytes <= 32)
+        {
+            _bucket_bytes = 32;
+            return MakeCandidates<32>(_workload);
+        }
+
+        if (_workload.payload_bytes <= 64)
+        {
+            _bucket_bytes = 64;
+            return MakeCandidates<64>(_workload);
+        }
+
+        if (_workload.payload_bytes <= 256)
+        {
+            _bucket_bytes = 256;
+            return MakeCandidates<256>(_workload);
+        }
+
+        _bucket_bytes = 1024;
+        return MakeCandidates<1024>(_workload);
+    }
+
+    bool MeetsRate(const WorkloadDescription& _workload, const TrialResult& _result)
+    {
+        return _workload.offered_rate <= 0.0 || _result.items_per_sec >= _workload.offered_rate * OfferedRateTolerance;
+    }
+
+    bool MeetsLatency(const WorkloadDescription& _workload, const TrialResult& _result)
+    {
+        return _workload.target_latency_us <= 0.0 || _result.percentile_latency_us <= _workload.target_latency_us;
+    }
+
+    // 목표를 만족하는 후보가 먼저 오고, 도착률이 정해져 있으면 백분위 지연, 아니면 처리량 순으로 정렬한다
+    bool IsBetter(const WorkloadDescription& _workload, const TrialResult& _left, const TrialResult& _right)
+    {
+        const int _left_rank = (true == _left.valid) + (true == MeetsRate(_workload, _left)) + (true == MeetsLatency(_workload, _left));
+        const int _right_rank = (true == _right.valid) + (true == MeetsRate(_workload, _right)) + (true == MeetsLatency(_workload, _right));
+        if (_left_rank != _right_rank)
+        {
+            return _left_rank > _right_rank;
+        }
+
+        if (_workload.offered_rate > 0.0)
+        {
+            return _left.percentile_latency_us < _right.percentile_latency_us;
+        }
+
+        return _left.items_per_sec > _right.items_per_sec;
+    }
+
+    TrialResult GetMedianResult(const WorkloadDescription& _workload, std::array<TrialResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [&_workload](const TrialResult& _left, const TrialResult& _right)
+        {
+            return IsBetter(_workload, _left, _right);
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    // 0.99 → "p99", 0.999 → "p99.9"
+    std::string GetPercentileLabel(double _percentile)
+    {
+        std::ostringstream _label;
+        _label << 'p' << std::setprecision(6) << _percentile * 100.0;
+        return _label.str();
+    }
+
+    void PrintCandidate(const WorkloadDescription& _workload, const Candidate& _candidate)
+    {
+        std::cout << "  " << std::left << std::setw(18) << _candidate.queue_name << std::right
+                  << " 용량 " << std::setw(5) << _candidate.capacity
+                  << " | " << std::left << std::setw(7) << GetWaitPolicyName(_candidate.wait_policy) << std::right
+                  << " | " << std::fixed << std::setprecision(2)
+                  << std::setw(12) << _candidate.result.items_per_sec << " items/sec | 지연 p50 "
+                  << std::setw(9) << _candidate.result.p50_latency_us << " us, " << GetPercentileLabel(_workload.percentile) << ' '
+                  << std::setw(9) << _candidate.result.percentile_latency_us << " us, 최대 "
+                  << std::setw(9) << _candidate.result.max_latency_us << " us | Push 재시도 "
+                  << _candidate.result.push_retry_count << " | "
+                  << (false == _candidate.result.valid ? "검증 오류"
+                      : (true == MeetsRate(_workload, _candidate.result) && true == MeetsLatency(_workload, _candidate.result)) ? "목표 만족" : "목표 미달")
+                  << '\n';
+    }
+
+    // 추천 설정을 key=value 형식으로 쓴다
+    bool WriteRecommendation(const WorkloadDescription& _workload, size_t _bucket_bytes, const Candidate& _candidate)
+    {
+        std::ofstream _output(_workload.output_path);
+        if (false == _output.is_open())
+        {
+            return false;
+        }
+
+        _output << std::fixed << std::setprecision(2)
+                << "# queue_tuner 추천 설정\n"
+                << "producers=" << _workload.producer_count << '\n'
+                << "consumers=" << _workload.consumer_count << '\n'
+                << "payload_bytes=" << _workload.payload_bytes << '\n'
+                << "measured_payload_bytes=" << _bucket_bytes << '\n'
+                << "offered_rate=" << _workload.offered_rate << '\n'
+                << "queue=" << _candidate.queue_name << '\n'
+                << "capacity=" << _candidate.capacity << '\n'
+                << "wait_policy=" << GetWaitPolicyName(_candidate.wait_policy) << '\n'
+                << "items_per_sec=" << _candidate.result.items_per_sec << '\n'
+                << "p50_latency_us=" << _candidate.result.p50_latency_us << '\n'
+                << "percentile=" << std::setprecision(4) << _workload.percentile << std::setprecision(2) << '\n'
+                << "percentile_latency_us=" << _candidate.result.percentile_latency_us << '\n'
+                << "meets_target=" << (true == MeetsRate(_workload, _candidate.result) && true == MeetsLatency(_workload, _candidate.result) ? "true" : "false") << '\n';
+
+        return _output.good();
+    }
+
+    bool ParseArguments(int _argc, char* _argv[], WorkloadDescription& _workload)
+    {
+        for (int i = 1; i < _argc; ++i)
+        {
+            const std::string _argument = _argv[i];
+            if (i + 1 >= _argc)
+            {
+                return false;
+            }
+
+            const char* const _value = _argv[++i];
+            if (_argument == "--producers")
+            {
+                _workload.producer_count = static_cast<size_t>(std::max(1, std::atoi(_value)));
+            }
+            else if (_argument == "--consumers")
+            {
+                _workload.consumer_count = static_cast<size_t>(std::max(1, std::atoi(_value)));
+            }
+            else if (_argument == "--payload")
+            {
+                _workload.payload_bytes = static_cast<size_t>(std::max(1, std::atoi(_value)));
+            }
+            else if (_argument == "--rate")
+            {
+                _workload.offered_rate = std::max(0.0, std::atof(_value));
+            }
+            else if (_argument == "--percentile")
+            {
+                _workload.percentile = std::clamp(std::atof(_value), 0.0, 1.0);
+            }
+            else if (_argument == "--target-latency-us")
+            {
+                _workload.target_latency_us = std::max(0.0, std::atof(_value));
+            }
+            else if (_argument == "--trial-ms")
+            {
+                _workload.trial_ms = static_cast<size_t>(std::max(10, std::atoi(_value)));
+            }
+            else if (_argument == "--output")
+            {
+                _workload.output_path = _value;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+// 사용법: queue_tuner [--producers N] [--consumers N] [--payload 바이트] [--rate items/sec]
+//                     [--percentile 0.99] [--target-latency-us 지연] [--trial-ms 측정 시간] [--output 파일]
+// 작업 부하에 맞는 큐 타입, 용량, 대기 정책 조합을 이 기계에서 짧게 실행해 비교하고 추천한다.
+// 1단계에서 모든 후보를 한 번씩 실행하고, 2단계에서 상위 후보를 반복 실행해 중앙값으로 다시 순위를 정한다.
+int main(int _argc, char* _argv[])
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    WorkloadDescription _workload;
+    if (false == ParseArguments(_argc, _argv, _workload))
+    {
+        std::cerr << "사용법: queue_tuner [--producers N] [--consumers N] [--payload 바이트] [--rate items/sec]\n"
+                  << "                   [--percentile 0.99] [--target-latency-us 지연] [--trial-ms 측정 시간] [--output 파일]\n";
+        return 1;
+    }
+
+    size_t _bucket_bytes = 0;
+    std::vector<Candidate> _candidates = MakeCandidatesForPayload(_workload, _bucket_bytes);
+
+    std::cout << "큐 자동 튜닝\n";
+    std::cout << "생산자=" << _workload.producer_count
+              << " | 소비자=" << _workload.consumer_count
+              << " | 항목=" << _workload.payload_bytes << "바이트 (측정 " << _bucket_bytes << "바이트)"
+              << " | 도착률=" << (_workload.offered_rate > 0.0 ? std::to_string(static_cast<std::uint64_t>(_workload.offered_rate)) + " items/sec" : std::string("최대"))
+              << " | 지연 목표=" << GetPercentileLabel(_workload.percentile) << ' '
+              << (_workload.target_latency_us > 0.0 ? std::to_string(_workload.target_latency_us) + " us" : std::string("없음"))
+              << " | 측정=" << _workload.trial_ms << " ms\n";
+    std::cout << "순위: 목표를 만족하는 후보 우선, 도착률이 있으면 백분위 지연, 없으면 처리량 순\n";
+
+    std::cout << "\n1단계: 후보 " << _candidates.size() << "개를 한 번씩 실행\n";
+    for (Candidate& _candidate : _candidates)
+    {
+        _candidate.result = _candidate.run(_workload, _candidate.wait_policy);
+    }
+
+    std::stable_sort(_candidates.begin(), _candidates.end(), [&_workload](const Candidate& _left, const Candidate& _right)
+    {
+        return IsBetter(_workload, _left.result, _right.result);
+    });
+
+    for (const Candidate& _candidate : _candidates)
+    {
+        PrintCandidate(_workload, _candidate);
+    }
+
+    // 2단계: 상위 후보를 번갈아 반복 실행해 중앙값을 쓴다
+    const size_t _confirm_count = std::min(ConfirmCandidateCount, _candidates.size());
+    std::vector<std::array<TrialResult, BenchmarkRepeatCount>> _results(_confirm_count);
+
+    for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+    {
+        for (size_t _offset = 0; _offset < _confirm_count; ++_offset)
+        {
+            const size_t _candidate_index = (_repeat_index + _offset) % _confirm_count;
+            _results[_candidate_index][_repeat_index] = _candidates[_candidate_index].run(_workload, _candidates[_candidate_index].wait_policy);
+        }
+    }
+
+    std::vector<Candidate> _top_candidates(_candidates.begin(), _candidates.begin() + static_cast<std::ptrdiff_t>(_confirm_count));
+    for (size_t i = 0; i < _confirm_count; ++i)
+    {
+        _top_candidates[i].result = GetMedianResult(_workload, _results[i]);
+    }
+
+    std::stable_sort(_top_candidates.begin(), _top_candidates.end(), [&_workload](const Candidate& _left, const Candidate& _right)
+    {
+        return IsBetter(_workload, _left.result, _right.result);
+    });
+
+    std::cout << "\n2단계: 상위 " << _confirm_count << "개 후보를 " << BenchmarkRepeatCount << "회 반복한 중앙값\n";
+    for (const Candidate& _candidate : _top_candidates)
+    {
+        PrintCandidate(_workload, _candidate);
+    }
+
+    const Candidate& _best = _top_candidates.front();
+    const bool _meets_target = true == _best.result.valid && true == MeetsRate(_workload, _best.result) && true == MeetsLatency(_workload, _best.result);
+
+    std::cout << "\n추천" << (true == _meets_target ? "" : " (목표를 만족하는 후보 없음, 가장 가까운 후보)") << ": "
+              << _best.queue_name << " | 용량 " << _best.capacity << " | 대기 정책 " << GetWaitPolicyName(_best.wait_policy) << '\n';
+
+    if (false == _workload.output_path.empty())
+    {
+        if (false == WriteRecommendation(_workload, _bucket_bytes, _best))
+        {
+            std::cerr << "추천 설정을 쓰지 못함: " << _workload.output_path << '\n';
+            return 1;
+        }
+
+        std::cout << "추천 설정을 씀: " << _workload.output_path << '\n';
+    }
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
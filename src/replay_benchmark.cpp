@@ -0,0 +1,488 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "flat_combining_queue.h"
+#include "mpmc_queue.h"
+#include "mutex_queue.h"
+#include "trace_capture.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr size_t CaptureRecordsPerThread = 1'000'000;
+
+    // 재생 항목: 예정된 도착 시각으로 큐 안에서 보낸 시간을 잰다
+    struct ReplayItem
+    {
+        std::uint64_t _scheduled_ns;
+        std::uint32_t _payload_size;
+        std::uint32_t _producer_index;
+    };
+}
+
+// 캡처할 때 항목 크기로 ReplayItem이 나르는 페이로드 크기를 기록한다
+template <>
+struct lfq::TracePayloadSize<ReplayItem>
+{
+    static std::uint32_t Get(const ReplayItem& _item) noexcept { return _item._payload_size; }
+};
+
+namespace
+{
+    // 캡처된 생산자 스레드 하나의 도착 과정
+    struct ProducerSchedule
+    {
+        std::vector<std::uint64_t> _timestamps_ns;
+        std::vector<std::uint32_t> _payload_sizes;
+    };
+
+    struct ReplayWorkload
+    {
+        std::vector<ProducerSchedule> producers;
+        size_t consumer_count;
+        size_t item_count;
+        std::uint64_t payload_bytes;
+        std::uint64_t duration_ns;
+    };
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double items_per_sec;
+        double p50_latency_us;
+        double p99_latency_us;
+        double max_latency_us;
+        double max_lag_us;
+        size_t push_retry_count;
+        bool valid;
+    };
+
+    std::uint64_t GetElapsedNs(std::chrono::steady_clock::time_point _start_time)
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start_time).count());
+    }
+
+    // 예정 시각까지 기다린다. 멀면 잠들고 가까우면 양보하며 확인한다.
+    void WaitUntil(std::chrono::steady_clock::time_point _start_time, std::uint64_t _target_ns)
+    {
+        while (true)
+        {
+            const std::uint64_t _now_ns = GetElapsedNs(_start_time);
+            if (_now_ns >= _target_ns)
+            {
+                return;
+            }
+
+            if (_target_ns - _now_ns > 200'000)
+            {
+                std::this_thread::sleep_for(std::chrono::nanoseconds(_target_ns - _now_ns - 100'000));
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // 트레이스 인자가 없을 때 쓰는 예제 트래픽: 몰림, 일정한 흐름, 드문 흐름을 가진 생산자 셋과 소비자 둘
+    std::vector<std::string> CaptureSyntheticWorkload(const std::string& _path_prefix)
+    {
+        using CaptureQueue = MPMCQueue<ReplayItem, lfq::QUEUE_SIZE>;
+
+        constexpr std::uint64_t BurstCount = 20;
+        constexpr std::uint64_t ItemsPerBurst = 2'000;
+        constexpr std::uint64_t SteadyItemCount = 40'000;
+        constexpr std::uint64_t TrickleItemCount = 2'000;
+        constexpr std::uint64_t TotalCount = BurstCount * ItemsPerBurst + SteadyItemCount + TrickleItemCount;
+
+        auto _queue = std::make_unique<CaptureQueue>();
+        TraceCapture _capture(_path_prefix, CaptureRecordsPerThread);
+        CapturingQueue<CaptureQueue> _capturing_queue(*_queue, _capture);
+        std::atomic<std::uint64_t> _popped_count{0};
+
+        const auto _start_time = std::chrono::steady_clock::now();
+        const auto _push = [&_capturing_queue](std::uint32_t _payload_size)
+        {
+            while (false == _capturing_queue.Push(ReplayItem{0, _payload_size, 0}))
+            {
+                std::this_thread::yield();
+            }
+        };
+
+        std::vector<std::thread> _threads;
+
+        // 5ms마다 2000개씩 몰아서 넣는 생산자
+        _threads.emplace_back([&]()
+        {
+            for (std::uint64_t _burst_index = 0; _burst_index < BurstCount; ++_burst_index)
+            {
+                WaitUntil(_start_time, _burst_index * 5'000'000);
+                for (std::uint64_t i = 0; i < ItemsPerBurst; ++i)
+                {
+                    _push(64);
+                }
+            }
+        });
+
+        // 2.5us 간격으로 꾸준히 넣는 생산자
+        _threads.emplace_back([&]()
+        {
+            for (std::uint64_t i = 0; i < SteadyItemCount; ++i)
+            {
+                WaitUntil(_start_time, i * 2'500);
+                _push(256);
+            }
+        });
+
+        // 50us 간격으로 큰 항목을 드물게 넣는 생산자
+        _threads.emplace_back([&]()
+        {
+            for (std::uint64_t i = 0; i < TrickleItemCount; ++i)
+            {
+                WaitUntil(_start_time, i * 50'000);
+                _push(4096);
+            }
+        });
+
+        for (size_t _consumer_index = 0; _consumer_index < 2; ++_consumer_index)
+        {
+            _threads.emplace_back([&]()
+            {
+                ReplayItem _item{};
+                while (_popped_count.load(std::memory_order_relaxed) < TotalCount)
+                {
+                    if (true == _capturing_queue.Pop(_item))
+                    {
+                        _popped_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        return _capture.Finish();
+    }
+
+    // 트레이스 파일마다 Push 레코드를 생산자 일정으로 만들고, Pop 레코드가 있는 파일 수를 소비자 수로 쓴다.
+    bool LoadWorkload(const std::vector<std::string>& _paths, ReplayWorkload& _workload)
+    {
+        _workload = ReplayWorkload{{}, 0, 0, 0, 0};
+        std::uint64_t _first_ns = ~std::uint64_t{0};
+
+        for (const std::string& _path : _paths)
+        {
+            std::vector<lfq::TraceRecord> _records;
+            if (false == lfq::LoadTraceFile(_path, _records))
+            {
+                std::cerr << "트레이스 파일을 읽지 못함: " << _path << '\n';
+                return false;
+            }
+
+            ProducerSchedule _schedule;
+            bool _has_pop = false;
+
+            for (const lfq::TraceRecord& _record : _records)
+            {
+                if (_record._operation == lfq::TraceOperation::Push)
+                {
+                    _schedule._timestamps_ns.push_back(_record._timestamp_ns);
+                    _schedule._payload_sizes.push_back(_record._payload_size);
+                    _workload.payload_bytes += _record._payload_size;
+                    _first_ns = std::min(_first_ns, _record._timestamp_ns);
+                }
+                else
+                {
+                    _has_pop = true;
+                }
+            }
+
+            _workload.consumer_count += true == _has_pop ? 1 : 0;
+            _workload.item_count += _schedule._timestamps_ns.size();
+
+            if (false == _schedule._timestamps_ns.empty())
+            {
+                _workload.producers.push_back(std::move(_schedule));
+            }
+        }
+
+        // 첫 도착을 0으로 맞춘다
+        for (ProducerSchedule& _schedule : _workload.producers)
+        {
+            for (std::uint64_t& _timestamp_ns : _schedule._timestamps_ns)
+            {
+                _timestamp_ns -= _first_ns;
+                _workload.duration_ns = std::max(_workload.duration_ns, _timestamp_ns);
+            }
+        }
+
+        _workload.consumer_count = std::max<size_t>(_workload.consumer_count, 1);
+        return _workload.item_count != 0;
+    }
+
+    // 생산자는 캡처된 시각(_speed배)에 맞춰 넣고, 소비자는 최대한 빨리 꺼내며 예정 도착부터 꺼낼 때까지의 시간을 잰다.
+    template <typename QueueType>
+    BenchmarkResult RunReplayOnce(const ReplayWorkload& _workload, double _speed)
+    {
+        auto _queue = std::make_unique<QueueType>();
+        std::atomic<size_t> _popped_count{0};
+        std::atomic<size_t> _push_retry_count{0};
+        std::atomic<std::uint64_t> _max_lag_ns{0};
+
+        std::vector<std::vector<std::uint64_t>> _latencies(_workload.consumer_count);
+        std::vector<std::thread> _threads;
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        for (size_t _consumer_index = 0; _consumer_index < _workload.consumer_count; ++_consumer_index)
+        {
+            _threads.emplace_back([&, _consumer_index]()
+            {
+                std::vector<std::uint64_t>& _local_latencies = _latencies[_consumer_index];
+                _local_latencies.reserve(_workload.item_count / _workload.consumer_count + 1);
+                ReplayItem _item{};
+
+                while (_popped_count.load(std::memory_order_relaxed) < _workload.item_count)
+                {
+                    if (false == _queue->Pop(_item))
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    const std::uint64_t _now_ns = GetElapsedNs(_start_time);
+                    _local_latencies.push_back(_now_ns > _item._scheduled_ns ? _now_ns - _item._scheduled_ns : 0);
+                    _popped_count.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        for (size_t _producer_index = 0; _producer_index < _workload.producers.size(); ++_producer_index)
+        {
+            _threads.emplace_back([&, _producer_index]()
+            {
+                const ProducerSchedule& _schedule = _workload.producers[_producer_index];
+                size_t _local_retry_count = 0;
+                std::uint64_t _local_max_lag_ns = 0;
+
+                for (size_t i = 0; i < _schedule._timestamps_ns.size(); ++i)
+                {
+                    const std::uint64_t _scheduled_ns = static_cast<std::uint64_t>(static_cast<double>(_schedule._timestamps_ns[i]) / _speed);
+                    WaitUntil(_start_time, _scheduled_ns);
+
+                    while (false == _queue->Push(ReplayItem{_scheduled_ns, _schedule._payload_sizes[i], static_cast<std::uint32_t>(_producer_index)}))
+                    {
+                        ++_local_retry_count;
+                        std::this_thread::yield();
+                    }
+
+                    _local_max_lag_ns = std::max(_local_max_lag_ns, GetElapsedNs(_start_time) - _scheduled_ns);
+                }
+
+                _push_retry_count.fetch_add(_local_retry_count, std::memory_order_relaxed);
+
+                std::uint64_t _max_lag = _max_lag_ns.load(std::memory_order_relaxed);
+                while (_local_max_lag_ns > _max_lag && false == _max_lag_ns.compare_exchange_weak(_max_lag, _local_max_lag_ns, std::memory_order_relaxed))
+                {
+                }
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        std::vector<std::uint64_t> _all_latencies;
+        _all_latencies.reserve(_workload.item_count);
+        for (const auto& _local_latencies : _latencies)
+        {
+            _all_latencies.insert(_all_latencies.end(), _local_latencies.begin(), _local_latencies.end());
+        }
+
+        std::sort(_all_latencies.begin(), _all_latencies.end());
+
+        const auto _percentile_us = [&_all_latencies](double _percentile)
+        {
+            if (true == _all_latencies.empty())
+            {
+                return 0.0;
+            }
+
+            const size_t _index = std::min(_all_latencies.size() - 1, static_cast<size_t>(_percentile * static_cast<double>(_all_latencies.size())));
+            return static_cast<double>(_all_latencies[_index]) / 1000.0;
+        };
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(_workload.item_count) / _duration_sec,
+            _percentile_us(0.50),
+            _percentile_us(0.99),
+            true == _all_latencies.empty() ? 0.0 : static_cast<double>(_all_latencies.back()) / 1000.0,
+            static_cast<double>(_max_lag_ns.load()) / 1000.0,
+            _push_retry_count.load(),
+            _all_latencies.size() == _workload.item_count};
+    }
+
+    // 재생 시간은 트레이스 길이로 정해지므로 p99 지연 기준으로 중앙값을 고른다
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.p99_latency_us < _right.p99_latency_us;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(9) << _result.duration_ms << " ms | "
+                  << std::setw(12) << _result.items_per_sec << " items/sec | 지연 p50 "
+                  << _result.p50_latency_us << " us, p99 "
+                  << _result.p99_latency_us << " us, 최대 "
+                  << _result.max_latency_us << " us | 최대 재생 지연 "
+                  << _result.max_lag_us << " us | Push 재시도 "
+                  << _result.push_retry_count << " | 검증 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+
+    // 같은 트레이스를 세 큐에 번갈아 재생하고 중앙값을 출력한다.
+    void RunComparison(const ReplayWorkload& _workload, double _speed)
+    {
+        using LockFreeQueue = MPMCQueue<ReplayItem, lfq::QUEUE_SIZE>;
+        using TwoLockQueue = MutexQueue<ReplayItem, lfq::QUEUE_SIZE>;
+        using CombiningQueue = FlatCombiningQueue<ReplayItem, lfq::QUEUE_SIZE>;
+
+        constexpr size_t CaseCount = 3;
+        const std::array<const char*, CaseCount> _case_names = {"MPMCQueue         ", "MutexQueue        ", "FlatCombiningQueue"};
+        std::array<std::array<BenchmarkResult, BenchmarkRepeatCount>, CaseCount> _results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            for (size_t _offset = 0; _offset < CaseCount; ++_offset)
+            {
+                const size_t _case_index = (_repeat_index + _offset) % CaseCount;
+
+                switch (_case_index)
+                {
+                case 0:
+                    _results[_case_index][_repeat_index] = RunReplayOnce<LockFreeQueue>(_workload, _speed);
+                    break;
+                case 1:
+                    _results[_case_index][_repeat_index] = RunReplayOnce<TwoLockQueue>(_workload, _speed);
+                    break;
+                default:
+                    _results[_case_index][_repeat_index] = RunReplayOnce<CombiningQueue>(_workload, _speed);
+                    break;
+                }
+            }
+        }
+
+        std::cout << "\n재생 속도 x" << std::fixed << std::setprecision(2) << _speed << '\n';
+        for (size_t _case_index = 0; _case_index < CaseCount; ++_case_index)
+        {
+            PrintResult(_case_names[_case_index], GetMedianResult(_results[_case_index]));
+        }
+    }
+}
+
+// 사용법: replay_benchmark [--speed 배율] [트레이스 파일...]
+// 트레이스 파일은 TraceCapture/CapturingQueue로 캡처한 스레드별 *.trace 파일이다.
+// 파일을 주지 않으면 예제 트래픽을 캡처해 임시 디렉터리에 저장한 뒤 재생한다.
+int main(int _argc, char* _argv[])
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::vector<double> _speeds;
+    std::vector<std::string> _paths;
+
+    for (int i = 1; i < _argc; ++i)
+    {
+        const std::string _argument = _argv[i];
+        if (_argument == "--speed" && i + 1 < _argc)
+        {
+            _speeds.push_back(std::max(0.01, std::atof(_argv[++i])));
+        }
+        else
+        {
+            _paths.push_back(_argument);
+        }
+    }
+
+    std::cout << "캡처 트래픽 재생 벤치마크\n";
+
+    const bool _synthetic = _paths.empty();
+    if (true == _synthetic)
+    {
+        const std::string _path_prefix = (std::filesystem::temp_directory_path() / "lfq_replay_capture").string();
+        _paths = CaptureSyntheticWorkload(_path_prefix);
+        std::cout << "트레이스 인자가 없어 예제 트래픽을 캡처함: " << _path_prefix << ".*.trace\n";
+    }
+
+    if (true == _speeds.empty())
+    {
+        _speeds = {1.0, 4.0};
+    }
+
+    ReplayWorkload _workload;
+    if (false == LoadWorkload(_paths, _workload))
+    {
+        std::cerr << "재생할 Push 레코드가 없음\n";
+        return 1;
+    }
+
+    std::cout << "트레이스 파일=" << _paths.size()
+              << " | 생산자=" << _workload.producers.size()
+              << " | 소비자=" << _workload.consumer_count
+              << " | 항목=" << _workload.item_count
+              << " | 평균 항목 크기=" << _workload.payload_bytes / _workload.item_count << "바이트"
+              << " | 트레이스 길이=" << std::fixed << std::setprecision(2) << static_cast<double>(_workload.duration_ns) / 1e6 << " ms"
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 p99 중앙값 사용\n";
+    std::cout << "지연: 예정된 도착 시각부터 Pop까지 | 최대 재생 지연: 생산자가 예정보다 늦게 넣은 최대 시간\n";
+
+    for (const double _speed : _speeds)
+    {
+        RunComparison(_workload, _speed);
+    }
+
+    if (true == _synthetic)
+    {
+        std::error_code _error;
+        for (const std::string& _path : _paths)
+        {
+            std::filesystem::remove(_path, _error);
+        }
+    }
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mpmc_queue.h"
+#include "ring_queue.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+
+    // 역할마다 생산자 수와 관계없이 같은 수의 항목을 전달한다
+    constexpr std::uint64_t ItemsPerRole = 4'000'000;
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double messages_per_sec;
+        size_t push_retry_count;
+        size_t pop_retry_count;
+        std::uint64_t checksum;
+        std::uint64_t expected_checksum;
+    };
+
+    template <typename QueueType>
+    void ProducerThread(QueueType& _queue, std::uint64_t _first_value, std::uint64_t _count, std::atomic<size_t>& _retry_count)
+    {
+        size_t _local_retry_count = 0;
+
+        for (std::uint64_t _value = _first_value; _value < _first_value + _count; ++_value)
+        {
+            while (false == _queue.Push(_value))
+            {
+                ++_local_retry_count;
+                std::this_thread::yield();
+            }
+        }
+
+        _retry_count.fetch_add(_local_retry_count, std::memory_order_relaxed);
+    }
+
+    // 소비자끼리 남은 항목 수를 나눠 가진다 (어느 소비자가 몇 개를 받을지 미리 알 수 없으므로)
+    template <typename QueueType>
+    void ConsumerThread(QueueType& _queue, std::atomic<std::uint64_t>& _remaining_count, std::atomic<size_t>& _retry_count, std::atomic<std::uint64_t>& _checksum)
+    {
+        size_t _local_retry_count = 0;
+        std::uint64_t _local_checksum = 0;
+        std::uint64_t _value = 0;
+
+        while (_remaining_count.load(std::memory_order_relaxed) != 0)
+        {
+            if (true == _queue.Pop(_value))
+            {
+                _remaining_count.fetch_sub(1, std::memory_order_relaxed);
+                _local_checksum += _value;
+            }
+            else
+            {
+                ++_local_retry_count;
+                std::this_thread::yield();
+            }
+        }
+
+        _retry_count.fetch_add(_local_retry_count, std::memory_order_relaxed);
+        _checksum.fetch_add(_local_checksum, std::memory_order_relaxed);
+    }
+
+    template <typename QueueType>
+    BenchmarkResult RunBenchmarkOnce(size_t _producer_count, size_t _consumer_count)
+    {
+        auto _queue = std::make_unique<QueueType>();
+        std::atomic<size_t> _push_retry_count{0};
+        std::atomic<size_t> _pop_retry_count{0};
+        std::atomic<std::uint64_t> _checksum{0};
+        std::atomic<std::uint64_t> _remaining_count{ItemsPerRole};
+
+        const std::uint64_t _items_per_producer = ItemsPerRole / _producer_count;
+
+        std::vector<std::thread> _threads;
+        _threads.reserve(_producer_count + _consumer_count);
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        for (size_t _thread_index = 0; _thread_index < _producer_count; ++_thread_index)
+        {
+            _threads.emplace_back(ProducerThread<QueueType>, std::ref(*_queue), _thread_index * _items_per_producer, _items_per_producer, std::ref(_push_retry_count));
+        }
+
+        for (size_t _thread_index = 0; _thread_index < _consumer_count; ++_thread_index)
+        {
+            _threads.emplace_back(ConsumerThread<QueueType>, std::ref(*_queue), std::ref(_remaining_count), std::ref(_pop_retry_count), std::ref(_checksum));
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const auto _end_time = std::chrono::steady_clock::now();
+        const double _duration_sec = std::chrono::duration<double>(_end_time - _start_time).count();
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(ItemsPerRole) / _duration_sec,
+            _push_retry_count.load(std::memory_order_relaxed),
+            _pop_retry_count.load(std::memory_order_relaxed),
+            _checksum.load(std::memory_order_relaxed),
+            (ItemsPerRole * (ItemsPerRole - 1)) / 2};
+    }
+
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.duration_ms < _right.duration_ms;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        const bool _checksum_valid = _result.checksum == _result.expected_checksum;
+
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(10) << _result.duration_ms << " ms | "
+                  << std::setw(14) << _result.messages_per_sec << " messages/sec | Push 재시도 "
+                  << _result.push_retry_count << " | Pop 재시도 " << _result.pop_retry_count << " | 체크섬 "
+                  << (true == _checksum_valid ? "정상" : "오류") << '\n';
+    }
+
+    // 같은 역할에서 MPMCQueue와 전용 RingQueue를 번갈아 세 번 측정하고 각각의 중앙값을 출력한다.
+    template <typename RingQueueType>
+    void RunComparison(const char* _role_name, size_t _producer_count, size_t _consumer_count)
+    {
+        using BaselineQueue = MPMCQueue<std::uint64_t, lfq::QUEUE_SIZE>;
+
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _baseline_results;
+        std::array<BenchmarkResult, BenchmarkRepeatCount> _ring_results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            if ((_repeat_index % 2) == 0)
+            {
+                _baseline_results[_repeat_index] = RunBenchmarkOnce<BaselineQueue>(_producer_count, _consumer_count);
+                _ring_results[_repeat_index] = RunBenchmarkOnce<RingQueueType>(_producer_count, _consumer_count);
+            }
+            else
+            {
+                _ring_results[_repeat_index] = RunBenchmarkOnce<RingQueueType>(_producer_count, _consumer_count);
+                _baseline_results[_repeat_index] = RunBenchmarkOnce<BaselineQueue>(_producer_count, _consumer_count);
+            }
+        }
+
+        std::cout << "\n" << _role_name << " (" << _producer_count << "P / " << _consumer_count << "C)\n";
+        PrintResult("MPMCQueue", GetMedianResult(_baseline_results));
+        PrintResult("RingQueue", GetMedianResult(_ring_results));
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "RingQueue<uint64_t> 생산자/소비자 수별 특수화 vs MPMCQueue 벤치마크\n";
+    std::cout << "큐 크기=" << lfq::QUEUE_SIZE
+              << " | 역할별 항목=" << ItemsPerRole
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
+
+    RunComparison<SPSCRingQueue<std::uint64_t, lfq::QUEUE_SIZE>>("SPSC", 1, 1);
+    RunComparison<MPSCRingQueue<std::uint64_t, lfq::QUEUE_SIZE>>("MPSC", 4, 1);
+    RunComparison<SPMCRingQueue<std::uint64_t, lfq::QUEUE_SIZE>>("SPMC", 1, 4);
+    RunComparison<MPMCRingQueue<std::uint64_t, lfq::QUEUE_SIZE>>("MPMC", 4, 4);
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mpmc_queue.h"
+#include "sojourn_queue.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr std::uint64_t ItemsPerCase = 4'000'000;
+
+    // Packed 슬롯과 비교하지 않도록 일반 슬롯을 쓰는 64비트 값을 사용한다
+    using Item = std::uint64_t;
+
+    using PlainQueue = MPMCQueue<Item, lfq::QUEUE_SIZE>;
+    using SteadyQueue = SojournQueue<Item, lfq::QUEUE_SIZE, lfq::SteadyClock>;
+    using CoarseQueue = SojournQueue<Item, lfq::QUEUE_SIZE, lfq::CoarseClock>;
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double messages_per_sec;
+        double mean_sojourn_us;
+        double max_sojourn_us;
+        bool valid;
+    };
+
+    template <typename QueueType>
+    BenchmarkResult RunBenchmarkOnce(size_t _thread_pair_count)
+    {
+        auto _queue = std::make_unique<QueueType>();
+        std::atomic<std::uint64_t> _remaining_count{ItemsPerCase};
+        std::atomic<std::uint64_t> _checksum{0};
+
+        const std::uint64_t _items_per_producer = ItemsPerCase / _thread_pair_count;
+        std::vector<std::thread> _threads;
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        for (size_t _thread_index = 0; _thread_index < _thread_pair_count; ++_thread_index)
+        {
+            _threads.emplace_back([&_queue, _thread_index, _items_per_producer]()
+            {
+                const std::uint64_t _first_value = _thread_index * _items_per_producer;
+
+                for (std::uint64_t _value = _first_value; _value < _first_value + _items_per_producer; ++_value)
+                {
+                    while (false == _queue->Push(_value))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+            _threads.emplace_back([&_queue, &_remaining_count, &_checksum]()
+            {
+                std::uint64_t _local_checksum = 0;
+                Item _value = 0;
+
+                while (_remaining_count.load(std::memory_order_relaxed) != 0)
+                {
+                    if (true == _queue->Pop(_value))
+                    {
+                        _remaining_count.fetch_sub(1, std::memory_order_relaxed);
+                        _local_checksum += _value;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                _checksum.fetch_add(_local_checksum, std::memory_order_relaxed);
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        double _mean_sojourn_us = 0.0;
+        double _max_sojourn_us = 0.0;
+        if constexpr (false == std::is_same_v<QueueType, PlainQueue>)
+        {
+            const lfq::SojournStats _stats = _queue->GetStats();
+            _mean_sojourn_us = static_cast<double>(_stats._total_sojourn_ns) / static_cast<double>(_stats._pop_count) / 1000.0;
+            _max_sojourn_us = static_cast<double>(_stats._max_sojourn_ns) / 1000.0;
+        }
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(ItemsPerCase) / _duration_sec,
+            _mean_sojourn_us,
+            _max_sojourn_us,
+            _checksum.load() == ItemsPerCase * (ItemsPerCase - 1) / 2};
+    }
+
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return _left.duration_ms < _right.duration_ms;
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(10) << _result.duration_ms << " ms | "
+                  << std::setw(14) << _result.messages_per_sec << " messages/sec | 평균 체류 "
+                  << _result.mean_sojourn_us << " us | 최대 체류 "
+                  << _result.max_sojourn_us << " us | 체크섬 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+
+    // 체류 시간 측정 끔(MPMCQueue), steady_clock, coarse clock을 번갈아 세 번 측정하고 중앙값을 출력한다.
+    void RunComparison(size_t _thread_pair_count)
+    {
+        constexpr size_t CaseCount = 3;
+        const std::array<const char*, CaseCount> _case_names = {"MPMCQueue (끔)          ", "SojournQueue steady    ", "SojournQueue coarse    "};
+        std::array<std::array<BenchmarkResult, BenchmarkRepeatCount>, CaseCount> _results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            for (size_t _offset = 0; _offset < CaseCount; ++_offset)
+            {
+                const size_t _case_index = (_repeat_index + _offset) % CaseCount;
+
+                switch (_case_index)
+                {
+                case 0:
+                    _results[_case_index][_repeat_index] = RunBenchmarkOnce<PlainQueue>(_thread_pair_count);
+                    break;
+                case 1:
+                    _results[_case_index][_repeat_index] = RunBenchmarkOnce<SteadyQueue>(_thread_pair_count);
+                    break;
+                default:
+                    _results[_case_index][_repeat_index] = RunBenchmarkOnce<CoarseQueue>(_thread_pair_count);
+                    break;
+                }
+            }
+        }
+
+        std::cout << "\n" << _thread_pair_count << "P / " << _thread_pair_count << "C\n";
+
+        const BenchmarkResult _off = GetMedianResult(_results[0]);
+        PrintResult(_case_names[0], _off);
+
+        for (size_t _case_index = 1; _case_index < CaseCount; ++_case_index)
+        {
+            const BenchmarkResult _on = GetMedianResult(_results[_case_index]);
+            PrintResult(_case_names[_case_index], _on);
+            std::cout << "    처리량 변화: " << std::showpos << (_on.messages_per_sec / _off.messages_per_sec - 1.0) * 100.0
+                      << std::noshowpos << "%\n";
+        }
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "체류 시간 측정 켬/끔 오버헤드 벤치마크\n";
+    std::cout << "큐 크기=" << lfq::QUEUE_SIZE
+              << " | 경우별 항목=" << ItemsPerCase
+              << " | 반복=" << BenchmarkRepeatCount << "회 후 중앙값 사용\n";
+
+    for (const size_t _thread_pair_count : {1, 4})
+    {
+        RunComparison(_thread_pair_count);
+    }
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
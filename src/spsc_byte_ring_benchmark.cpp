@@ -0,0 +1,255 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "spsc_byte_ring.h"
+#include "spsc_queue.h"
+
+namespace
+{
+    constexpr std::size_t RingCapacityBytes = std::size_t{1} << 20;
+    constexpr std::size_t BoxQueueCapacity = 49;
+
+    // 경우마다 대략 이만큼의 바이트를 보낸다
+    constexpr std::size_t TargetBytesPerCase = std::size_t{256} << 20;
+    constexpr std::size_t MaxRecordCountPerCase = 4'000'000;
+
+    constexpr std::size_t MinRecordSize = 16;
+    constexpr std::size_t MaxRecordSize = 4096;
+    constexpr std::size_t SizeTableLength = 4096;
+
+    struct BenchmarkResult
+    {
+        double duration_ms;
+        double records_per_sec;
+        double bytes_per_sec;
+        bool valid;
+    };
+
+    // 생산자는 미리 채워 둔 원본에서 복사하고, 앞 8바이트에 레코드 번호를 기록한다.
+    // 소비자는 레코드 번호와 크기를 체크섬에 더한다.
+    struct Workload
+    {
+        std::vector<std::size_t> _sizes;
+        std::vector<std::byte> _source;
+        std::size_t _record_count;
+        std::size_t _total_bytes;
+        std::uint64_t _expected_checksum;
+    };
+
+    Workload MakeWorkload(bool _mixed, std::size_t _fixed_size)
+    {
+        Workload _workload;
+        _workload._source.resize(MaxRecordSize, std::byte{0x5a});
+
+        if (true == _mixed)
+        {
+            // 작은 레코드가 많은 로그 균등 분포
+            std::mt19937 _random(3);
+            std::uniform_real_distribution<double> _exponent(std::log2(static_cast<double>(MinRecordSize)), std::log2(static_cast<double>(MaxRecordSize)));
+
+            for (std::size_t i = 0; i < SizeTableLength; ++i)
+            {
+                _workload._sizes.push_back(static_cast<std::size_t>(std::exp2(_exponent(_random))));
+            }
+        }
+        else
+        {
+            _workload._sizes.push_back(_fixed_size);
+        }
+
+        std::size_t _table_bytes = 0;
+        for (const std::size_t _size : _workload._sizes)
+        {
+            _table_bytes += _size;
+        }
+
+        const std::size_t _average_size = _table_bytes / _workload._sizes.size();
+        _workload._record_count = std::min(MaxRecordCountPerCase, TargetBytesPerCase / _average_size);
+        _workload._total_bytes = 0;
+        _workload._expected_checksum = 0;
+
+        for (std::size_t i = 0; i < _workload._record_count; ++i)
+        {
+            const std::size_t _size = _workload._sizes[i % _workload._sizes.size()];
+            _workload._total_bytes += _size;
+            _workload._expected_checksum += i + _size;
+        }
+
+        return _workload;
+    }
+
+    void WriteRecord(void* _destination, const Workload& _workload, std::size_t _sequence, std::size_t _size)
+    {
+        std::memcpy(_destination, _workload._source.data(), _size);
+
+        const std::uint64_t _sequence64 = _sequence;
+        std::memcpy(_destination, &_sequence64, sizeof(_sequence64));
+    }
+
+    std::uint64_t ReadRecord(const void* _data, std::size_t _size)
+    {
+        std::uint64_t _sequence = 0;
+        std::memcpy(&_sequence, _data, sizeof(_sequence));
+        return _sequence + _size;
+    }
+
+    // 레코드마다 힙에 할당하고 포인터를 SPSC_Q로 보낸 뒤 소비자가 해제한다.
+    BenchmarkResult RunBoxed(const Workload& _workload)
+    {
+        SPSC_Q _queue(BoxQueueCapacity);
+        std::uint64_t _checksum = 0;
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::thread _provider([&_queue, &_workload]()
+        {
+            for (std::size_t _sequence = 0; _sequence < _workload._record_count; ++_sequence)
+            {
+                const std::size_t _size = _workload._sizes[_sequence % _workload._sizes.size()];
+
+                // 앞 8바이트에 크기를 두고 그 뒤에 레코드를 담는다
+                auto* _box = new std::byte[sizeof(std::uint64_t) + _size];
+                const std::uint64_t _size64 = _size;
+                std::memcpy(_box, &_size64, sizeof(_size64));
+                WriteRecord(_box + sizeof(std::uint64_t), _workload, _sequence, _size);
+
+                while (false == _queue.push(static_cast<std::int64_t>(reinterpret_cast<std::uintptr_t>(_box))))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        for (std::size_t _received_count = 0; _received_count < _workload._record_count;)
+        {
+            const auto _value = _queue.pop();
+            if (false == _value.has_value())
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            auto* _box = reinterpret_cast<std::byte*>(static_cast<std::uintptr_t>(*_value));
+            std::uint64_t _size = 0;
+            std::memcpy(&_size, _box, sizeof(_size));
+            _checksum += ReadRecord(_box + sizeof(std::uint64_t), static_cast<std::size_t>(_size));
+            delete[] _box;
+
+            ++_received_count;
+        }
+
+        _provider.join();
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(_workload._record_count) / _duration_sec,
+            static_cast<double>(_workload._total_bytes) / _duration_sec,
+            _checksum == _workload._expected_checksum};
+    }
+
+    // 링 안의 자리에 바로 쓰고, 소비자는 복사 없이 읽은 뒤 한 번에 반납한다.
+    BenchmarkResult RunByteRing(const Workload& _workload)
+    {
+        SPSC_ByteRing _ring(RingCapacityBytes);
+        std::uint64_t _checksum = 0;
+
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::thread _provider([&_ring, &_workload]()
+        {
+            for (std::size_t _sequence = 0; _sequence < _workload._record_count; ++_sequence)
+            {
+                const std::size_t _size = _workload._sizes[_sequence % _workload._sizes.size()];
+                void* _destination;
+
+                while (nullptr == (_destination = _ring.reserve(_size)))
+                {
+                    std::this_thread::yield();
+                }
+
+                WriteRecord(_destination, _workload, _sequence, _size);
+                _ring.commit();
+            }
+        });
+
+        for (std::size_t _received_count = 0; _received_count < _workload._record_count;)
+        {
+            const std::size_t _count = _ring.consume([&_checksum](const void* _data, std::size_t _size)
+            {
+                _checksum += ReadRecord(_data, _size);
+            });
+
+            if (_count == 0)
+            {
+                std::this_thread::yield();
+            }
+
+            _received_count += _count;
+        }
+
+        _provider.join();
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        return BenchmarkResult{
+            _duration_sec * 1000.0,
+            static_cast<double>(_workload._record_count) / _duration_sec,
+            static_cast<double>(_workload._total_bytes) / _duration_sec,
+            _checksum == _workload._expected_checksum};
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << _result.duration_ms << " ms | "
+                  << _result.records_per_sec << " records/sec | "
+                  << _result.bytes_per_sec / (1024.0 * 1024.0) << " MiB/sec | 체크섬 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+
+    void RunComparison(const char* _case_name, const Workload& _workload)
+    {
+        std::cout << "\n" << _case_name << " | 레코드=" << _workload._record_count
+                  << " | 총 " << (_workload._total_bytes >> 20) << " MiB\n";
+        PrintResult("SPSC_Q + 힙 박싱", RunBoxed(_workload));
+        PrintResult("SPSC_ByteRing", RunByteRing(_workload));
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "가변 길이 레코드: SPSC_Q 박싱 vs SPSC_ByteRing 벤치마크\n";
+    std::cout << "링 크기=" << (RingCapacityBytes >> 10) << " KiB"
+              << " | SPSC_Q 용량=" << BoxQueueCapacity << '\n';
+
+    for (const std::size_t _size : {std::size_t{16}, std::size_t{64}, std::size_t{256}, std::size_t{1024}, std::size_t{4096}})
+    {
+        const std::string _case_name = "고정 " + std::to_string(_size) + "바이트";
+        RunComparison(_case_name.c_str(), MakeWorkload(false, _size));
+    }
+
+    RunComparison("혼합 16~4096바이트", MakeWorkload(true, 0));
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
@@ -141,6 +141,25 @@ namespace
         }
     }
 
+    void TestPeekDoesNotConsume()
+    {
+        SPSC_Q _queue(2);
+
+        Check(_queue.peek() == nullptr, "peek on an empty queue must return nullptr");
+        Check(_queue.push(10), "first push failed");
+        Check(_queue.push(20), "second push failed");
+
+        const std::int64_t* _front = _queue.peek();
+        Check(_front != nullptr && *_front == 10, "peek must return the oldest element");
+        Check(_queue.peek() == _front, "repeated peek must return the same slot");
+        Check(!_queue.push(30), "peek must not free a slot");
+
+        Check(_queue.pop() == 10, "pop after peek must return the peeked element");
+        Check(_queue.peek() != nullptr && *_queue.peek() == 20, "peek must advance after pop");
+        Check(_queue.pop() == 20, "second pop mismatch");
+        Check(_queue.peek() == nullptr, "peek must return nullptr after the queue drains");
+    }
+
     void TestConcurrentFifoDelivery()
     {
         constexpr std::int64_t ITEM_COUNT = 1'000'000;
@@ -202,6 +221,7 @@ int main()
     RunTest("empty/full boundaries and FIFO", TestBoundaryAndFifo);
     RunTest("capacity one and repeated wrap-around", TestCapacityOneAndWrapAround);
     RunTest("non-power-of-two wrap-around", TestNonPowerOfTwoWrapAround);
+    RunTest("peek without consuming", TestPeekDoesNotConsume);
     RunTest("one-million-element concurrent FIFO delivery", TestConcurrentFifoDelivery);
 
     std::cout << "----------------------------------------\n";
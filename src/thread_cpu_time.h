@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <ctime>
+#include <sys/resource.h>
+#endif
+
+namespace lfq
+{
+    // 호출한 스레드가 사용한 CPU 시간 (ns)
+    inline std::int64_t GetThreadCpuTimeNs()
+    {
+#ifdef _WIN32
+        FILETIME _creation_time, _exit_time, _kernel_time, _user_time;
+        GetThreadTimes(GetCurrentThread(), &_creation_time, &_exit_time, &_kernel_time, &_user_time);
+
+        auto _to_100ns = [](const FILETIME& _time)
+        {
+            return (static_cast<std::int64_t>(_time.dwHighDateTime) << 32) | _time.dwLowDateTime;
+        };
+
+        return (_to_100ns(_kernel_time) + _to_100ns(_user_time)) * 100;
+#else
+        timespec _time{};
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &_time);
+        return static_cast<std::int64_t>(_time.tv_sec) * 1'000'000'000 + _time.tv_nsec;
+#endif
+    }
+
+    // 호출한 스레드의 사용자/시스템 CPU 시간과 컨텍스트 스위치 수
+    // 자발적 스위치는 yield/sleep/잠금 대기로 CPU를 내려놓은 횟수, 비자발적 스위치는 선점당한 횟수다.
+    // 스위치 수는 Linux(getrusage RUSAGE_THREAD)에서만 얻을 수 있으며, 없으면 _has_switch_counts가 false다.
+    struct ThreadResourceUsage
+    {
+        std::int64_t _user_ns = 0;
+        std::int64_t _system_ns = 0;
+        std::int64_t _voluntary_switch_count = 0;
+        std::int64_t _involuntary_switch_count = 0;
+        bool _has_switch_counts = false;
+
+        std::int64_t GetCpuNs() const { return _user_ns + _system_ns; }
+
+        ThreadResourceUsage& operator+=(const ThreadResourceUsage& _other)
+        {
+            _user_ns += _other._user_ns;
+            _system_ns += _other._system_ns;
+            _voluntary_switch_count += _other._voluntary_switch_count;
+            _involuntary_switch_count += _other._involuntary_switch_count;
+            _has_switch_counts = _has_switch_counts || _other._has_switch_counts;
+            return *this;
+        }
+
+        // 측정 구간의 사용량 (끝 - 시작)
+        ThreadResourceUsage operator-(const ThreadResourceUsage& _start) const
+        {
+            ThreadResourceUsage _usage = *this;
+            _usage._user_ns -= _start._user_ns;
+            _usage._system_ns -= _start._system_ns;
+            _usage._voluntary_switch_count -= _start._voluntary_switch_count;
+            _usage._involuntary_switch_count -= _start._involuntary_switch_count;
+            return _usage;
+        }
+    };
+
+    inline ThreadResourceUsage GetThreadResourceUsage()
+    {
+        ThreadResourceUsage _usage;
+
+#ifdef _WIN32
+        FILETIME _creation_time, _exit_time, _kernel_time, _user_time;
+        GetThreadTimes(GetCurrentThread(), &_creation_time, &_exit_time, &_kernel_time, &_user_time);
+
+        auto _to_100ns = [](const FILETIME& _time)
+        {
+            return (static_cast<std::int64_t>(_time.dwHighDateTime) << 32) | _time.dwLowDateTime;
+        };
+
+        _usage._user_ns = _to_100ns(_user_time) * 100;
+        _usage._system_ns = _to_100ns(_kernel_time) * 100;
+#elif defined(RUSAGE_THREAD)
+        rusage _rusage{};
+        getrusage(RUSAGE_THREAD, &_rusage);
+
+        auto _to_ns = [](const timeval& _time)
+        {
+            return static_cast<std::int64_t>(_time.tv_sec) * 1'000'000'000 + static_cast<std::int64_t>(_time.tv_usec) * 1'000;
+        };
+
+        _usage._user_ns = _to_ns(_rusage.ru_utime);
+        _usage._system_ns = _to_ns(_rusage.ru_stime);
+        _usage._voluntary_switch_count = _rusage.ru_nvcsw;
+        _usage._involuntary_switch_count = _rusage.ru_nivcsw;
+        _usage._has_switch_counts = true;
+#else
+        // 스레드별 사용자/시스템 구분이 없으면 전체를 사용자 시간으로 본다
+        _usage._user_ns = GetThreadCpuTimeNs();
+#endif
+
+        return _usage;
+    }
+}
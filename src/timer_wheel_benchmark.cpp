@@ -0,0 +1,316 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mpmc_queue.h"
+#include "timer_wheel.h"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr size_t PendingTimerCount = 1'000'000;
+    constexpr size_t ScheduleCancelPerThread = 250'000;
+    constexpr size_t FirePerThread = 200'000;
+    constexpr auto FireSpread = std::chrono::milliseconds(200);
+    constexpr auto Tick = std::chrono::milliseconds(1);
+
+    // 예약 후 이 개수만큼 뒤에 취소해, 취소 대상이 이미 휠(또는 힙)에 들어가 있게 한다.
+    constexpr size_t CancelDistance = 64;
+
+    constexpr size_t WheelCapacity = size_t{1} << 22;
+
+    std::int64_t ToNs(Clock::time_point _time)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(_time.time_since_epoch()).count();
+    }
+
+    // 비교 대상: 뮤텍스로 보호하는 std::priority_queue
+    // 취소는 대기 중인 id 집합에서 지우고, 만료 시 집합에 없는 항목은 건너뛴다.
+    class PriorityQueueTimers
+    {
+    public:
+        using TimerHandle = std::uint64_t;
+        static constexpr TimerHandle INVALID_TIMER = std::numeric_limits<TimerHandle>::max();
+
+        ~PriorityQueueTimers() { Stop(); }
+
+        TimerHandle Schedule(Clock::time_point _deadline, std::uint64_t _job)
+        {
+            std::lock_guard<std::mutex> _lock(m_mutex);
+
+            const TimerHandle _handle = m_next_handle++;
+            m_heap.push(Entry{_deadline, _handle, _job});
+            m_pending.insert(_handle);
+            return _handle;
+        }
+
+        bool Cancel(TimerHandle _handle)
+        {
+            std::lock_guard<std::mutex> _lock(m_mutex);
+            return m_pending.erase(_handle) != 0;
+        }
+
+        bool PopExpired(std::uint64_t& _job) noexcept { return m_output->Pop(_job); }
+
+        size_t AdvanceTo(Clock::time_point _now)
+        {
+            {
+                std::lock_guard<std::mutex> _lock(m_mutex);
+
+                while (false == m_heap.empty() && m_heap.top()._deadline <= _now)
+                {
+                    const Entry _entry = m_heap.top();
+                    m_heap.pop();
+
+                    if (m_pending.erase(_entry._handle) != 0)
+                    {
+                        m_undelivered.push_back(_entry._job);
+                    }
+                }
+            }
+
+            size_t _delivered_count = 0;
+            while (false == m_undelivered.empty() && true == m_output->Push(m_undelivered.front()))
+            {
+                m_undelivered.pop_front();
+                ++_delivered_count;
+            }
+
+            return _delivered_count;
+        }
+
+        void Start()
+        {
+            m_running.store(true);
+            m_thread = std::thread([this]()
+            {
+                while (true == m_running.load(std::memory_order_relaxed))
+                {
+                    AdvanceTo(Clock::now());
+                    std::this_thread::sleep_for(Tick);
+                }
+            });
+        }
+
+        void Stop()
+        {
+            if (true == m_running.exchange(false))
+            {
+                m_thread.join();
+            }
+        }
+
+    private:
+        struct Entry
+        {
+            Clock::time_point _deadline;
+            TimerHandle _handle;
+            std::uint64_t _job;
+
+            bool operator>(const Entry& _other) const { return _deadline > _other._deadline; }
+        };
+
+        std::mutex m_mutex;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> m_heap;
+        std::unordered_set<TimerHandle> m_pending;
+        TimerHandle m_next_handle = 0;
+
+        std::unique_ptr<MPMCQueue<std::uint64_t, lfq::QUEUE_SIZE>> m_output = std::make_unique<MPMCQueue<std::uint64_t, lfq::QUEUE_SIZE>>();
+        std::deque<std::uint64_t> m_undelivered;
+
+        std::atomic<bool> m_running{false};
+        std::thread m_thread;
+    };
+
+    using WheelTimers = TimerWheel<std::uint64_t, WheelCapacity>;
+
+    // 입력 큐가 가득 차 실패하면 타이머 스레드가 비울 때까지 양보하며 재시도
+    template <typename TimersType>
+    typename TimersType::TimerHandle ScheduleWithRetry(TimersType& _timers, Clock::time_point _deadline, std::uint64_t _job)
+    {
+        typename TimersType::TimerHandle _handle;
+        while ((_handle = _timers.Schedule(_deadline, _job)) == TimersType::INVALID_TIMER)
+        {
+            std::this_thread::yield();
+        }
+
+        return _handle;
+    }
+
+    struct BenchmarkResult
+    {
+        double prefill_ms;
+        double schedule_cancel_ops_per_sec;
+        double fire_duration_ms;
+        double fire_lag_p50_ms;
+        double fire_lag_p99_ms;
+        bool valid;
+    };
+
+    template <typename TimersType>
+    BenchmarkResult RunBenchmark(size_t _thread_count)
+    {
+        auto _timers = std::make_unique<TimersType>();
+        _timers->Start();
+
+        // 1. 먼 미래의 타이머로 대기 중인 타이머 수를 채움
+        auto _phase_start = Clock::now();
+        {
+            std::mt19937_64 _random(7);
+            std::uniform_int_distribution<int> _minutes(10, 60);
+
+            for (size_t i = 0; i < PendingTimerCount; ++i)
+            {
+                ScheduleWithRetry(*_timers, _phase_start + std::chrono::minutes(_minutes(_random)), 0);
+            }
+        }
+        const double _prefill_ms = std::chrono::duration<double, std::milli>(Clock::now() - _phase_start).count();
+
+        // 2. 예약 후 일정 거리 뒤에 취소 (타임아웃 대부분이 만료 전에 취소되는 패턴)
+        std::atomic<size_t> _failed_cancel_count{0};
+        _phase_start = Clock::now();
+        {
+            std::vector<std::thread> _threads;
+            for (size_t _thread_index = 0; _thread_index < _thread_count; ++_thread_index)
+            {
+                _threads.emplace_back([&_timers, &_failed_cancel_count, _thread_index]()
+                {
+                    std::mt19937_64 _random(_thread_index);
+                    std::uniform_int_distribution<int> _seconds(1, 60);
+                    std::deque<typename TimersType::TimerHandle> _outstanding;
+                    size_t _failed_count = 0;
+
+                    for (size_t i = 0; i < ScheduleCancelPerThread; ++i)
+                    {
+                        _outstanding.push_back(ScheduleWithRetry(*_timers, Clock::now() + std::chrono::seconds(_seconds(_random)), 0));
+
+                        if (_outstanding.size() > CancelDistance)
+                        {
+                            _failed_count += false == _timers->Cancel(_outstanding.front()) ? 1 : 0;
+                            _outstanding.pop_front();
+                        }
+                    }
+
+                    for (const auto _handle : _outstanding)
+                    {
+                        _failed_count += false == _timers->Cancel(_handle) ? 1 : 0;
+                    }
+
+                    _failed_cancel_count.fetch_add(_failed_count);
+                });
+            }
+
+            for (auto& _thread : _threads)
+            {
+                _thread.join();
+            }
+        }
+        const double _schedule_cancel_sec = std::chrono::duration<double>(Clock::now() - _phase_start).count();
+
+        // 3. 가까운 미래에 고르게 퍼진 타이머를 예약하고, 모두 만료되어 꺼낼 때까지의 시간과 만료 지연을 잰다
+        const size_t _fire_count = _thread_count * FirePerThread;
+        std::vector<std::int64_t> _lags_ns;
+        _lags_ns.reserve(_fire_count);
+
+        _phase_start = Clock::now();
+        {
+            std::vector<std::thread> _threads;
+            for (size_t _thread_index = 0; _thread_index < _thread_count; ++_thread_index)
+            {
+                _threads.emplace_back([&_timers, _phase_start, _thread_index]()
+                {
+                    std::mt19937_64 _random(_thread_index + 100);
+                    std::uniform_int_distribution<std::int64_t> _offset_ns(0, std::chrono::duration_cast<std::chrono::nanoseconds>(FireSpread).count());
+
+                    for (size_t i = 0; i < FirePerThread; ++i)
+                    {
+                        const auto _deadline = _phase_start + std::chrono::nanoseconds(_offset_ns(_random));
+                        ScheduleWithRetry(*_timers, _deadline, static_cast<std::uint64_t>(ToNs(_deadline)));
+                    }
+                });
+            }
+
+            std::uint64_t _job = 0;
+            while (_lags_ns.size() < _fire_count)
+            {
+                if (true == _timers->PopExpired(_job))
+                {
+                    _lags_ns.push_back(ToNs(Clock::now()) - static_cast<std::int64_t>(_job));
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            for (auto& _thread : _threads)
+            {
+                _thread.join();
+            }
+        }
+        const double _fire_duration_ms = std::chrono::duration<double, std::milli>(Clock::now() - _phase_start).count();
+
+        _timers->Stop();
+
+        std::sort(_lags_ns.begin(), _lags_ns.end());
+
+        return BenchmarkResult{
+            _prefill_ms,
+            static_cast<double>(_thread_count * ScheduleCancelPerThread) / _schedule_cancel_sec,
+            _fire_duration_ms,
+            static_cast<double>(_lags_ns[_lags_ns.size() / 2]) / 1'000'000.0,
+            static_cast<double>(_lags_ns[(_lags_ns.size() - 1) * 99 / 100]) / 1'000'000.0,
+            _failed_cancel_count.load() == 0 && _lags_ns.front() >= 0};
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << "채우기=" << _result.prefill_ms << " ms | 예약+취소="
+                  << _result.schedule_cancel_ops_per_sec << " ops/sec | 만료 완료="
+                  << _result.fire_duration_ms << " ms (퍼짐 " << FireSpread.count() << " ms), 지연 p50="
+                  << _result.fire_lag_p50_ms << " ms, p99="
+                  << _result.fire_lag_p99_ms << " ms | 검증 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "TimerWheel vs 뮤텍스 priority_queue 벤치마크\n";
+    std::cout << "대기 타이머=" << PendingTimerCount
+              << " | 스레드당 예약+취소=" << ScheduleCancelPerThread
+              << " | 스레드당 만료=" << FirePerThread
+              << " | 틱=" << Tick.count() << " ms\n";
+
+    for (const size_t _thread_count : {1, 4})
+    {
+        std::cout << "\n스레드=" << _thread_count << '\n';
+        PrintResult("priority_queue", RunBenchmark<PriorityQueueTimers>(_thread_count));
+        PrintResult("TimerWheel", RunBenchmark<WheelTimers>(_thread_count));
+    }
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
@@ -0,0 +1,275 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mpmc_queue.h"
+#include "wait_free_queue.h"
+
+namespace
+{
+    constexpr size_t BenchmarkRepeatCount = 3;
+    constexpr size_t CallsPerThread = 200'000;
+
+    struct LatencySummary
+    {
+        double p50_ns = 0.0;
+        double p99_ns = 0.0;
+        double p9999_ns = 0.0;
+        double max_ns = 0.0;
+    };
+
+    struct BenchmarkResult
+    {
+        LatencySummary push;
+        LatencySummary pop;
+        double calls_per_sec;
+        double slow_path_ratio;
+        bool valid;
+    };
+
+    // 스레드 하나가 잰 호출별 지연 시간과 성공 횟수
+    struct ThreadStats
+    {
+        std::vector<std::int64_t> _latencies_ns;
+        std::uint64_t _success_count = 0;
+    };
+
+    double GetPercentileNs(const std::vector<std::int64_t>& _sorted_latencies_ns, double _percentile)
+    {
+        if (true == _sorted_latencies_ns.empty())
+        {
+            return 0.0;
+        }
+
+        const size_t _index = static_cast<size_t>(_percentile * static_cast<double>(_sorted_latencies_ns.size() - 1));
+        return static_cast<double>(_sorted_latencies_ns[_index]);
+    }
+
+    LatencySummary Summarize(const std::vector<ThreadStats>& _stats)
+    {
+        std::vector<std::int64_t> _merged;
+        for (const ThreadStats& _thread_stats : _stats)
+        {
+            _merged.insert(_merged.end(), _thread_stats._latencies_ns.begin(), _thread_stats._latencies_ns.end());
+        }
+
+        std::sort(_merged.begin(), _merged.end());
+
+        LatencySummary _summary;
+        _summary.p50_ns = GetPercentileNs(_merged, 0.50);
+        _summary.p99_ns = GetPercentileNs(_merged, 0.99);
+        _summary.p9999_ns = GetPercentileNs(_merged, 0.9999);
+        _summary.max_ns = true == _merged.empty() ? 0.0 : static_cast<double>(_merged.back());
+        return _summary;
+    }
+
+    template <typename QueueType>
+    double GetSlowPathRatio(const QueueType&, std::uint64_t)
+    {
+        return 0.0;
+    }
+
+    template <typename T, size_t Size>
+    double GetSlowPathRatio(const WaitFreeQueue<T, Size>& _queue, std::uint64_t _call_count)
+    {
+        return static_cast<double>(_queue.GetSlowPathCount()) / static_cast<double>(_call_count);
+    }
+
+    // 생산자와 소비자가 각자 정해진 횟수만큼 쉬지 않고 Push/Pop을 호출하며 호출 하나하나의 시간을 잰다.
+    // 실패한 호출(가득 참/빈 큐)도 한 번의 호출로 센다. 실시간 스레드는 틱마다 한 번 시도하고 넘어가기 때문이다.
+    // 용량을 작게 잡으면 가득 참/빈 큐 경계에서 상태 CAS가 계속 부딪히는 적대적인 경쟁이 된다.
+    template <typename QueueType>
+    BenchmarkResult RunBenchmarkOnce(size_t _producer_count, size_t _consumer_count)
+    {
+        auto _queue = std::make_unique<QueueType>();
+        const size_t _thread_count = _producer_count + _consumer_count;
+
+        std::vector<ThreadStats> _push_stats(_producer_count);
+        std::vector<ThreadStats> _pop_stats(_consumer_count);
+        std::atomic<size_t> _ready_count{0};
+        std::atomic<bool> _start{false};
+        std::vector<std::thread> _threads;
+
+        auto _wait_start = [&]()
+        {
+            _ready_count.fetch_add(1);
+            while (false == _start.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+        };
+
+        for (size_t _producer_index = 0; _producer_index < _producer_count; ++_producer_index)
+        {
+            _threads.emplace_back([&, _producer_index]()
+            {
+                ThreadStats& _stats = _push_stats[_producer_index];
+                _stats._latencies_ns.reserve(CallsPerThread);
+                _wait_start();
+
+                for (size_t i = 0; i < CallsPerThread; ++i)
+                {
+                    const auto _call_start = std::chrono::steady_clock::now();
+                    const bool _pushed = _queue->Push(static_cast<std::uint32_t>(i));
+                    const auto _call_end = std::chrono::steady_clock::now();
+
+                    _stats._latencies_ns.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(_call_end - _call_start).count());
+                    _stats._success_count += true == _pushed ? 1 : 0;
+                }
+            });
+        }
+
+        for (size_t _consumer_index = 0; _consumer_index < _consumer_count; ++_consumer_index)
+        {
+            _threads.emplace_back([&, _consumer_index]()
+            {
+                ThreadStats& _stats = _pop_stats[_consumer_index];
+                _stats._latencies_ns.reserve(CallsPerThread);
+                _wait_start();
+
+                std::uint32_t _item = 0;
+                for (size_t i = 0; i < CallsPerThread; ++i)
+                {
+                    const auto _call_start = std::chrono::steady_clock::now();
+                    const bool _popped = _queue->Pop(_item);
+                    const auto _call_end = std::chrono::steady_clock::now();
+
+                    _stats._latencies_ns.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(_call_end - _call_start).count());
+                    _stats._success_count += true == _popped ? 1 : 0;
+                }
+            });
+        }
+
+        while (_ready_count.load() < _thread_count)
+        {
+            std::this_thread::yield();
+        }
+
+        const auto _start_time = std::chrono::steady_clock::now();
+        _start.store(true, std::memory_order_release);
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const double _duration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start_time).count();
+
+        // 남은 항목까지 꺼내 넣은 수와 꺼낸 수가 맞는지 확인한다
+        std::uint64_t _pushed_count = 0;
+        std::uint64_t _popped_count = 0;
+        for (const ThreadStats& _stats : _push_stats)
+        {
+            _pushed_count += _stats._success_count;
+        }
+
+        for (const ThreadStats& _stats : _pop_stats)
+        {
+            _popped_count += _stats._success_count;
+        }
+
+        std::uint32_t _item = 0;
+        while (true == _queue->Pop(_item))
+        {
+            ++_popped_count;
+        }
+
+        const std::uint64_t _call_count = static_cast<std::uint64_t>(_thread_count * CallsPerThread);
+        return BenchmarkResult{
+            Summarize(_push_stats),
+            Summarize(_pop_stats),
+            static_cast<double>(_call_count) / _duration_sec,
+            GetSlowPathRatio(*_queue, _call_count),
+            _pushed_count == _popped_count};
+    }
+
+    // 꼬리 지연(p99.99)의 중앙값인 반복을 고른다
+    BenchmarkResult GetMedianResult(std::array<BenchmarkResult, BenchmarkRepeatCount> _results)
+    {
+        std::sort(_results.begin(), _results.end(), [](const BenchmarkResult& _left, const BenchmarkResult& _right)
+        {
+            return std::max(_left.push.p9999_ns, _left.pop.p9999_ns) < std::max(_right.push.p9999_ns, _right.pop.p9999_ns);
+        });
+
+        return _results[BenchmarkRepeatCount / 2];
+    }
+
+    void PrintLatency(const char* _label, const LatencySummary& _summary)
+    {
+        std::cout << "    " << _label
+                  << std::fixed << std::setprecision(0)
+                  << " p50 " << std::setw(7) << _summary.p50_ns
+                  << " ns | p99 " << std::setw(8) << _summary.p99_ns
+                  << " ns | p99.99 " << std::setw(9) << _summary.p9999_ns
+                  << " ns | max " << std::setw(10) << _summary.max_ns << " ns\n";
+    }
+
+    void PrintResult(const char* _name, const BenchmarkResult& _result)
+    {
+        std::cout << "  " << _name << ": "
+                  << std::fixed << std::setprecision(2)
+                  << _result.calls_per_sec << " calls/sec | 느린 경로 "
+                  << _result.slow_path_ratio * 100.0 << "% | 검증 "
+                  << (true == _result.valid ? "정상" : "오류") << '\n';
+        PrintLatency("Push", _result.push);
+        PrintLatency("Pop ", _result.pop);
+    }
+
+    // 두 큐를 번갈아 실행하고 중앙값을 출력한다
+    template <size_t Capacity>
+    void RunComparison(size_t _producer_count, size_t _consumer_count)
+    {
+        using LockFreeQueue = MPMCQueue<std::uint32_t, Capacity>;
+        using WaitFree = WaitFreeQueue<std::uint32_t, Capacity>;
+
+        constexpr size_t CaseCount = 2;
+        std::array<std::array<BenchmarkResult, BenchmarkRepeatCount>, CaseCount> _results;
+
+        for (size_t _repeat_index = 0; _repeat_index < BenchmarkRepeatCount; ++_repeat_index)
+        {
+            for (size_t _offset = 0; _offset < CaseCount; ++_offset)
+            {
+                const size_t _case_index = (_repeat_index + _offset) % CaseCount;
+                _results[_case_index][_repeat_index] = _case_index == 0
+                    ? RunBenchmarkOnce<LockFreeQueue>(_producer_count, _consumer_count)
+                    : RunBenchmarkOnce<WaitFree>(_producer_count, _consumer_count);
+            }
+        }
+
+        std::cout << "\n" << _producer_count << "P/" << _consumer_count << "C | 용량=" << Capacity << '\n';
+        PrintResult("MPMCQueue    ", GetMedianResult(_results[0]));
+        PrintResult("WaitFreeQueue", GetMedianResult(_results[1]));
+    }
+}
+
+int main()
+{
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "WaitFreeQueue vs MPMCQueue 호출별 지연 벤치마크\n";
+    std::cout << "스레드당 호출=" << CallsPerThread
+              << " | 항목=uint32_t | 반복=" << BenchmarkRepeatCount << "회 후 p99.99 중앙값 사용\n";
+    std::cout << "지연: Push/Pop 호출 하나의 시간 (실패한 호출 포함, steady_clock 측정 오차 포함)\n";
+    std::cout << "하드웨어 스레드=" << std::thread::hardware_concurrency()
+              << " (스레드 수가 이보다 많으면 최대 지연은 선점 시간이 지배한다)\n";
+
+    RunComparison<1024>(2, 2);
+    RunComparison<1024>(6, 6);
+    RunComparison<16>(6, 6);
+
+    std::cout << "\n모든 벤치마크 완료\n";
+    return 0;
+}
@@ -0,0 +1,273 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "batching_producer.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    // 묶음 크기에 도달한 순간 한 번의 Push로 전달되고, 항목 순서가 유지되는지 확인한다.
+    void TestCountThresholdFlush()
+    {
+        using Producer = BatchingProducer<int, 4, 8>;
+        Producer::QueueType _queue;
+        Producer::BatchType _batch{};
+
+        {
+            Producer _producer(_queue, std::chrono::hours(1));
+
+            for (int i = 0; i < 3; ++i)
+            {
+                Check(true == _producer.Push(i), "버퍼 Push 실패");
+            }
+
+            Check(true == _queue.IsEmpty(), "묶음 크기 전에 큐로 전달됨");
+            Check(_producer.GetPendingCount() == 3, "버퍼의 항목 수가 틀림");
+
+            Check(true == _producer.Push(3), "네 번째 Push 실패");
+            Check(_queue.GetSize() == 1, "묶음 크기에 도달했는데 전달되지 않음");
+            Check(_producer.GetPendingCount() == 0, "전달 후 버퍼가 비어 있지 않음");
+
+            Check(true == _queue.Pop(_batch), "묶음 Pop 실패");
+            Check(_batch._count == 4, "묶음의 항목 수가 틀림");
+
+            for (size_t i = 0; i < _batch._count; ++i)
+            {
+                Check(_batch._items[i] == static_cast<int>(i), "묶음 안의 항목 순서가 틀림");
+            }
+
+            Check(true == _producer.Push(100), "소멸 전 Push 실패");
+        }
+
+        // 소멸 시 남은 항목이 전달되어야 함
+        Check(true == _queue.Pop(_batch), "소멸 시 남은 항목이 전달되지 않음");
+        Check(_batch._count == 1 && _batch._items[0] == 100, "소멸 시 전달된 묶음 내용이 틀림");
+    }
+
+    // 최대 지연 시간이 지난 뒤 들어온 첫 Push에서 묶음 크기와 관계없이 전달되는지 확인한다.
+    // Flush는 빈 버퍼에서 아무것도 전달하지 않아야 한다.
+    void TestDeadlineAndExplicitFlush()
+    {
+        using Producer = BatchingProducer<int, 4, 8>;
+        Producer::QueueType _queue;
+        Producer::BatchType _batch{};
+        Producer _producer(_queue, std::chrono::milliseconds(1));
+
+        Check(true == _producer.Flush(), "빈 버퍼 Flush 실패");
+        Check(true == _queue.IsEmpty(), "빈 버퍼 Flush가 묶음을 전달함");
+
+        Check(true == _producer.Push(1), "첫 번째 Push 실패");
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        Check(true == _queue.IsEmpty(), "Push 없이 전달됨");
+
+        Check(true == _producer.Push(2), "두 번째 Push 실패");
+        Check(_queue.GetSize() == 1, "지연 시간이 지난 뒤 첫 Push에서 전달되지 않음");
+        Check(true == _queue.Pop(_batch) && _batch._count == 2, "지연 시간 초과 묶음 내용이 틀림");
+
+        Check(true == _producer.Push(3), "세 번째 Push 실패");
+        Check(true == _producer.Flush(), "명시적 Flush 실패");
+        Check(true == _queue.Pop(_batch) && _batch._count == 1 && _batch._items[0] == 3, "명시적 Flush 묶음 내용이 틀림");
+    }
+
+    // 큐가 가득 차 전달하지 못하면 항목을 잃지 않고 false를 반환하는지 확인한다.
+    void TestQueueFull()
+    {
+        using Producer = BatchingProducer<int, 2, 2>;
+        Producer::QueueType _queue;
+        Producer::BatchType _batch{};
+
+        {
+            Producer _producer(_queue, std::chrono::hours(1));
+
+            for (int i = 0; i < 4; ++i)
+            {
+                Check(true == _producer.Push(i), "큐가 가득 차기 전 Push 실패");
+            }
+
+            // 큐(용량 2)가 가득 찬 상태에서 버퍼(용량 2)까지 채움
+            Check(true == _producer.Push(4), "버퍼 Push 실패");
+            Check(true == _producer.Push(5), "버퍼를 채우는 Push 실패");
+            Check(false == _producer.Push(6), "큐와 버퍼가 모두 가득 찼는데 Push가 성공함");
+            Check(_producer.GetPendingCount() == 2, "전달 실패 후 버퍼 항목 수가 틀림");
+
+            Check(true == _queue.Pop(_batch), "첫 번째 묶음 Pop 실패");
+            Check(true == _producer.Push(6), "큐에 공간이 생긴 뒤 Push 실패");
+
+            Check(true == _queue.Pop(_batch) && _batch._items[0] == 2, "두 번째 묶음 내용이 틀림");
+            Check(true == _queue.Pop(_batch) && _batch._items[0] == 4 && _batch._items[1] == 5, "세 번째 묶음 내용이 틀림");
+        }
+
+        Check(true == _queue.Pop(_batch) && _batch._count == 1 && _batch._items[0] == 6, "소멸 시 남은 항목이 전달되지 않음");
+
+        // 소비자가 없어 큐가 가득 찬 채로 소멸하면 제한 시간 뒤 남은 묶음을 버리고 돌아와야 한다
+        const auto _start_time = std::chrono::steady_clock::now();
+        {
+            Producer _producer(_queue, std::chrono::hours(1), std::chrono::milliseconds(5));
+
+            for (int i = 0; i < 5; ++i)
+            {
+                _producer.Push(i);
+            }
+
+            Check(false == _producer.FlushFor(std::chrono::milliseconds(1)), "큐가 가득 찼는데 FlushFor가 성공함");
+        }
+
+        Check(std::chrono::steady_clock::now() - _start_time < std::chrono::seconds(5), "큐가 가득 찬 채 소멸이 끝나지 않음");
+        Check(_queue.GetSize() == 2, "버린 묶음이 큐에 들어감");
+    }
+
+    // 여러 생산자가 각자의 BatchingProducer로 전달할 때 누락 없이 생산자별 순서가 유지되는지 확인한다.
+    void TestConcurrentPerProducerOrder()
+    {
+        constexpr size_t ProducerCount = 4;
+        constexpr size_t ItemsPerProducer = 100'000;
+
+        using Producer = BatchingProducer<size_t, 16, 64>;
+        auto _queue = std::make_unique<Producer::QueueType>();
+        std::atomic<size_t> _finished_producer_count{0};
+
+        std::vector<std::thread> _producers;
+        for (size_t _producer_index = 0; _producer_index < ProducerCount; ++_producer_index)
+        {
+            _producers.emplace_back([&, _producer_index]()
+            {
+                {
+                    Producer _producer(*_queue, std::chrono::microseconds(50));
+
+                    for (size_t _offset = 0; _offset < ItemsPerProducer; ++_offset)
+                    {
+                        while (false == _producer.Push(_producer_index * ItemsPerProducer + _offset))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+
+                _finished_producer_count.fetch_add(1, std::memory_order_release);
+            });
+        }
+
+        std::vector<size_t> _next_expected(ProducerCount, 0);
+        size_t _received_count = 0;
+        size_t _order_error_count = 0;
+        Producer::BatchType _batch{};
+
+        while (_received_count < ProducerCount * ItemsPerProducer)
+        {
+            if (false == _queue->Pop(_batch))
+            {
+                if (_finished_producer_count.load(std::memory_order_acquire) == ProducerCount && true == _queue->IsEmpty())
+                {
+                    break;
+                }
+
+                std::this_thread::yield();
+                continue;
+            }
+
+            for (size_t i = 0; i < _batch._count; ++i)
+            {
+                const size_t _producer_index = _batch._items[i] / ItemsPerProducer;
+                const size_t _offset = _batch._items[i] % ItemsPerProducer;
+
+                if (_producer_index >= ProducerCount || _offset != _next_expected[_producer_index])
+                {
+                    ++_order_error_count;
+                    continue;
+                }
+
+                ++_next_expected[_producer_index];
+            }
+
+            _received_count += _batch._count;
+        }
+
+        for (auto& _producer : _producers)
+        {
+            _producer.join();
+        }
+
+        Check(_received_count == ProducerCount * ItemsPerProducer, "전달된 항목 수가 예상과 다름");
+        Check(_order_error_count == 0, "생산자별 순서가 유지되지 않음");
+
+        std::cout << "       생산자=" << ProducerCount
+                  << " | 예상=" << ProducerCount * ItemsPerProducer
+                  << " | 수신=" << _received_count
+                  << " | 순서 오류=" << _order_error_count << '\n';
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 4;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "BatchingProducer 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("개수 기준 전달", "묶음 크기=4 | 순서 유지 | 소멸 시 전달", TestCountThresholdFlush);
+    _passed_test_count += RunTest("지연 시간 기준 및 명시적 전달", "최대 지연=1ms | 묶음 크기=4 | 지연 후 첫 Push", TestDeadlineAndExplicitFlush);
+    _passed_test_count += RunTest("가득 찬 큐", "묶음 크기=2 | 큐 용량=2 | 항목 손실 검사 | 소멸 제한 시간", TestQueueFull);
+    _passed_test_count += RunTest("동시 생산자별 순서", "생산자=4 | 항목=400000개 | 누락/순서 검사", TestConcurrentPerProducerOrder);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
@@ -0,0 +1,317 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "channel.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    // 마지막 Sender가 사라질 때만 닫히고, 닫힌 뒤에도 남은 항목을 먼저 받는지 확인한다.
+    void TestCloseAfterDrain()
+    {
+        auto [_sender, _receiver] = MakeChannel<int, 8>();
+        int _value = 0;
+
+        Check(_receiver.TryReceive(_value) == lfq::ChannelStatus::Empty, "빈 채널에서 Empty가 아님");
+
+        Sender<int, 8> _cloned_sender = _sender;
+        Check(_sender.TrySend(1) == lfq::ChannelStatus::Ok, "첫 번째 보내기 실패");
+        Check(_cloned_sender.TrySend(2) == lfq::ChannelStatus::Ok, "복사한 Sender의 보내기 실패");
+
+        _sender.Reset();
+        Check(_receiver.TryReceive(_value) == lfq::ChannelStatus::Ok && _value == 1, "Sender 하나가 남았는데 받기 실패");
+
+        _cloned_sender.Reset();
+        Check(_receiver.TryReceive(_value) == lfq::ChannelStatus::Ok && _value == 2, "닫힌 뒤 남은 항목을 받지 못함");
+        Check(_receiver.TryReceive(_value) == lfq::ChannelStatus::Closed, "모두 받은 뒤 Closed가 아님");
+        Check(false == _receiver.Receive(_value), "닫히고 빈 채널에서 Receive가 true를 반환함");
+    }
+
+    // 모든 Receiver가 사라지면 보내기가 Closed를 반환하고, 가득 차면 Full을 반환하는지 확인한다.
+    void TestSendStatus()
+    {
+        auto [_sender, _receiver] = MakeChannel<int, 2>();
+
+        Check(_sender.TrySend(1) == lfq::ChannelStatus::Ok, "첫 번째 보내기 실패");
+        Check(_sender.TrySend(2) == lfq::ChannelStatus::Ok, "두 번째 보내기 실패");
+        Check(_sender.TrySend(3) == lfq::ChannelStatus::Full, "가득 찬 채널에서 Full이 아님");
+
+        Receiver<int, 2> _cloned_receiver = _receiver;
+        _receiver.Reset();
+        int _value = 0;
+        Check(_cloned_receiver.TryReceive(_value) == lfq::ChannelStatus::Ok, "복사한 Receiver의 받기 실패");
+        Check(_sender.TrySend(3) == lfq::ChannelStatus::Ok, "Receiver가 남았는데 보내기 실패");
+
+        _cloned_receiver.Reset();
+        Check(_sender.TrySend(4) == lfq::ChannelStatus::Closed, "Receiver가 모두 사라졌는데 Closed가 아님");
+        Check(false == _sender.Send(4), "Receiver가 모두 사라졌는데 Send가 true를 반환함");
+    }
+
+    // Reset했거나 이동해 빈 핸들이 된 Sender/Receiver가 죽지 않고 Closed를 반환하는지 확인한다.
+    void TestEmptyHandles()
+    {
+        auto [_sender, _receiver] = MakeChannel<int, 4>();
+        int _value = 0;
+
+        Sender<int, 4> _moved_sender = std::move(_sender);
+        Check(_sender.TrySend(1) == lfq::ChannelStatus::Closed, "이동한 Sender의 보내기가 Closed가 아님");
+        Check(false == _sender.Send(1), "이동한 Sender의 Send가 true를 반환함");
+        Check(_moved_sender.TrySend(1) == lfq::ChannelStatus::Ok, "이동받은 Sender의 보내기 실패");
+
+        Receiver<int, 4> _moved_receiver = std::move(_receiver);
+        Check(_receiver.TryReceive(_value) == lfq::ChannelStatus::Closed, "이동한 Receiver의 받기가 Closed가 아님");
+        Check(false == _receiver.Receive(_value), "이동한 Receiver의 Receive가 true를 반환함");
+        Check(_moved_receiver.TryReceive(_value) == lfq::ChannelStatus::Ok && _value == 1, "이동받은 Receiver의 받기 실패");
+
+        Sender<int, 4> _reset_sender = _moved_sender;
+        _reset_sender.Reset();
+        Check(_reset_sender.TrySend(2) == lfq::ChannelStatus::Closed, "Reset한 Sender의 보내기가 Closed가 아님");
+
+        Receiver<int, 4> _reset_receiver = _moved_receiver;
+        _reset_receiver.Reset();
+        Check(_reset_receiver.TryReceive(_value) == lfq::ChannelStatus::Closed, "Reset한 Receiver의 받기가 Closed가 아님");
+        Check(false == _reset_receiver.Receive(_value), "Reset한 Receiver의 Receive가 true를 반환함");
+
+        // 빈 핸들을 다뤄도 원래 채널은 그대로 동작해야 한다
+        Check(_moved_sender.TrySend(3) == lfq::ChannelStatus::Ok, "빈 핸들 처리 후 보내기 실패");
+        Check(_moved_receiver.TryReceive(_value) == lfq::ChannelStatus::Ok && _value == 3, "빈 핸들 처리 후 받기 실패");
+    }
+
+    // Select가 항목이 있는 채널의 핸들러만 실행하고, 모든 채널이 닫히고 비면 SELECT_CLOSED를 반환하는지 확인한다.
+    void TestSelectReadyAndClosed()
+    {
+        // 람다에서 캡처하므로 구조적 바인딩 대신 참조를 사용
+        auto _int_channel = MakeChannel<int, 8>();
+        auto _double_channel = MakeChannel<double, 8>();
+        auto& _int_sender = _int_channel.first;
+        auto& _int_receiver = _int_channel.second;
+        auto& _double_sender = _double_channel.first;
+        auto& _double_receiver = _double_channel.second;
+        int _int_value = 0;
+        double _double_value = 0.0;
+
+        auto _select = [&]()
+        {
+            return Select(
+                OnReceive(_int_receiver, [&_int_value](int _value) { _int_value = _value; }),
+                OnReceive(_double_receiver, [&_double_value](double _value) { _double_value = _value; }));
+        };
+
+        _double_sender.TrySend(2.5);
+        Check(_select() == 1 && _double_value == 2.5, "항목이 있는 두 번째 채널을 고르지 않음");
+
+        _int_sender.TrySend(7);
+        _int_sender.Reset();
+        Check(_select() == 0 && _int_value == 7, "닫힌 채널의 남은 항목을 고르지 않음");
+
+        _double_sender.TrySend(3.5);
+        Check(_select() == 1 && _double_value == 3.5, "한 채널이 닫힌 뒤 다른 채널을 고르지 않음");
+
+        _double_sender.Reset();
+        Check(_select() == lfq::SELECT_CLOSED, "모든 채널이 닫혔는데 SELECT_CLOSED가 아님");
+    }
+
+    // 간격을 두고 보내는 여러 채널을 Select 하나로 잠들며 기다릴 때
+    // 누락 없이 채널별 순서대로 받고, 모든 Sender가 끝나면 SELECT_CLOSED로 끝나는지 확인한다.
+    void TestConcurrentSelect()
+    {
+        constexpr std::int64_t ItemsPerChannel = 20'000;
+
+        auto [_first_sender, _first_receiver] = MakeChannel<std::int64_t, 64>();
+        auto [_second_sender, _second_receiver] = MakeChannel<std::int64_t, 64>();
+        auto [_third_sender, _third_receiver] = MakeChannel<std::int64_t, 64>();
+
+        auto _produce = [](Sender<std::int64_t, 64> _sender, size_t _pause_interval)
+        {
+            for (std::int64_t _value = 0; _value < ItemsPerChannel; ++_value)
+            {
+                _sender.Send(_value);
+
+                // 수신 스레드가 자주 잠들도록 주기적으로 쉼
+                if ((static_cast<size_t>(_value) % _pause_interval) == 0)
+                {
+                    std::this_thread::sleep_for(std::chrono::microseconds(20));
+                }
+            }
+        };
+
+        std::vector<std::thread> _producers;
+        _producers.emplace_back(_produce, std::move(_first_sender), 89);
+        _producers.emplace_back(_produce, std::move(_second_sender), 97);
+        _producers.emplace_back(_produce, std::move(_third_sender), 101);
+
+        std::int64_t _next_expected[3] = {0, 0, 0};
+        size_t _order_error_count = 0;
+
+        auto _make_handler = [&_next_expected, &_order_error_count](size_t _channel_index)
+        {
+            return [&_next_expected, &_order_error_count, _channel_index](std::int64_t _value)
+            {
+                if (_value != _next_expected[_channel_index])
+                {
+                    ++_order_error_count;
+                }
+                _next_expected[_channel_index] = _value + 1;
+            };
+        };
+
+        size_t _select_count = 0;
+        while (Select(
+                   OnReceive(_first_receiver, _make_handler(0)),
+                   OnReceive(_second_receiver, _make_handler(1)),
+                   OnReceive(_third_receiver, _make_handler(2))) != lfq::SELECT_CLOSED)
+        {
+            ++_select_count;
+        }
+
+        for (auto& _producer : _producers)
+        {
+            _producer.join();
+        }
+
+        Check(_select_count == static_cast<size_t>(ItemsPerChannel) * 3, "Select 처리 횟수가 보낸 항목 수와 다름");
+        Check(_order_error_count == 0, "채널별 순서가 유지되지 않음");
+        Check(_next_expected[0] == ItemsPerChannel && _next_expected[1] == ItemsPerChannel && _next_expected[2] == ItemsPerChannel,
+              "모든 채널의 항목을 받지 못함");
+
+        std::cout << "       채널=3 | 예상=" << ItemsPerChannel * 3
+                  << " | 수신=" << _select_count
+                  << " | 순서 오류=" << _order_error_count << '\n';
+    }
+
+    // 복사한 Receiver 여러 개가 Receive로 잠들며 나눠 받을 때 누락이나 중복이 없는지 확인한다.
+    void TestMultipleReceivers()
+    {
+        constexpr size_t ReceiverCount = 3;
+        constexpr std::int64_t ItemCount = 60'000;
+
+        auto _channel = MakeChannel<std::int64_t, 128>();
+        auto& _sender = _channel.first;
+        auto& _receiver = _channel.second;
+        std::vector<std::uint8_t> _seen(ItemCount, 0);
+        std::atomic<size_t> _duplicate_count{0};
+        std::atomic<size_t> _received_count{0};
+
+        std::vector<std::thread> _receivers;
+        for (size_t _receiver_index = 0; _receiver_index < ReceiverCount; ++_receiver_index)
+        {
+            _receivers.emplace_back([&, _cloned_receiver = _receiver]() mutable
+            {
+                std::int64_t _value = 0;
+                while (true == _cloned_receiver.Receive(_value))
+                {
+                    if (_seen[_value] != 0)
+                    {
+                        _duplicate_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    _seen[_value] = 1;
+                    _received_count.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        _receiver.Reset();
+
+        for (std::int64_t _value = 0; _value < ItemCount; ++_value)
+        {
+            _sender.Send(_value);
+
+            if ((_value % 1000) == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+
+        _sender.Reset();
+
+        for (auto& _thread : _receivers)
+        {
+            _thread.join();
+        }
+
+        Check(_received_count.load() == static_cast<size_t>(ItemCount), "받은 항목 수가 보낸 항목 수와 다름");
+        Check(_duplicate_count.load() == 0, "같은 항목을 두 번 받음");
+
+        std::cout << "       Receiver=" << ReceiverCount
+                  << " | 예상=" << ItemCount
+                  << " | 수신=" << _received_count.load()
+                  << " | 중복=" << _duplicate_count.load() << '\n';
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 6;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "Channel 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("닫기 전 남은 항목 받기", "Sender 참조 수 | 닫힌 뒤 남은 항목 | Closed", TestCloseAfterDrain);
+    _passed_test_count += RunTest("보내기 상태", "Full | Receiver 참조 수 | Closed", TestSendStatus);
+    _passed_test_count += RunTest("빈 핸들", "이동한 핸들 | Reset한 핸들 | Closed", TestEmptyHandles);
+    _passed_test_count += RunTest("Select 선택과 닫힘", "항목이 있는 채널 선택 | SELECT_CLOSED", TestSelectReadyAndClosed);
+    _passed_test_count += RunTest("동시 Select", "채널=3 | 항목=60000개 | 누락/순서 검사", TestConcurrentSelect);
+    _passed_test_count += RunTest("여러 Receiver", "Receiver=3 | 항목=60000개 | 누락/중복 검사", TestMultipleReceivers);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
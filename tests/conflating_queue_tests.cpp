@@ -0,0 +1,299 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "conflating_queue.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    // 모든 word가 같은 값이어야 하는 값: 찢어진 읽기가 있으면 word가 서로 달라진다
+    struct WideValue
+    {
+        std::uint64_t _words[5];
+    };
+
+    // 같은 키를 여러 번 갱신하면 처음에만 큐에 들어가고, Pop은 마지막 값을 돌려주는지 확인한다.
+    void TestConflation()
+    {
+        auto _queue = std::make_unique<ConflatingQueue<std::uint64_t, 8>>();
+
+        Check(true == _queue->Update(3, 10), "첫 갱신이 키를 넣지 않음");
+        Check(false == _queue->Update(3, 11), "dirty 키를 다시 넣음");
+        Check(false == _queue->Update(3, 12), "dirty 키를 다시 넣음");
+        Check(true == _queue->Update(5, 50), "다른 키의 첫 갱신이 키를 넣지 않음");
+        Check(false == _queue->Update(8, 80), "범위를 벗어난 키를 받아들임");
+        Check(_queue->GetPendingCount() == 2, "대기 중인 키 수가 틀림");
+
+        size_t _key = 0;
+        std::uint64_t _value = 0;
+        Check(true == _queue->Pop(_key, _value) && _key == 3 && _value == 12, "첫 키의 최신 값이 아님");
+        Check(true == _queue->Pop(_key, _value) && _key == 5 && _value == 50, "두 번째 키가 틀림");
+        Check(false == _queue->Pop(_key, _value) && true == _queue->IsEmpty(), "빈 큐에서 Pop이 성공함");
+
+        _queue->Read(7, _value);
+        Check(_value == 0, "갱신하지 않은 키가 0이 아님");
+        _queue->Read(3, _value);
+        Check(_value == 12, "Read가 최신 값을 돌려주지 않음");
+    }
+
+    // Pop으로 clean이 된 키는 다음 갱신에서 다시 큐에 들어가고, 모든 키가 dirty여도 링이 넘치지 않는지 확인한다.
+    void TestRequeueAfterPop()
+    {
+        constexpr size_t KeyCount = 100;
+        auto _queue = std::make_unique<ConflatingQueue<std::uint32_t, KeyCount>>();
+
+        for (int _round = 0; _round < 3; ++_round)
+        {
+            for (size_t _key = 0; _key < KeyCount; ++_key)
+            {
+                Check(true == _queue->Update(_key, static_cast<std::uint32_t>(_round * 1000 + _key)), "clean 키가 다시 들어가지 않음");
+                _queue->Update(_key, static_cast<std::uint32_t>(_round * 1000 + _key + 1));
+            }
+
+            Check(_queue->GetPendingCount() == KeyCount, "대기 중인 키 수가 키 수와 다름");
+
+            size_t _key = 0;
+            std::uint32_t _value = 0;
+            size_t _pop_count = 0;
+            bool _ordered = true;
+
+            while (true == _queue->Pop(_key, _value))
+            {
+                _ordered = _ordered && _key == _pop_count && _value == _round * 1000 + _key + 1;
+                ++_pop_count;
+            }
+
+            Check(_pop_count == KeyCount && true == _ordered, "키가 dirty가 된 순서나 최신 값이 틀림");
+        }
+    }
+
+    // 생산자마다 자기 키를 증가하는 값으로 갱신하는 동안, 소비자가 키별로 값이 줄지 않고 마지막 값을 받는지 확인한다.
+    void TestConcurrentProducers()
+    {
+        constexpr size_t ProducerCount = 4;
+        constexpr size_t KeysPerProducer = 16;
+        constexpr size_t KeyCount = ProducerCount * KeysPerProducer;
+        constexpr std::uint64_t UpdatesPerKey = 20'000;
+
+        auto _queue = std::make_unique<ConflatingQueue<std::uint64_t, KeyCount>>();
+        std::atomic<size_t> _finished_count{0};
+        std::vector<std::thread> _producers;
+
+        for (size_t _producer_index = 0; _producer_index < ProducerCount; ++_producer_index)
+        {
+            _producers.emplace_back([&_queue, &_finished_count, _producer_index]()
+            {
+                for (std::uint64_t _value = 1; _value <= UpdatesPerKey; ++_value)
+                {
+                    for (size_t i = 0; i < KeysPerProducer; ++i)
+                    {
+                        _queue->Update(_producer_index * KeysPerProducer + i, _value);
+                    }
+
+                    // 코어가 적어도 소비자가 중간 값을 꺼낼 기회를 준다
+                    if (_value % 64 == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                _finished_count.fetch_add(1, std::memory_order_release);
+            });
+        }
+
+        std::array<std::uint64_t, KeyCount> _last_values{};
+        bool _monotonic = true;
+        size_t _pop_count = 0;
+        size_t _key = 0;
+        std::uint64_t _value = 0;
+
+        while (true)
+        {
+            // 생산자가 모두 끝난 것을 본 뒤에 한 번 더 비워야 마지막 갱신을 놓치지 않는다
+            const bool _finished = _finished_count.load(std::memory_order_acquire) == ProducerCount;
+
+            while (true == _queue->Pop(_key, _value))
+            {
+                _monotonic = _monotonic && _value >= _last_values[_key];
+                _last_values[_key] = _value;
+                ++_pop_count;
+            }
+
+            if (true == _finished)
+            {
+                break;
+            }
+
+            std::this_thread::yield();
+        }
+
+        for (auto& _producer : _producers)
+        {
+            _producer.join();
+        }
+
+        bool _all_latest = true;
+        for (const std::uint64_t _last_value : _last_values)
+        {
+            _all_latest = _all_latest && _last_value == UpdatesPerKey;
+        }
+
+        Check(true == _monotonic, "키의 값이 거꾸로 감");
+        Check(true == _all_latest, "마지막 갱신을 받지 못한 키가 있음");
+        Check(_pop_count < KeyCount * UpdatesPerKey, "갱신이 하나도 합쳐지지 않음");
+
+        std::cout << "       갱신=" << KeyCount * UpdatesPerKey << " | Pop=" << _pop_count << '\n';
+    }
+
+    // 여러 생산자가 같은 키에 여러 word짜리 값을 쓰는 동안, Pop과 Read가 찢어진 값을 보지 않는지 확인한다.
+    void TestSharedKeysNoTornRead()
+    {
+        constexpr size_t ProducerCount = 3;
+        constexpr size_t KeyCount = 4;
+        constexpr std::uint64_t UpdatesPerProducer = 100'000;
+
+        auto _queue = std::make_unique<ConflatingQueue<WideValue, KeyCount>>();
+        std::atomic<size_t> _finished_count{0};
+        std::vector<std::thread> _producers;
+
+        for (size_t _producer_index = 0; _producer_index < ProducerCount; ++_producer_index)
+        {
+            _producers.emplace_back([&_queue, &_finished_count, _producer_index]()
+            {
+                for (std::uint64_t i = 0; i < UpdatesPerProducer; ++i)
+                {
+                    const std::uint64_t _stamp = (_producer_index + 1) * UpdatesPerProducer + i;
+                    _queue->Update(i % KeyCount, WideValue{{_stamp, _stamp, _stamp, _stamp, _stamp}});
+
+                    if (i % 256 == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                _finished_count.fetch_add(1, std::memory_order_release);
+            });
+        }
+
+        const auto _is_consistent = [](const WideValue& _value)
+        {
+            for (const std::uint64_t _word : _value._words)
+            {
+                if (_word != _value._words[0])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        };
+
+        bool _consistent = true;
+        size_t _pop_count = 0;
+        size_t _key = 0;
+        WideValue _value{};
+
+        while (_finished_count.load(std::memory_order_acquire) != ProducerCount)
+        {
+            if (true == _queue->Pop(_key, _value))
+            {
+                _consistent = _consistent && _is_consistent(_value);
+                ++_pop_count;
+            }
+
+            _queue->Read(_pop_count % KeyCount, _value);
+            _consistent = _consistent && _is_consistent(_value);
+        }
+
+        for (auto& _producer : _producers)
+        {
+            _producer.join();
+        }
+
+        while (true == _queue->Pop(_key, _value))
+        {
+            _consistent = _consistent && _is_consistent(_value);
+            ++_pop_count;
+        }
+
+        Check(true == _consistent, "찢어진 값을 읽음");
+        Check(_pop_count > 0, "키를 하나도 꺼내지 못함");
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 4;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "ConflatingQueue 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("갱신 합치기", "키=8 | 같은 키 3회 갱신 | 범위 밖 키", TestConflation);
+    _passed_test_count += RunTest("Pop 후 재등록", "키=100 | 3라운드 | 모든 키 dirty", TestRequeueAfterPop);
+    _passed_test_count += RunTest("동시 생산자", "생산자=4 | 키=64 | 키당 갱신=20000", TestConcurrentProducers);
+    _passed_test_count += RunTest("공유 키 찢어진 읽기", "생산자=3 | 키=4 | 값=40바이트", TestSharedKeysNoTornRead);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
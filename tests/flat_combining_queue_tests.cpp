@@ -0,0 +1,298 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "flat_combining_queue.h"
+#include "thread_registry.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    // 한 스레드에서 FIFO 순서, 가득 참/비어 있음, 실패한 Push가 항목을 돌려주는지 확인한다.
+    void TestSequentialBehavior()
+    {
+        constexpr size_t QueueSize = 8;
+        auto _queue = std::make_unique<FlatCombiningQueue<std::unique_ptr<int>, QueueSize>>();
+
+        std::unique_ptr<int> _item;
+        Check(false == _queue->Pop(_item) && true == _queue->IsEmpty(), "빈 큐에서 Pop이 성공함");
+
+        for (int i = 0; i < static_cast<int>(QueueSize); ++i)
+        {
+            Check(true == _queue->Push(std::make_unique<int>(i)), "가득 차기 전에 Push 실패");
+        }
+
+        auto _overflow = std::make_unique<int>(100);
+        Check(false == _queue->Push(std::move(_overflow)), "가득 찬 큐에 Push 성공");
+        Check(nullptr != _overflow && *_overflow == 100, "실패한 Push가 항목을 돌려주지 않음");
+        Check(_queue->GetSize() == QueueSize, "크기가 틀림");
+
+        bool _ordered = true;
+        for (int i = 0; i < static_cast<int>(QueueSize); ++i)
+        {
+            _ordered = _ordered && true == _queue->Pop(_item) && nullptr != _item && *_item == i;
+        }
+
+        Check(true == _ordered, "FIFO 순서가 틀림");
+        Check(false == _queue->Pop(_item) && true == _queue->IsEmpty(), "비운 큐에서 Pop이 성공함");
+
+        const lfq::CombinerStats _stats = _queue->GetCombinerStats();
+        Check(_stats._request_count == QueueSize * 2 + 3 && _stats._pass_count == _stats._request_count, "단일 스레드 결합 통계가 틀림");
+    }
+
+    // 살아 있는 스레드끼리 번호가 겹치지 않고, 끝난 스레드의 번호가 반납되는지 확인한다.
+    void TestThreadRegistry()
+    {
+        constexpr size_t ThreadCount = 8;
+
+        const size_t _main_index = ThreadRegistry::GetThreadIndex();
+        Check(_main_index != lfq::INVALID_THREAD_INDEX && _main_index == ThreadRegistry::GetThreadIndex(), "메인 스레드 번호가 일정하지 않음");
+
+        const size_t _registered_before = ThreadRegistry::GetRegisteredCount();
+        std::vector<size_t> _indices(ThreadCount);
+        std::atomic<size_t> _ready_count{0};
+        std::atomic<bool> _release{false};
+        std::vector<std::thread> _threads;
+
+        for (size_t i = 0; i < ThreadCount; ++i)
+        {
+            _threads.emplace_back([&, i]()
+            {
+                _indices[i] = ThreadRegistry::GetThreadIndex();
+                _ready_count.fetch_add(1, std::memory_order_release);
+
+                while (false == _release.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+            });
+        }
+
+        while (_ready_count.load(std::memory_order_acquire) != ThreadCount)
+        {
+            std::this_thread::yield();
+        }
+
+        Check(ThreadRegistry::GetRegisteredCount() == _registered_before + ThreadCount, "살아 있는 스레드 수만큼 번호가 등록되지 않음");
+
+        _release.store(true, std::memory_order_release);
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        _indices.push_back(_main_index);
+        std::sort(_indices.begin(), _indices.end());
+        Check(std::adjacent_find(_indices.begin(), _indices.end()) == _indices.end(), "살아 있는 스레드의 번호가 겹침");
+        Check(ThreadRegistry::GetRegisteredCount() == _registered_before, "끝난 스레드의 번호가 반납되지 않음");
+    }
+
+    // 여러 생산자/소비자에서 모든 값이 한 번씩 전달되고 생산자별 순서가 지켜지는지 확인한다.
+    void TestConcurrentPushPop()
+    {
+        constexpr size_t ThreadPairCount = 4;
+        constexpr std::uint64_t ItemsPerProducer = 50'000;
+        constexpr std::uint64_t TotalCount = ThreadPairCount * ItemsPerProducer;
+
+        auto _queue = std::make_unique<FlatCombiningQueue<std::uint64_t, 256>>();
+        std::atomic<std::uint64_t> _popped_count{0};
+        std::atomic<std::uint64_t> _checksum{0};
+        std::atomic<bool> _reordered{false};
+        std::vector<std::thread> _threads;
+
+        for (size_t _thread_index = 0; _thread_index < ThreadPairCount; ++_thread_index)
+        {
+            _threads.emplace_back([&_queue, _thread_index]()
+            {
+                for (std::uint64_t i = 0; i < ItemsPerProducer; ++i)
+                {
+                    // 상위 비트에 생산자 번호를 담아 소비자가 생산자별 순서를 확인한다
+                    const std::uint64_t _value = (static_cast<std::uint64_t>(_thread_index) << 32) | i;
+                    while (false == _queue->Push(_value))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+            _threads.emplace_back([&]()
+            {
+                std::vector<std::int64_t> _last_sequences(ThreadPairCount, -1);
+                std::uint64_t _local_checksum = 0;
+                std::uint64_t _value = 0;
+
+                while (_popped_count.load(std::memory_order_relaxed) < TotalCount)
+                {
+                    if (false == _queue->Pop(_value))
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    const size_t _producer_index = static_cast<size_t>(_value >> 32);
+                    const std::int64_t _sequence = static_cast<std::int64_t>(_value & 0xffffffffu);
+                    if (_sequence <= _last_sequences[_producer_index])
+                    {
+                        _reordered.store(true, std::memory_order_relaxed);
+                    }
+
+                    _last_sequences[_producer_index] = _sequence;
+                    _local_checksum += static_cast<std::uint64_t>(_sequence);
+                    _popped_count.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                _checksum.fetch_add(_local_checksum, std::memory_order_relaxed);
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const lfq::CombinerStats _stats = _queue->GetCombinerStats();
+
+        Check(_popped_count.load() == TotalCount, "꺼낸 항목 수가 틀림");
+        Check(_checksum.load() == ThreadPairCount * (ItemsPerProducer * (ItemsPerProducer - 1) / 2), "체크섬이 틀림");
+        Check(false == _reordered.load(), "생산자별 순서가 바뀜");
+        Check(true == _queue->IsEmpty(), "처리 후 큐가 비지 않음");
+
+        std::cout << "       결합 패스=" << _stats._pass_count << " | 패스당 요청="
+                  << static_cast<double>(_stats._request_count) / static_cast<double>(_stats._pass_count) << '\n';
+    }
+
+    // 등록부 번호보다 많은 스레드가 동시에 살아 있어도, 번호 없는 스레드가 직접 경로로 처리되는지 확인한다.
+    void TestRegistryOverflow()
+    {
+        const size_t _thread_count = lfq::MAX_REGISTERED_THREAD_COUNT + 4;
+
+        auto _queue = std::make_unique<FlatCombiningQueue<std::uint64_t, 512>>();
+        std::atomic<size_t> _ready_count{0};
+        std::atomic<size_t> _invalid_count{0};
+        std::atomic<bool> _start{false};
+        std::vector<std::thread> _threads;
+
+        for (size_t i = 0; i < _thread_count; ++i)
+        {
+            _threads.emplace_back([&, i]()
+            {
+                if (ThreadRegistry::GetThreadIndex() == lfq::INVALID_THREAD_INDEX)
+                {
+                    _invalid_count.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                _ready_count.fetch_add(1, std::memory_order_release);
+                while (false == _start.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+
+                _queue->Push(static_cast<std::uint64_t>(i));
+            });
+        }
+
+        while (_ready_count.load(std::memory_order_acquire) != _thread_count)
+        {
+            std::this_thread::yield();
+        }
+
+        _start.store(true, std::memory_order_release);
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        std::vector<std::uint64_t> _values;
+        std::uint64_t _value = 0;
+        while (true == _queue->Pop(_value))
+        {
+            _values.push_back(_value);
+        }
+
+        std::sort(_values.begin(), _values.end());
+        bool _complete = _values.size() == _thread_count;
+        for (size_t i = 0; true == _complete && i < _thread_count; ++i)
+        {
+            _complete = _values[i] == i;
+        }
+
+        Check(_invalid_count.load() > 0, "번호를 받지 못한 스레드가 없음");
+        Check(true == _complete, "번호 없는 스레드의 항목이 빠지거나 중복됨");
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 4;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "FlatCombiningQueue 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("순차 동작", "큐 크기=8 | unique_ptr | 실패한 Push", TestSequentialBehavior);
+    _passed_test_count += RunTest("스레드 등록부", "스레드=8 | 번호 중복 | 반납", TestThreadRegistry);
+    _passed_test_count += RunTest("동시 Push/Pop", "4P / 4C | 항목=200000 | 생산자별 순서", TestConcurrentPushPop);
+    _passed_test_count += RunTest("등록부 초과", "스레드=등록부 크기+4 | 직접 경로", TestRegistryOverflow);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
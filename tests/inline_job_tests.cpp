@@ -0,0 +1,255 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "inline_job.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    // 생성/소멸 수를 세는 캡처
+    struct Tracked
+    {
+        static inline int s_live_count = 0;
+
+        int* _target;
+
+        explicit Tracked(int* _target_value) : _target(_target_value) { ++s_live_count; }
+        Tracked(Tracked&& _other) noexcept : _target(_other._target) { ++s_live_count; }
+        Tracked(const Tracked& _other) : _target(_other._target) { ++s_live_count; }
+        ~Tracked() { --s_live_count; }
+
+        void operator()() const { ++*_target; }
+    };
+
+    // 캐시 라인 슬롯에 맞는 캡처만 받아들이는지 컴파일 시간에 확인한다
+    struct LargeCapture
+    {
+        std::array<std::uint64_t, 7> _values;
+        void operator()() const {}
+    };
+
+    struct alignas(32) OverAlignedCapture
+    {
+        void operator()() const {}
+    };
+
+    struct ThrowingMoveCapture
+    {
+        ThrowingMoveCapture() = default;
+        ThrowingMoveCapture(ThrowingMoveCapture&&) {}
+        void operator()() const {}
+    };
+
+    static_assert(true == lfq::FitsInlineJob<Tracked, lfq::INLINE_JOB_CAPACITY>::value);
+    static_assert(false == lfq::FitsInlineJob<LargeCapture, lfq::INLINE_JOB_CAPACITY>::value);
+    static_assert(true == lfq::FitsInlineJob<LargeCapture, 64>::value);
+    static_assert(false == lfq::FitsInlineJob<OverAlignedCapture, lfq::INLINE_JOB_CAPACITY>::value);
+    static_assert(false == lfq::FitsInlineJob<ThrowingMoveCapture, lfq::INLINE_JOB_CAPACITY>::value);
+    static_assert(std::is_nothrow_move_assignable_v<InlineJob<>> && false == std::is_copy_assignable_v<InlineJob<>>);
+
+    // 호출, 이동 후 원본이 비는지, Reset과 이동 대입이 이전 캡처를 한 번씩만 소멸시키는지 확인한다.
+    void TestInvokeMoveAndDestroy()
+    {
+        int _counter = 0;
+
+        {
+            InlineJob<> _job{Tracked(&_counter)};
+            Check(true == static_cast<bool>(_job) && Tracked::s_live_count == 1, "캡처가 하나만 살아 있어야 함");
+
+            _job();
+            Check(_counter == 1, "작업이 실행되지 않음");
+
+            InlineJob<> _moved(std::move(_job));
+            Check(false == static_cast<bool>(_job) && true == static_cast<bool>(_moved), "이동 후 원본이 비지 않음");
+            Check(Tracked::s_live_count == 1, "이동 후 캡처 수가 틀림");
+
+            _job();
+            _moved();
+            Check(_counter == 2, "빈 작업 호출이 무언가를 실행함");
+
+            int _other_counter = 0;
+            InlineJob<> _other{Tracked(&_other_counter)};
+            _moved = std::move(_other);
+            Check(Tracked::s_live_count == 1, "이동 대입이 이전 캡처를 소멸시키지 않음");
+
+            _moved();
+            Check(_other_counter == 1 && _counter == 2, "이동 대입 후 다른 작업이 실행됨");
+
+            _moved.Reset();
+            Check(false == static_cast<bool>(_moved) && Tracked::s_live_count == 0, "Reset이 캡처를 소멸시키지 않음");
+
+            _moved = InlineJob<>(Tracked(&_counter));
+        }
+
+        Check(Tracked::s_live_count == 0, "소멸자가 캡처를 소멸시키지 않음");
+    }
+
+    // 소유권을 가진 캡처(unique_ptr, string)가 큐를 거쳐 실행되고, 큐에 남은 작업도 큐와 함께 소멸하는지 확인한다.
+    void TestOwningCapturesThroughQueue()
+    {
+        auto _queue = std::make_unique<MPMCQueue<InlineJob<>, 16>>();
+        std::string _result;
+
+        auto _value = std::make_unique<int>(42);
+        Check(true == SubmitJob(*_queue, [&_result, _value = std::move(_value)]() { _result += std::to_string(*_value); }), "unique_ptr 캡처 작업을 넣지 못함");
+        Check(true == SubmitJob(*_queue, [&_result, _text = std::string("-inline")]() { _result += _text; }), "string 캡처 작업을 넣지 못함");
+
+        int _counter = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            SubmitJob(*_queue, Tracked(&_counter));
+        }
+
+        Check(true == ExecuteJob(*_queue) && true == ExecuteJob(*_queue) && _result == "42-inline", "캡처한 값으로 실행되지 않음");
+        Check(ExecuteJobs(*_queue, 2) == 2 && _counter == 2, "ExecuteJobs가 요청한 수만큼 실행하지 않음");
+        Check(Tracked::s_live_count == 1, "실행한 작업의 캡처가 슬롯에 남음");
+
+        _queue.reset();
+        Check(Tracked::s_live_count == 0, "큐에 남은 작업이 소멸하지 않음");
+    }
+
+    // 여러 생산자가 서로 다른 크기의 캡처를 넣고 여러 소비자가 실행해도 모든 작업이 한 번씩 실행되는지 확인한다.
+    void TestConcurrentSubmitExecute()
+    {
+        constexpr size_t ThreadPairCount = 4;
+        constexpr std::uint64_t JobsPerProducer = 50'000;
+        constexpr std::uint64_t TotalCount = ThreadPairCount * JobsPerProducer;
+
+        auto _queue = std::make_unique<MPMCQueue<InlineJob<>, 1024>>();
+        std::atomic<std::uint64_t> _executed_count{0};
+        std::atomic<std::uint64_t> _sum{0};
+        std::vector<std::thread> _threads;
+
+        for (size_t _thread_index = 0; _thread_index < ThreadPairCount; ++_thread_index)
+        {
+            _threads.emplace_back([&_queue, &_sum, _thread_index]()
+            {
+                const std::uint64_t _first_value = _thread_index * JobsPerProducer;
+
+                for (std::uint64_t _value = _first_value; _value < _first_value + JobsPerProducer; ++_value)
+                {
+                    bool _submitted = false;
+
+                    while (false == _submitted)
+                    {
+                        if (_value % 2 == 0)
+                        {
+                            _submitted = SubmitJob(*_queue, [&_sum, _value]() { _sum.fetch_add(_value, std::memory_order_relaxed); });
+                        }
+                        else
+                        {
+                            // 저장 공간을 거의 다 쓰는 캡처
+                            const std::array<std::uint64_t, 4> _padding = {_value, 0, 0, 0};
+                            _submitted = SubmitJob(*_queue, [&_sum, _padding, _value]() { _sum.fetch_add(_value + _padding[1], std::memory_order_relaxed); });
+                        }
+
+                        if (false == _submitted)
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+            });
+
+            _threads.emplace_back([&_queue, &_executed_count]()
+            {
+                while (_executed_count.load(std::memory_order_relaxed) < TotalCount)
+                {
+                    const size_t _count = ExecuteJobs(*_queue, 64);
+                    if (_count == 0)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    _executed_count.fetch_add(_count, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        Check(_executed_count.load() == TotalCount, "실행한 작업 수가 틀림");
+        Check(_sum.load() == TotalCount * (TotalCount - 1) / 2, "작업 결과 합계가 틀림");
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 3;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "InlineJob 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("호출/이동/소멸", "캡처 수명 | 이동 후 빈 작업 | Reset", TestInvokeMoveAndDestroy);
+    _passed_test_count += RunTest("소유 캡처와 큐", "unique_ptr | string | 큐 소멸 시 남은 작업", TestOwningCapturesThroughQueue);
+    _passed_test_count += RunTest("동시 Submit/Execute", "4P / 4C | 작업=200000 | 캡처 16/48바이트", TestConcurrentSubmitExecute);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
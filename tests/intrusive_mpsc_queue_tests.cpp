@@ -0,0 +1,264 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "intrusive_mpsc_queue.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    struct Message : lfq::MPSCNode
+    {
+        std::uint32_t _producer = 0;
+        std::uint32_t _sequence = 0;
+    };
+
+    // 빈 큐에 넣을 때만 Push가 true를 반환하고, FIFO 순서와 Drain 개수 제한이 지켜지는지 확인한다.
+    void TestPushPopOrder()
+    {
+        IntrusiveMPSCQueue<Message> _queue;
+        std::vector<Message> _messages(8);
+
+        Check(nullptr == _queue.Pop() && true == _queue.IsEmpty(), "빈 큐에서 원소를 꺼냄");
+
+        for (std::uint32_t i = 0; i < _messages.size(); ++i)
+        {
+            _messages[i]._sequence = i;
+            const bool _was_empty = _queue.Push(&_messages[i]);
+            Check(_was_empty == (i == 0), "빈 큐 여부를 잘못 알림");
+        }
+
+        std::vector<std::uint32_t> _popped;
+        const size_t _count = _queue.Drain([&_popped](Message* _message) { _popped.push_back(_message->_sequence); }, 3);
+        Check(_count == 3 && _popped == std::vector<std::uint32_t>({0, 1, 2}), "Drain 개수 제한이나 순서가 틀림");
+
+        // 꺼낸 원소는 바로 다시 넣을 수 있어야 함
+        Check(false == _queue.Push(&_messages[0]), "비어 있지 않은 큐를 비었다고 알림");
+
+        while (Message* const _message = _queue.Pop())
+        {
+            _popped.push_back(_message->_sequence);
+        }
+
+        Check(_popped == std::vector<std::uint32_t>({0, 1, 2, 3, 4, 5, 6, 7, 0}), "넣은 순서대로 꺼내지 않음");
+        Check(true == _queue.IsEmpty() && nullptr == _queue.Pop(), "모두 꺼냈는데 비어 있지 않음");
+        Check(true == _queue.Push(&_messages[1]), "다시 빈 큐가 된 뒤의 Push가 빈 큐를 알리지 않음");
+        Check(&_messages[1] == _queue.Pop(), "마지막 원소를 꺼내지 못함");
+    }
+
+    // 여러 생산자가 동시에 넣을 때 모든 메시지가 정확히 한 번, 생산자별 순서대로 나오는지 확인한다.
+    // 소비자가 자주 큐를 비우도록 해 마지막 원소를 꺼내는 CAS 경로와 Push의 경쟁도 함께 검사한다.
+    void TestConcurrentProducers()
+    {
+        constexpr size_t ProducerCount = 4;
+        constexpr std::uint32_t MessagesPerProducer = 200'000;
+        constexpr size_t TotalCount = ProducerCount * MessagesPerProducer;
+
+        IntrusiveMPSCQueue<Message> _queue;
+        std::vector<Message> _messages(TotalCount);
+        std::atomic<size_t> _empty_transition_count{0};
+
+        std::vector<std::thread> _producers;
+        for (size_t _producer = 0; _producer < ProducerCount; ++_producer)
+        {
+            _producers.emplace_back([&, _producer]()
+            {
+                size_t _local_empty_transition_count = 0;
+
+                for (std::uint32_t _sequence = 0; _sequence < MessagesPerProducer; ++_sequence)
+                {
+                    Message& _message = _messages[_producer * MessagesPerProducer + _sequence];
+                    _message._producer = static_cast<std::uint32_t>(_producer);
+                    _message._sequence = _sequence;
+
+                    _local_empty_transition_count += true == _queue.Push(&_message) ? 1 : 0;
+
+                    // 소비자가 큐를 자주 비울 수 있게 가끔 양보
+                    if ((_sequence % 16) == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                _empty_transition_count.fetch_add(_local_empty_transition_count);
+            });
+        }
+
+        std::vector<std::int64_t> _last_sequence(ProducerCount, -1);
+        size_t _received_count = 0;
+        size_t _error_count = 0;
+        size_t _empty_pop_count = 0;
+
+        while (_received_count < TotalCount)
+        {
+            Message* const _message = _queue.Pop();
+            if (nullptr == _message)
+            {
+                ++_empty_pop_count;
+                std::this_thread::yield();
+                continue;
+            }
+
+            if (_message->_producer >= ProducerCount || static_cast<std::int64_t>(_message->_sequence) != _last_sequence[_message->_producer] + 1)
+            {
+                ++_error_count;
+            }
+            else
+            {
+                _last_sequence[_message->_producer] = _message->_sequence;
+            }
+
+            ++_received_count;
+        }
+
+        for (auto& _producer : _producers)
+        {
+            _producer.join();
+        }
+
+        Check(_error_count == 0, "메시지가 누락되었거나 순서가 바뀜");
+        Check(true == _queue.IsEmpty() && nullptr == _queue.Pop(), "모두 받았는데 비어 있지 않음");
+        Check(_empty_transition_count.load() >= 1, "빈 큐 전환이 한 번도 알려지지 않음");
+
+        std::cout << "       생산자=" << ProducerCount
+                  << " | 메시지=" << TotalCount
+                  << " | 빈 큐에 Push=" << _empty_transition_count.load()
+                  << " | 빈 Pop=" << _empty_pop_count
+                  << " | 오류=" << _error_count << '\n';
+    }
+
+    // 액터 스케줄링 방식: Push가 true를 반환할 때만 소유자를 깨우고, 소유자는 비울 때까지 꺼낸다.
+    // 빈 큐 전환 알림이 누락되면 메시지가 남은 채 멈추므로 시간 제한 안에 모두 받는지로 확인한다.
+    void TestWakeupOnEmptyTransition()
+    {
+        constexpr size_t ProducerCount = 3;
+        constexpr std::uint32_t MessagesPerProducer = 100'000;
+        constexpr size_t TotalCount = ProducerCount * MessagesPerProducer;
+
+        IntrusiveMPSCQueue<Message> _queue;
+        std::vector<Message> _messages(TotalCount);
+        std::atomic<size_t> _wakeup_count{0};
+
+        std::vector<std::thread> _producers;
+        for (size_t _producer = 0; _producer < ProducerCount; ++_producer)
+        {
+            _producers.emplace_back([&, _producer]()
+            {
+                for (std::uint32_t _sequence = 0; _sequence < MessagesPerProducer; ++_sequence)
+                {
+                    if (true == _queue.Push(&_messages[_producer * MessagesPerProducer + _sequence]))
+                    {
+                        _wakeup_count.fetch_add(1, std::memory_order_release);
+                    }
+
+                    if ((_sequence % 16) == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        size_t _received_count = 0;
+        size_t _handled_wakeup_count = 0;
+        const auto _give_up_time = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+        while (_received_count < TotalCount && std::chrono::steady_clock::now() < _give_up_time)
+        {
+            // 깨우기 신호가 있을 때만 큐를 비운다
+            if (_handled_wakeup_count == _wakeup_count.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            ++_handled_wakeup_count;
+            _received_count += _queue.Drain([](Message*) {});
+        }
+
+        for (auto& _producer : _producers)
+        {
+            _producer.join();
+        }
+
+        Check(_received_count == TotalCount, "빈 큐 전환 알림이 누락되어 메시지가 남음");
+
+        std::cout << "       생산자=" << ProducerCount
+                  << " | 메시지=" << TotalCount
+                  << " | 깨우기=" << _wakeup_count.load()
+                  << " | 받음=" << _received_count << '\n';
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 3;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "IntrusiveMPSCQueue 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("Push/Pop 순서", "빈 큐 알림 | FIFO | Drain 개수 제한 | 재사용", TestPushPopOrder);
+    _passed_test_count += RunTest("동시 생산자", "생산자=4 | 메시지=800000개 | 누락/순서 검사", TestConcurrentProducers);
+    _passed_test_count += RunTest("빈 큐 전환 깨우기", "생산자=3 | 깨울 때만 비우기 | 알림 누락 검사", TestWakeupOnEmptyTransition);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
@@ -0,0 +1,416 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "journal_queue.h"
+#include "mapped_file.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    struct JournalRecord
+    {
+        std::uint64_t _id;
+        std::uint32_t _producer;
+        std::uint32_t _value;
+    };
+
+    std::string GetTempPath(const char* _name)
+    {
+        return (std::filesystem::temp_directory_path() / _name).string();
+    }
+
+    void RemoveFiles(const std::vector<std::string>& _paths)
+    {
+        std::error_code _error;
+        for (const std::string& _path : _paths)
+        {
+            std::filesystem::remove(_path, _error);
+        }
+    }
+
+    // 프로세스가 죽은 순간을 흉내 낸다: 동기화 여부와 상관없이 페이지 캐시에 있는 내용을 그대로 복사한다
+    void CopyCrashImage(const std::string& _from, const std::string& _to)
+    {
+        std::error_code _error;
+        std::filesystem::copy_file(_from, _to, std::filesystem::copy_options::overwrite_existing, _error);
+        Check(!_error, "저널 파일을 복사하지 못함");
+    }
+
+    // 넣은 순서대로 꺼내고, 가득 참/빔을 알리며, 닫았다 다시 열어도 남은 항목이 순서대로 남는지 확인한다.
+    void TestReopenPreservesOrder()
+    {
+        using Journal = JournalQueue<JournalRecord, 64>;
+
+        const std::string _path = GetTempPath("lfq_journal_reopen_test.jrnl");
+        RemoveFiles({_path});
+
+        {
+            Journal _journal;
+            Check(true == _journal.Open(_path), "새 저널을 만들지 못함");
+            Check(true == _journal.IsEmpty() && _journal.GetRecoveryStats()._recovered_count == 0, "새 저널이 비어 있지 않음");
+
+            for (std::uint32_t i = 0; i < 64; ++i)
+            {
+                Check(true == _journal.Push(JournalRecord{i, 0, i * 10}), "빈 자리가 있는데 Push 실패");
+            }
+
+            Check(false == _journal.Push(JournalRecord{64, 0, 640}), "가득 찬 저널에 Push 성공");
+
+            JournalRecord _record{};
+            for (std::uint32_t i = 0; i < 20; ++i)
+            {
+                Check(true == _journal.Pop(_record) && _record._id == i, "Pop 순서가 틀림");
+            }
+
+            Check(_journal.GetSize() == 44, "크기가 틀림");
+        }
+
+        {
+            Journal _journal;
+            Check(true == _journal.Open(_path), "저널을 다시 열지 못함");
+
+            const lfq::JournalRecoveryStats _stats = _journal.GetRecoveryStats();
+            Check(_stats._recovered_count == 44 && _stats._checksum_failure_count == 0 && _stats._hole_count == 0, "복구 결과가 틀림");
+
+            JournalRecord _record{};
+            bool _ordered = true;
+            for (std::uint32_t i = 20; i < 64; ++i)
+            {
+                _ordered = _ordered && true == _journal.Pop(_record) && _record._id == i && _record._value == i * 10;
+            }
+
+            Check(true == _ordered, "다시 연 저널의 항목이나 순서가 틀림");
+            Check(false == _journal.Pop(_record), "빈 저널에서 Pop 성공");
+
+            // 복구한 위치에서 이어서 한 바퀴 넘게 돌아도 정상 동작해야 한다
+            bool _wrapped = true;
+            for (std::uint32_t i = 0; i < 200; ++i)
+            {
+                _wrapped = _wrapped && true == _journal.Push(JournalRecord{1000 + i, 0, i}) && true == _journal.Pop(_record) && _record._id == 1000 + i;
+            }
+
+            Check(true == _wrapped, "복구 뒤 링을 돌며 Push/Pop 실패");
+        }
+
+        RemoveFiles({_path});
+    }
+
+    // 동기화하지 않은 항목도 프로세스 장애 이미지에서 복구되고, 체크섬이 틀린 항목과 공개되지 않은 자리는 버려지는지 확인한다.
+    void TestCrashRecovery()
+    {
+        using Journal = JournalQueue<JournalRecord, 64>;
+
+        const std::string _path = GetTempPath("lfq_journal_crash_test.jrnl");
+        const std::string _image_path = GetTempPath("lfq_journal_crash_image.jrnl");
+        RemoveFiles({_path, _image_path});
+
+        lfq::JournalSyncPolicy _policy;
+        _policy._mode = lfq::JournalSyncMode::None;
+
+        Journal _journal;
+        Check(true == _journal.Open(_path, _policy), "저널을 만들지 못함");
+
+        for (std::uint32_t i = 0; i < 10; ++i)
+        {
+            _journal.Push(JournalRecord{i, 0, i});
+        }
+
+        JournalRecord _record{};
+        _journal.Pop(_record);
+        _journal.Pop(_record);
+        Check(true == _journal.Sync() && _journal.GetSyncCount() == 1, "Sync 실패");
+
+        // 동기화 뒤의 변경: Push 5개, Pop 1개
+        for (std::uint32_t i = 10; i < 15; ++i)
+        {
+            _journal.Push(JournalRecord{i, 0, i});
+        }
+
+        _journal.Pop(_record);
+        CopyCrashImage(_path, _image_path);
+
+        {
+            Journal _recovered;
+            Check(true == _recovered.Open(_image_path), "장애 이미지를 열지 못함");
+            Check(_recovered.GetRecoveryStats()._recovered_count == 12, "동기화하지 않은 항목이 복구되지 않음");
+
+            bool _ordered = true;
+            for (std::uint32_t i = 3; i < 15; ++i)
+            {
+                _ordered = _ordered && true == _recovered.Pop(_record) && _record._id == i;
+            }
+
+            Check(true == _ordered, "복구한 항목의 순서가 틀림");
+        }
+
+        // 위치 5의 항목을 훼손하고 위치 8은 예약만 되고 공개되지 않은 자리로 만든다
+        CopyCrashImage(_path, _image_path);
+        {
+            MappedFile _file;
+            Check(true == _file.Open(_image_path, lfq::MappedFileMode::ReadWrite), "장애 이미지를 매핑하지 못함");
+
+            _file.GetData()[Journal::GetSlotOffset(5) + 16] ^= 0xffu;
+
+            const std::uint64_t _unpublished_generation = 8;
+            std::memcpy(_file.GetData() + Journal::GetSlotOffset(8), &_unpublished_generation, sizeof(_unpublished_generation));
+        }
+
+        {
+            Journal _recovered;
+            Check(true == _recovered.Open(_image_path), "훼손된 이미지를 열지 못함");
+
+            const lfq::JournalRecoveryStats _stats = _recovered.GetRecoveryStats();
+            Check(_stats._recovered_count == 10 && _stats._checksum_failure_count == 1 && _stats._hole_count == 1, "훼손된 항목 수가 틀림");
+
+            std::vector<std::uint64_t> _ids;
+            while (true == _recovered.Pop(_record))
+            {
+                _ids.push_back(_record._id);
+            }
+
+            const std::vector<std::uint64_t> _expected_ids = {3, 4, 6, 7, 9, 10, 11, 12, 13, 14};
+            Check(_ids == _expected_ids, "훼손된 항목을 건너뛰고 순서대로 복구하지 못함");
+        }
+
+        // 한 번 복구해 다시 쓴 파일은 다음 열기에서 같은 결과여야 한다
+        {
+            Journal _recovered;
+            Check(true == _recovered.Open(_image_path) && _recovered.GetRecoveryStats()._recovered_count == 0, "복구 결과가 파일에 남지 않음");
+        }
+
+        _journal.Close();
+        RemoveFiles({_path, _image_path});
+    }
+
+    // 그룹 커밋으로 여러 생산자와 소비자가 동시에 쓴 뒤 다시 열면, 꺼낸 항목과 남은 항목이 넣은 항목과 정확히 한 번씩 일치하는지 확인한다.
+    void TestConcurrentGroupCommit()
+    {
+        constexpr size_t ProducerCount = 2;
+        constexpr size_t ConsumerCount = 2;
+        constexpr std::uint32_t ItemsPerProducer = 5'000;
+        constexpr size_t PopLimit = 6'000;
+
+        using Journal = JournalQueue<JournalRecord, 16384>;
+
+        const std::string _path = GetTempPath("lfq_journal_concurrent_test.jrnl");
+        RemoveFiles({_path});
+
+        lfq::JournalSyncPolicy _policy;
+        _policy._mode = lfq::JournalSyncMode::GroupCommit;
+        _policy._batch_count = 64;
+
+        std::vector<std::uint64_t> _seen_counts(ProducerCount * ItemsPerProducer, 0);
+        std::uint64_t _sync_count = 0;
+
+        {
+            Journal _journal;
+            Check(true == _journal.Open(_path, _policy), "저널을 만들지 못함");
+
+            std::atomic<size_t> _popped_count{0};
+            std::vector<std::vector<std::uint64_t>> _popped_ids(ConsumerCount);
+            std::vector<std::thread> _threads;
+
+            for (std::uint32_t _producer = 0; _producer < ProducerCount; ++_producer)
+            {
+                _threads.emplace_back([&_journal, _producer]()
+                {
+                    for (std::uint32_t i = 0; i < ItemsPerProducer; ++i)
+                    {
+                        const JournalRecord _record{static_cast<std::uint64_t>(_producer) * ItemsPerProducer + i, _producer, i};
+                        while (false == _journal.Push(_record))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+
+            for (size_t _consumer = 0; _consumer < ConsumerCount; ++_consumer)
+            {
+                _threads.emplace_back([&_journal, &_popped_count, &_popped_ids, _consumer]()
+                {
+                    JournalRecord _record{};
+                    while (_popped_count.fetch_add(1, std::memory_order_relaxed) < PopLimit)
+                    {
+                        while (false == _journal.Pop(_record))
+                        {
+                            std::this_thread::yield();
+                        }
+
+                        _popped_ids[_consumer].push_back(_record._id);
+                    }
+                });
+            }
+
+            for (auto& _thread : _threads)
+            {
+                _thread.join();
+            }
+
+            for (const auto& _ids : _popped_ids)
+            {
+                for (const std::uint64_t _id : _ids)
+                {
+                    ++_seen_counts[_id];
+                }
+            }
+
+            _sync_count = _journal.GetSyncCount();
+        }
+
+        Check(_sync_count > 0 && _sync_count < ProducerCount * ItemsPerProducer, "그룹 커밋이 동기화를 묶지 않음");
+
+        {
+            Journal _journal;
+            Check(true == _journal.Open(_path, _policy), "저널을 다시 열지 못함");
+            Check(_journal.GetRecoveryStats()._recovered_count == ProducerCount * ItemsPerProducer - PopLimit, "남은 항목 수가 틀림");
+
+            // 생산자별 순서도 유지되어야 한다
+            std::vector<std::int64_t> _last_values(ProducerCount, -1);
+            bool _producer_ordered = true;
+
+            JournalRecord _record{};
+            while (true == _journal.Pop(_record))
+            {
+                ++_seen_counts[_record._id];
+                _producer_ordered = _producer_ordered && static_cast<std::int64_t>(_record._value) > _last_values[_record._producer];
+                _last_values[_record._producer] = _record._value;
+            }
+
+            Check(true == _producer_ordered, "생산자별 순서가 유지되지 않음");
+        }
+
+        Check(std::all_of(_seen_counts.begin(), _seen_counts.end(), [](std::uint64_t _count) { return _count == 1; }),
+              "항목이 빠지거나 두 번 나옴");
+
+        RemoveFiles({_path});
+    }
+
+    // 형식이 다른 파일은 열지 않고 내용을 그대로 두며, EveryPush 정책도 항목을 보존하는지 확인한다.
+    void TestFormatMismatchAndEveryPush()
+    {
+        const std::string _path = GetTempPath("lfq_journal_format_test.jrnl");
+        const std::string _foreign_path = GetTempPath("lfq_journal_foreign_test.bin");
+        RemoveFiles({_path, _foreign_path});
+
+        lfq::JournalSyncPolicy _policy;
+        _policy._mode = lfq::JournalSyncMode::EveryPush;
+
+        {
+            JournalQueue<JournalRecord, 64> _journal;
+            Check(true == _journal.Open(_path, _policy), "저널을 만들지 못함");
+            Check(true == _journal.Push(JournalRecord{7, 0, 70}), "EveryPush Push 실패");
+            Check(false == _journal.HasSyncError(), "동기화 실패가 기록됨");
+        }
+
+        {
+            JournalQueue<JournalRecord, 128> _other_size;
+            Check(false == _other_size.Open(_path) && false == _other_size.IsOpen(), "크기가 다른 저널을 열었음");
+
+            JournalQueue<std::uint64_t, 64> _other_type;
+            Check(false == _other_type.Open(_path), "항목 타입이 다른 저널을 열었음");
+        }
+
+        {
+            JournalQueue<JournalRecord, 64> _journal;
+            JournalRecord _record{};
+            Check(true == _journal.Open(_path) && true == _journal.Pop(_record) && _record._id == 7 && _record._value == 70, "EveryPush 항목이 남지 않음");
+        }
+
+        {
+            MappedFile _file;
+            Check(true == _file.Open(_foreign_path, lfq::MappedFileMode::Create, 100), "다른 파일을 만들지 못함");
+            std::memcpy(_file.GetData(), "not a journal", 14);
+        }
+
+        {
+            JournalQueue<JournalRecord, 64> _journal;
+            Check(false == _journal.Open(_foreign_path), "형식이 다른 파일을 열었음");
+
+            MappedFile _file;
+            Check(true == _file.Open(_foreign_path, lfq::MappedFileMode::ReadOnly) && _file.GetSize() == 100 &&
+                  std::memcmp(_file.GetData(), "not a journal", 14) == 0, "형식이 다른 파일의 내용이 바뀜");
+        }
+
+        RemoveFiles({_path, _foreign_path});
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 4;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "JournalQueue 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("다시 열기", "크기=64 | 가득 참/빔 | 닫은 뒤 순서 유지 | 복구 뒤 링 순환", TestReopenPreservesOrder);
+    _passed_test_count += RunTest("장애 복구", "동기화 안 한 항목 | 체크섬 훼손 1 | 공개 안 된 자리 1", TestCrashRecovery);
+    _passed_test_count += RunTest("동시 그룹 커밋", "2P / 2C | 항목=10000 | Pop=6000 | 묶음=64", TestConcurrentGroupCommit);
+    _passed_test_count += RunTest("형식 불일치와 EveryPush", "다른 크기/타입/파일 | EveryPush 보존", TestFormatMismatchAndEveryPush);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
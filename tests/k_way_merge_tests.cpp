@@ -0,0 +1,279 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "k_way_merge.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    struct MergedEvent
+    {
+        size_t _stream_index;
+        std::int64_t _event;
+    };
+
+    // 상위 비트는 타임스탬프, 하위 16비트는 스트림 안의 순번인 이벤트
+    struct PackedTimestamp
+    {
+        std::int64_t operator()(std::int64_t _event) const noexcept { return _event >> 16; }
+    };
+
+    // 미리 채운 스트림들이 타임스탬프 순서로 나오고, 같은 타임스탬프는 스트림 번호 순서이며,
+    // _max_count가 지켜지는지 확인한다.
+    void TestOrderedMerge()
+    {
+        SPSC_Q _first(8);
+        SPSC_Q _second(8);
+        SPSC_Q _third(8);
+
+        for (const std::int64_t _timestamp : {1, 4, 7, 10})
+        {
+            _first.push(_timestamp);
+        }
+
+        for (const std::int64_t _timestamp : {2, 4, 8})
+        {
+            _second.push(_timestamp);
+        }
+
+        for (const std::int64_t _timestamp : {0, 4, 11, 12})
+        {
+            _third.push(_timestamp);
+        }
+
+        KWayMerge<> _merge({&_first, &_second, &_third});
+        Check(_merge.GetStreamCount() == 3 && false == _merge.IsFinished(), "초기 상태가 틀림");
+
+        _merge.CloseStream(0);
+        _merge.CloseStream(1);
+        _merge.CloseStream(2);
+
+        std::vector<MergedEvent> _merged;
+        auto _collect = [&_merged](size_t _stream_index, const std::int64_t& _event)
+        {
+            _merged.push_back(MergedEvent{_stream_index, _event});
+        };
+
+        Check(_merge.Drain(_collect, 5) == 5, "최대 개수만큼 내보내지 않음");
+        Check(_merge.Drain(_collect) == 6, "남은 이벤트를 모두 내보내지 않음");
+        Check(true == _merge.IsFinished() && _merge.Drain(_collect) == 0, "끝난 뒤 상태가 틀림");
+
+        const std::vector<std::int64_t> _expected_events = {0, 1, 2, 4, 4, 4, 7, 8, 10, 11, 12};
+        const std::vector<size_t> _expected_streams = {2, 0, 1, 0, 1, 2, 0, 1, 0, 2, 2};
+        bool _matches = _merged.size() == _expected_events.size();
+
+        for (size_t i = 0; true == _matches && i < _merged.size(); ++i)
+        {
+            _matches = _merged[i]._event == _expected_events[i] && _merged[i]._stream_index == _expected_streams[i];
+        }
+
+        Check(true == _matches, "병합 순서가 틀림");
+
+        bool _rejected = false;
+        try
+        {
+            KWayMerge<> _empty_merge({});
+        }
+        catch (const std::invalid_argument&)
+        {
+            _rejected = true;
+        }
+
+        Check(true == _rejected, "스트림 없는 병합이 만들어짐");
+    }
+
+    // 조용한 스트림이 워터마크를 알리기 전에는 병합이 멈추고, 워터마크만큼 진행한 뒤 닫히면 끝까지 나오는지 확인한다.
+    void TestWatermarkStall()
+    {
+        SPSC_Q _busy(16);
+        SPSC_Q _quiet(16);
+        KWayMerge<> _merge({&_busy, &_quiet});
+
+        for (std::int64_t _timestamp = 10; _timestamp <= 50; _timestamp += 10)
+        {
+            _busy.push(_timestamp);
+        }
+
+        std::vector<std::int64_t> _merged;
+        auto _collect = [&_merged](size_t, const std::int64_t& _event) { _merged.push_back(_event); };
+
+        Check(_merge.Drain(_collect) == 0 && _merge.GetBlockingStream() == 1, "워터마크 없는 스트림이 병합을 막지 않음");
+
+        _merge.PublishWatermark(1, 25);
+        Check(_merge.Drain(_collect) == 2 && _merge.GetBlockingStream() == 1, "워터마크까지만 진행하지 않음");
+
+        // 조용한 스트림이 이벤트를 보내면 마지막 타임스탬프가 새 하한이 된다
+        _quiet.push(35);
+        Check(_merge.Drain(_collect) == 2 && _merge.GetBlockingStream() == 1, "마지막 이벤트 시각까지 진행하지 않음");
+
+        _merge.CloseStream(1);
+        Check(_merge.Drain(_collect) == 2 && _merge.GetBlockingStream() == 0, "닫힌 스트림 뒤로 진행하지 않음");
+
+        _merge.CloseStream(0);
+        Check(_merge.Drain(_collect) == 0 && true == _merge.IsFinished(), "모든 스트림이 닫혔는데 끝나지 않음");
+        Check(_merged == std::vector<std::int64_t>({10, 20, 30, 35, 40, 50}), "병합 결과가 틀림");
+    }
+
+    // provider 스레드마다 스트림 하나에 임의 간격의 타임스탬프를 보내고(하나는 하트비트만 보냄),
+    // consumer가 전체 순서를 지키며 모든 이벤트를 한 번씩 내보내는지 확인한다.
+    void TestConcurrentStreams()
+    {
+        constexpr size_t StreamCount = 8;
+        constexpr std::int64_t EventsPerStream = 20'000;
+        constexpr size_t QuietStreamIndex = StreamCount - 1;
+
+        std::vector<std::unique_ptr<SPSC_Q>> _queues;
+        std::vector<SPSC_Q*> _streams;
+        for (size_t i = 0; i < StreamCount; ++i)
+        {
+            _queues.push_back(std::make_unique<SPSC_Q>(49));
+            _streams.push_back(_queues.back().get());
+        }
+
+        KWayMerge<PackedTimestamp> _merge(_streams);
+        std::vector<std::thread> _providers;
+
+        for (size_t _stream_index = 0; _stream_index < StreamCount; ++_stream_index)
+        {
+            _providers.emplace_back([&_merge, &_queues, _stream_index]()
+            {
+                std::mt19937_64 _random(_stream_index + 1);
+                SPSC_Q& _queue = *_queues[_stream_index];
+                std::int64_t _timestamp = 0;
+
+                for (std::int64_t i = 0; i < EventsPerStream; ++i)
+                {
+                    _timestamp += static_cast<std::int64_t>(_random() % 8);
+
+                    if (_stream_index == QuietStreamIndex)
+                    {
+                        // 이벤트 없이 하트비트로 시각만 알린다
+                        _merge.PublishWatermark(_stream_index, _timestamp);
+                        continue;
+                    }
+
+                    const std::int64_t _event = (_timestamp << 16) | (i & 0xFFFF);
+                    while (false == _queue.push(_event))
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    if (i % 64 == 0)
+                    {
+                        _merge.PublishWatermark(_stream_index, _timestamp);
+                    }
+                }
+
+                _merge.CloseStream(_stream_index);
+            });
+        }
+
+        std::int64_t _last_timestamp = lfq::MERGE_NO_WATERMARK;
+        std::vector<std::int64_t> _next_sequences(StreamCount, 0);
+        std::int64_t _merged_count = 0;
+        bool _ordered = true;
+
+        auto _check_event = [&](size_t _stream_index, const std::int64_t& _event)
+        {
+            const std::int64_t _timestamp = _event >> 16;
+            _ordered = _ordered && _timestamp >= _last_timestamp && (_event & 0xFFFF) == (_next_sequences[_stream_index] & 0xFFFF);
+            _last_timestamp = _timestamp;
+            ++_next_sequences[_stream_index];
+            ++_merged_count;
+        };
+
+        while (false == _merge.IsFinished())
+        {
+            if (_merge.Drain(_check_event, 256) == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        for (auto& _provider : _providers)
+        {
+            _provider.join();
+        }
+
+        Check(true == _ordered, "타임스탬프 순서나 스트림별 순번이 틀림");
+        Check(_merged_count == static_cast<std::int64_t>(StreamCount - 1) * EventsPerStream, "이벤트 수가 틀림");
+        Check(_next_sequences[QuietStreamIndex] == 0, "하트비트만 보낸 스트림에서 이벤트가 나옴");
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 3;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "KWayMerge 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("순서 병합", "스트림=3 | 같은 타임스탬프는 스트림 번호 순 | 최대 개수", TestOrderedMerge);
+    _passed_test_count += RunTest("워터마크", "조용한 스트림이 막음 | 워터마크/마지막 이벤트만큼 진행 | 닫기", TestWatermarkStall);
+    _passed_test_count += RunTest("동시 스트림", "provider 8 (하트비트만 1) | 스트림당 20000 | 전체 순서", TestConcurrentStreams);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
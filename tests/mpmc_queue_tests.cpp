@@ -1,10 +1,13 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <thread>
 #include <vector>
+#ifdef _WIN32
 #include <windows.h>
+#endif
 
 #include "mpmc_queue.h"
 
@@ -132,12 +135,48 @@ namespace
         Check(_queue.GetSize() == 0, "단일 생산자/소비자 테스트 후 큐의 크기가 0이 아님");
     }
 
+    // generation과 값을 한 word에 담는 슬롯과 일반 슬롯이 같은 결과를 내는지 확인한다.
+    // 용량 4에서 여러 바퀴를 순환하며 가득 참/비어 있음 경계와 FIFO 순서를 비교한다.
+    void TestPackedSlotMatchesGenericSlot()
+    {
+        MPMCQueue<std::uint32_t, 4> _packed_queue;
+        MPMCQueue<std::uint32_t, 4, false> _generic_queue;
+
+        for (std::uint32_t _base = 0; _base < 40'000; _base += 3)
+        {
+            for (std::uint32_t _offset = 0; _offset < 3; ++_offset)
+            {
+                Check(true == _packed_queue.Push(_base + _offset), "packed 슬롯 Push 실패");
+                Check(true == _generic_queue.Push(_base + _offset), "일반 슬롯 Push 실패");
+            }
+
+            Check(true == _packed_queue.Push(0xFFFFFFFFu), "packed 슬롯에 최대값 Push 실패");
+            Check(true == _generic_queue.Push(0xFFFFFFFFu), "일반 슬롯에 최대값 Push 실패");
+            Check(false == _packed_queue.Push(1), "가득 찬 packed 큐에서 Push가 성공함");
+            Check(_packed_queue.GetSize() == _generic_queue.GetSize(), "두 큐의 크기가 다름");
+
+            for (std::uint32_t _offset = 0; _offset < 4; ++_offset)
+            {
+                std::uint32_t _packed_value = 0;
+                std::uint32_t _generic_value = 1;
+
+                Check(true == _packed_queue.Pop(_packed_value), "packed 슬롯 Pop 실패");
+                Check(true == _generic_queue.Pop(_generic_value), "일반 슬롯 Pop 실패");
+                Check(_packed_value == _generic_value, "두 큐의 FIFO 값이 다름");
+            }
+
+            std::uint32_t _value = 0;
+            Check(false == _packed_queue.Pop(_value), "빈 packed 큐에서 Pop이 성공함");
+        }
+    }
+
     // 지정한 수의 생산자와 소비자를 동시에 실행해 각 값의 소비 횟수를 기록한다.
     // 전체 실행 후 입력/출력 수, 누락, 중복, 범위 밖 값과 큐의 최종 상태를 검증한다.
+    template <typename ValueType>
     void RunMpmcExactlyOnceCase(size_t _producer_count, size_t _consumer_count, size_t _items_per_producer)
     {
         const size_t _total_item_count = _producer_count * _items_per_producer;
-        MPMCQueue<size_t, 64> _queue;
+        MPMCQueue<ValueType, 64> _queue;
 
         std::vector<std::atomic<unsigned int>> _seen(_total_item_count);
 
@@ -155,14 +194,14 @@ namespace
         _producers.reserve(_producer_count);
         _consumers.reserve(_consumer_count);
 
-        for (auto _producer_index = 0; _producer_index < _producer_count; ++_producer_index)
+        for (size_t _producer_index = 0; _producer_index < _producer_count; ++_producer_index)
         {
             _producers.emplace_back([&, _producer_index]()
             {
                 const size_t _first_value = _producer_index * _items_per_producer;
                 for (size_t _offset = 0; _offset < _items_per_producer; ++_offset)
                 {
-                    const size_t _value = _first_value + _offset;
+                    const ValueType _value = static_cast<ValueType>(_first_value + _offset);
                     while (false == _queue.Push(_value))
                     {
                     }
@@ -171,13 +210,13 @@ namespace
             });
         }
 
-        for (auto _consumer_index = 0; _consumer_index < _consumer_count; ++_consumer_index)
+        for (size_t _consumer_index = 0; _consumer_index < _consumer_count; ++_consumer_index)
         {
             _consumers.emplace_back([&]()
             {
                 while (_pop_count.load(std::memory_order_acquire) < _total_item_count)
                 {
-                    size_t _value = 0;
+                    ValueType _value = 0;
                     if (false == _queue.Pop(_value))
                     {
                         continue;
@@ -249,10 +288,19 @@ namespace
     {
         constexpr size_t ItemsPerProducer = 25'000;
 
-        RunMpmcExactlyOnceCase(4, 1, ItemsPerProducer);
-        RunMpmcExactlyOnceCase(1, 4, ItemsPerProducer);
-        RunMpmcExactlyOnceCase(4, 4, ItemsPerProducer);
-        RunMpmcExactlyOnceCase(8, 8, ItemsPerProducer);
+        RunMpmcExactlyOnceCase<size_t>(4, 1, ItemsPerProducer);
+        RunMpmcExactlyOnceCase<size_t>(1, 4, ItemsPerProducer);
+        RunMpmcExactlyOnceCase<size_t>(4, 4, ItemsPerProducer);
+        RunMpmcExactlyOnceCase<size_t>(8, 8, ItemsPerProducer);
+    }
+
+    // packed 슬롯 경로에서도 모든 값이 정확히 한 번 전달되는지 검증한다.
+    void TestPackedSlotExactlyOnceDelivery()
+    {
+        constexpr size_t ItemsPerProducer = 25'000;
+
+        RunMpmcExactlyOnceCase<std::uint32_t>(4, 4, ItemsPerProducer);
+        RunMpmcExactlyOnceCase<std::uint32_t>(8, 8, ItemsPerProducer);
     }
 
     using TestFunction = void (*)();
@@ -282,10 +330,12 @@ namespace
 
 int main()
 {
-    constexpr int TestCount = 4;
+    constexpr int TestCount = 6;
     int _passed_test_count = 0;
 
+#ifdef _WIN32
     SetConsoleOutputCP(CP_UTF8);
+#endif
 
     std::cout << "MPMCQueue 정확성 테스트\n";
     std::cout << "============================================================\n";
@@ -294,6 +344,8 @@ int main()
     _passed_test_count += RunTest("슬롯 반복 재사용", "용량=2 | 재사용=100000회 | 처리 값=200000개", TestRepeatedSlotReuse);
     _passed_test_count += RunTest("단일 생산자/단일 소비자 순서", "생산자=1 | 소비자=1 | 처리 값=100000개 | FIFO 순서", TestSingleProducerSingleConsumerOrder);
     _passed_test_count += RunTest("다중 생산자/다중 소비자 정확히 한 번 전달", "생산자/소비자=4/1, 1/4, 4/4 | 누락/중복/비정상 값 검사", TestMpmcExactlyOnceDelivery);
+    _passed_test_count += RunTest("packed 슬롯과 일반 슬롯 비교", "용량=4 | uint32_t | 반복=13334회 | 경계값 및 FIFO", TestPackedSlotMatchesGenericSlot);
+    _passed_test_count += RunTest("packed 슬롯 정확히 한 번 전달", "uint32_t | 생산자/소비자=4/4, 8/8 | 누락/중복 검사", TestPackedSlotExactlyOnceDelivery);
 
     std::cout << "\n============================================================\n";
 
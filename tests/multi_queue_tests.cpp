@@ -0,0 +1,302 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "multi_queue.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    // 우선순위 값별 개수로 "남은 항목 중 더 작은 항목 수"를 세는 Fenwick 트리
+    class RankCounter
+    {
+    public:
+        explicit RankCounter(size_t _value_count) : m_tree(_value_count + 1, 0) {}
+
+        void Add(size_t _value, int _delta)
+        {
+            for (size_t i = _value + 1; i < m_tree.size(); i += i & (~i + 1))
+            {
+                m_tree[i] += _delta;
+            }
+        }
+
+        // _value보다 작은 값의 개수
+        long long CountLess(size_t _value) const
+        {
+            long long _count = 0;
+            for (size_t i = _value; i > 0; i -= i & (~i + 1))
+            {
+                _count += m_tree[i];
+            }
+
+            return _count;
+        }
+
+    private:
+        std::vector<long long> m_tree;
+    };
+
+    // 모든 항목이 한 번씩 나오고, 비면 Pop이 실패하며, PopBatch가 오름차순으로 채우는지 확인한다.
+    void TestBasicOperations()
+    {
+        constexpr std::uint32_t ItemCount = 1'000;
+
+        MultiQueue<std::uint32_t> _queue(4);
+        Check(_queue.GetQueueCount() == 4 && true == _queue.IsEmpty(), "초기 상태가 틀림");
+
+        std::mt19937_64 _random(1);
+        for (std::uint32_t i = 0; i < ItemCount; ++i)
+        {
+            _queue.Push(_random() % 10'000, i);
+        }
+
+        Check(_queue.GetApproximateSize() == ItemCount, "크기가 틀림");
+
+        MultiQueue<std::uint32_t>::Entry _entries[32];
+        const size_t _batch_count = _queue.PopBatch(_entries, 32);
+        bool _ascending = _batch_count > 0;
+        for (size_t i = 1; i < _batch_count; ++i)
+        {
+            _ascending = _ascending && _entries[i - 1]._priority <= _entries[i]._priority;
+        }
+
+        Check(true == _ascending, "PopBatch가 오름차순이 아님");
+
+        std::vector<int> _seen_counts(ItemCount, 0);
+        for (size_t i = 0; i < _batch_count; ++i)
+        {
+            ++_seen_counts[_entries[i]._item];
+        }
+
+        std::uint64_t _priority = 0;
+        std::uint32_t _item = 0;
+        while (true == _queue.Pop(_priority, _item))
+        {
+            ++_seen_counts[_item];
+        }
+
+        Check(std::all_of(_seen_counts.begin(), _seen_counts.end(), [](int _count) { return _count == 1; }), "항목이 빠지거나 두 번 나옴");
+        Check(true == _queue.IsEmpty() && false == _queue.Pop(_priority, _item) && _queue.PopBatch(_entries, 32) == 0, "빈 큐에서 꺼냄");
+
+        MultiQueue<std::uint32_t> _clamped(1);
+        Check(_clamped.GetQueueCount() == 2, "힙 개수가 2로 올려지지 않음");
+    }
+
+    // 한 스레드에서 꺼낸 항목의 평균 순위 오차가 힙 개수 수준으로 작은지 확인한다.
+    void TestRankError()
+    {
+        constexpr size_t QueueCount = 8;
+        constexpr size_t ItemCount = 20'000;
+        constexpr size_t PriorityRange = 65'536;
+
+        MultiQueue<std::uint32_t> _queue(QueueCount);
+        RankCounter _counter(PriorityRange);
+
+        std::mt19937_64 _random(2);
+        for (size_t i = 0; i < ItemCount; ++i)
+        {
+            const std::uint64_t _priority = _random() % PriorityRange;
+            _queue.Push(_priority, static_cast<std::uint32_t>(i));
+            _counter.Add(static_cast<size_t>(_priority), 1);
+        }
+
+        long long _total_rank_error = 0;
+        long long _max_rank_error = 0;
+        std::uint64_t _priority = 0;
+        std::uint32_t _item = 0;
+
+        while (true == _queue.Pop(_priority, _item))
+        {
+            const long long _rank_error = _counter.CountLess(static_cast<size_t>(_priority));
+            _total_rank_error += _rank_error;
+            _max_rank_error = std::max(_max_rank_error, _rank_error);
+            _counter.Add(static_cast<size_t>(_priority), -1);
+        }
+
+        const double _mean_rank_error = static_cast<double>(_total_rank_error) / static_cast<double>(ItemCount);
+        std::cout << "  평균 순위 오차=" << _mean_rank_error << " | 최대=" << _max_rank_error << '\n';
+
+        Check(_mean_rank_error < static_cast<double>(QueueCount * 4), "평균 순위 오차가 너무 큼");
+    }
+
+    // 핸들의 삽입 버퍼가 자기 Pop에 보이고, Flush와 소멸이 두 버퍼의 항목을 큐에 돌려놓는지 확인한다.
+    void TestHandleBuffers()
+    {
+        MultiQueue<std::uint32_t> _queue(4);
+        std::uint64_t _priority = 0;
+        std::uint32_t _item = 0;
+
+        {
+            MultiQueueHandle<std::uint32_t> _handle(_queue, 8, 8);
+            _handle.Push(30, 3);
+            _handle.Push(10, 1);
+            _handle.Push(20, 2);
+
+            Check(true == _queue.IsEmpty() && _handle.GetBufferedCount() == 3, "삽입 버퍼가 큐로 바로 넘어감");
+            Check(true == _handle.Pop(_priority, _item) && _priority == 10 && _item == 1, "삽입 버퍼의 최솟값을 꺼내지 못함");
+
+            _handle.Flush();
+            Check(_queue.GetApproximateSize() == 2 && _handle.GetBufferedCount() == 0, "Flush가 항목을 큐에 넣지 않음");
+        }
+
+        {
+            MultiQueueHandle<std::uint32_t> _handle(_queue, 4, 8);
+            for (std::uint32_t i = 0; i < 100; ++i)
+            {
+                _handle.Push(100 + i, 100 + i);
+            }
+
+            _handle.Flush();
+            Check(true == _handle.Pop(_priority, _item), "삭제 버퍼를 채우지 못함");
+            Check(_handle.GetBufferedCount() > 0 && _queue.GetApproximateSize() + _handle.GetBufferedCount() == 101, "삭제 버퍼 항목 수가 틀림");
+        }
+
+        Check(_queue.GetApproximateSize() == 101, "소멸한 핸들이 삭제 버퍼를 돌려놓지 않음");
+    }
+
+    // 여러 스레드가 직접 호출과 핸들을 섞어 넣고 꺼내도 모든 항목이 정확히 한 번씩 나오는지 확인한다.
+    void TestConcurrentPushPop()
+    {
+        constexpr size_t ThreadCount = 4;
+        constexpr std::uint32_t ItemsPerThread = 20'000;
+
+        MultiQueue<std::uint32_t> _queue(ThreadCount * 2);
+        std::vector<std::vector<std::uint32_t>> _popped(ThreadCount);
+        std::vector<std::thread> _threads;
+
+        for (size_t _thread_index = 0; _thread_index < ThreadCount; ++_thread_index)
+        {
+            _threads.emplace_back([&_queue, &_popped, _thread_index]()
+            {
+                std::mt19937_64 _random(_thread_index + 10);
+                std::vector<std::uint32_t>& _local_popped = _popped[_thread_index];
+                std::uint64_t _priority = 0;
+                std::uint32_t _item = 0;
+
+                if (_thread_index % 2 == 0)
+                {
+                    for (std::uint32_t i = 0; i < ItemsPerThread; ++i)
+                    {
+                        _queue.Push(_random() % 1'000'000, static_cast<std::uint32_t>(_thread_index) * ItemsPerThread + i);
+                        if (i % 2 == 1 && true == _queue.Pop(_priority, _item))
+                        {
+                            _local_popped.push_back(_item);
+                        }
+                    }
+                }
+                else
+                {
+                    MultiQueueHandle<std::uint32_t> _handle(_queue);
+                    for (std::uint32_t i = 0; i < ItemsPerThread; ++i)
+                    {
+                        _handle.Push(_random() % 1'000'000, static_cast<std::uint32_t>(_thread_index) * ItemsPerThread + i);
+                        if (i % 2 == 1 && true == _handle.Pop(_priority, _item))
+                        {
+                            _local_popped.push_back(_item);
+                        }
+                    }
+                }
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        std::vector<int> _seen_counts(ThreadCount * ItemsPerThread, 0);
+        for (const auto& _local_popped : _popped)
+        {
+            for (const std::uint32_t _item : _local_popped)
+            {
+                ++_seen_counts[_item];
+            }
+        }
+
+        std::uint64_t _priority = 0;
+        std::uint32_t _item = 0;
+        while (true == _queue.Pop(_priority, _item))
+        {
+            ++_seen_counts[_item];
+        }
+
+        Check(std::all_of(_seen_counts.begin(), _seen_counts.end(), [](int _count) { return _count == 1; }), "항목이 빠지거나 두 번 나옴");
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 4;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "MultiQueue 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("기본 동작", "힙=4 | 항목=1000 | PopBatch 오름차순 | 빈 큐", TestBasicOperations);
+    _passed_test_count += RunTest("순위 오차", "힙=8 | 항목=20000 | 평균 순위 오차 < 힙 수 x 4", TestRankError);
+    _passed_test_count += RunTest("핸들 버퍼", "삽입 버퍼 Pop | Flush | 소멸 시 삭제 버퍼 반환", TestHandleBuffers);
+    _passed_test_count += RunTest("동시 Push/Pop", "4스레드 | 항목=80000 | 직접 호출 2 + 핸들 2", TestConcurrentPushPop);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
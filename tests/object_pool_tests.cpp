@@ -0,0 +1,270 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mpmc_queue.h"
+#include "object_pool.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    // 공유 스택만 사용해 풀 전체를 획득하고 반납한 뒤 다시 모두 획득할 수 있는지 확인한다.
+    // 같은 핸들이 두 번 반환되거나 범위 밖 핸들이 반환되지 않는지 함께 검증한다.
+    void TestExhaustAndRefill()
+    {
+        using Pool = ObjectPool<int, 16, 4>;
+        auto _pool = std::make_unique<Pool>();
+        std::vector<Pool::Handle> _handles;
+        std::vector<int> _seen(16, 0);
+
+        for (size_t i = 0; i < 16; ++i)
+        {
+            const Pool::Handle _handle = _pool->Acquire();
+            Check(_handle != Pool::INVALID_HANDLE, "용량 이내의 Acquire가 실패함");
+            Check(_handle < 16, "범위를 벗어난 핸들이 반환됨");
+
+            if (_handle < 16)
+            {
+                ++_seen[_handle];
+                _handles.push_back(_handle);
+            }
+        }
+
+        for (const int _count : _seen)
+        {
+            Check(_count == 1, "같은 핸들이 중복으로 반환됨");
+        }
+
+        Check(_pool->Acquire() == Pool::INVALID_HANDLE, "비어 있는 풀에서 Acquire가 성공함");
+
+        for (const Pool::Handle _handle : _handles)
+        {
+            _pool->Get(_handle) = static_cast<int>(_handle) * 10;
+            _pool->Release(_handle);
+        }
+
+        size_t _reacquired_count = 0;
+        while (_pool->Acquire() != Pool::INVALID_HANDLE)
+        {
+            ++_reacquired_count;
+        }
+
+        Check(_reacquired_count == 16, "반납한 모든 핸들을 다시 획득하지 못함");
+        Check(_pool->GetHandle(&_pool->Get(7)) == 7, "객체 포인터에서 핸들 변환이 틀림");
+    }
+
+    // Cache를 통한 획득/반납에서 매거진 채우기와 비우기가 핸들을 잃지 않는지 확인한다.
+    // Cache 소멸 시 보유한 핸들이 모두 공유 스택으로 돌아오는지 검증한다.
+    void TestCacheRefillAndFlush()
+    {
+        using Pool = ObjectPool<int, 64, 8>;
+        auto _pool = std::make_unique<Pool>();
+
+        {
+            Pool::Cache _cache(*_pool);
+            std::vector<Pool::Handle> _handles;
+
+            for (size_t i = 0; i < 64; ++i)
+            {
+                const Pool::Handle _handle = _pool->Acquire(_cache);
+                Check(_handle != Pool::INVALID_HANDLE, "Cache를 통한 Acquire가 실패함");
+                _handles.push_back(_handle);
+            }
+
+            Check(_pool->Acquire(_cache) == Pool::INVALID_HANDLE, "비어 있는 풀에서 Cache Acquire가 성공함");
+
+            for (const Pool::Handle _handle : _handles)
+            {
+                _pool->Release(_cache, _handle);
+            }
+
+            // 매거진 용량(8)을 넘는 핸들은 공유 스택으로 반납되어 있어야 함
+            Check(_pool->Acquire() != Pool::INVALID_HANDLE, "매거진이 가득 찼을 때 공유 스택으로 반납되지 않음");
+        }
+
+        size_t _free_count = 0;
+        while (_pool->Acquire() != Pool::INVALID_HANDLE)
+        {
+            ++_free_count;
+        }
+
+        // 위에서 공유 스택으로 직접 꺼낸 1개는 반납하지 않았음
+        Check(_free_count == 63, "Cache 소멸 후 핸들이 모두 반납되지 않음");
+    }
+
+    // 여러 스레드가 각자의 Cache로 핸들을 획득해 MPMCQueue로 전달하고 다른 스레드가 반납한다.
+    // 한 핸들을 두 스레드가 동시에 소유하지 않는지, 종료 후 핸들이 모두 풀로 돌아오는지 검증한다.
+    void TestConcurrentHandoff()
+    {
+        constexpr size_t PoolCapacity = 256;
+        constexpr size_t ThreadPairCount = 4;
+        constexpr size_t ItemsPerProducer = 50'000;
+
+        using Pool = ObjectPool<size_t, PoolCapacity, 16>;
+        auto _pool = std::make_unique<Pool>();
+        auto _queue = std::make_unique<MPMCQueue<Pool::Handle, 64>>();
+
+        std::vector<std::atomic<int>> _owned(PoolCapacity);
+        for (auto& _flag : _owned)
+        {
+            _flag.store(0, std::memory_order_relaxed);
+        }
+
+        std::atomic<size_t> _double_owner_count{0};
+        std::atomic<size_t> _value_mismatch_count{0};
+        std::atomic<size_t> _consumed_count{0};
+        const size_t _total_item_count = ThreadPairCount * ItemsPerProducer;
+
+        std::vector<std::thread> _threads;
+
+        for (size_t _producer_index = 0; _producer_index < ThreadPairCount; ++_producer_index)
+        {
+            _threads.emplace_back([&, _producer_index]()
+            {
+                Pool::Cache _cache(*_pool);
+
+                for (size_t _offset = 0; _offset < ItemsPerProducer; ++_offset)
+                {
+                    Pool::Handle _handle = Pool::INVALID_HANDLE;
+                    while ((_handle = _pool->Acquire(_cache)) == Pool::INVALID_HANDLE)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    if (_owned[_handle].exchange(1, std::memory_order_relaxed) != 0)
+                    {
+                        _double_owner_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+
+                    _pool->Get(_handle) = _producer_index * ItemsPerProducer + _offset;
+
+                    while (false == _queue->Push(_handle))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (size_t _consumer_index = 0; _consumer_index < ThreadPairCount; ++_consumer_index)
+        {
+            _threads.emplace_back([&]()
+            {
+                Pool::Cache _cache(*_pool);
+
+                while (_consumed_count.load(std::memory_order_relaxed) < _total_item_count)
+                {
+                    Pool::Handle _handle = Pool::INVALID_HANDLE;
+                    if (false == _queue->Pop(_handle))
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    if (_pool->Get(_handle) >= _total_item_count)
+                    {
+                        _value_mismatch_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+
+                    _owned[_handle].store(0, std::memory_order_relaxed);
+                    _pool->Release(_cache, _handle);
+                    _consumed_count.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        size_t _free_count = 0;
+        while (_pool->Acquire() != Pool::INVALID_HANDLE)
+        {
+            ++_free_count;
+        }
+
+        Check(_consumed_count.load(std::memory_order_relaxed) == _total_item_count, "전달된 핸들 수가 예상과 다름");
+        Check(_double_owner_count.load(std::memory_order_relaxed) == 0, "같은 핸들을 두 스레드가 동시에 소유함");
+        Check(_value_mismatch_count.load(std::memory_order_relaxed) == 0, "핸들이 가리키는 값이 손상됨");
+        Check(_free_count == PoolCapacity, "종료 후 풀에 모든 핸들이 돌아오지 않음");
+
+        std::cout << "       생산자/소비자=" << ThreadPairCount << '/' << ThreadPairCount
+                  << " | 전달=" << _consumed_count.load(std::memory_order_relaxed)
+                  << " | 중복 소유=" << _double_owner_count.load(std::memory_order_relaxed)
+                  << " | 반납된 핸들=" << _free_count << '/' << PoolCapacity << '\n';
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 3;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "ObjectPool 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("공유 스택 고갈 및 재사용", "용량=16 | 전체 획득/반납 | 중복 핸들 검사", TestExhaustAndRefill);
+    _passed_test_count += RunTest("Cache 매거진 채우기/비우기", "용량=64 | 매거진=8 | Cache 소멸 시 반납", TestCacheRefillAndFlush);
+    _passed_test_count += RunTest("MPMCQueue를 통한 핸들 전달", "생산자/소비자=4/4 | 핸들=200000개 | 동시 소유 검사", TestConcurrentHandoff);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
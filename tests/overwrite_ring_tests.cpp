@@ -0,0 +1,269 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "overwrite_ring.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    // 트레이스 이벤트처럼 여러 word로 된 항목: 모든 필드가 같은 값에서 나와야 한다
+    struct TraceEvent
+    {
+        std::uint64_t _producer;
+        std::uint64_t _index;
+        std::uint64_t _check[3];
+    };
+
+    TraceEvent MakeEvent(std::uint64_t _producer, std::uint64_t _index)
+    {
+        const std::uint64_t _mixed = _producer * 1'000'003 + _index;
+        return TraceEvent{_producer, _index, {_mixed, ~_mixed, _mixed ^ 0x5555}};
+    }
+
+    bool IsConsistent(const TraceEvent& _event)
+    {
+        const std::uint64_t _mixed = _event._producer * 1'000'003 + _event._index;
+        return _event._check[0] == _mixed && _event._check[1] == ~_mixed && _event._check[2] == (_mixed ^ 0x5555);
+    }
+
+    // 소비자 없이 용량의 1.5배를 넣으면 오래된 절반이 덮어쓰이고, Pop은 남은 항목을 순서대로 돌려주며 손실을 센다.
+    void TestOverwriteOldest()
+    {
+        constexpr size_t Size = 16;
+        auto _ring = std::make_unique<OverwriteRing<std::uint32_t, Size>>();
+
+        std::uint32_t _value = 0;
+        Check(false == _ring->Pop(_value) && true == _ring->IsEmpty(), "빈 링에서 Pop이 성공함");
+
+        for (std::uint32_t i = 0; i < Size + Size / 2; ++i)
+        {
+            Check(_ring->Push(i * 10) == i, "Push가 돌려준 sequence가 틀림");
+        }
+
+        Check(_ring->GetSize() == Size && _ring->GetPushCount() == Size + Size / 2, "크기나 Push 수가 틀림");
+
+        std::uint64_t _sequence = 0;
+        bool _ordered = true;
+        size_t _pop_count = 0;
+
+        while (true == _ring->Pop(_value, _sequence))
+        {
+            const std::uint64_t _expected = Size / 2 + _pop_count;
+            _ordered = _ordered && _sequence == _expected && _value == _expected * 10;
+            ++_pop_count;
+        }
+
+        Check(_pop_count == Size && true == _ordered, "남은 항목이 순서대로 나오지 않음");
+        Check(_ring->GetLostCount() == Size / 2, "손실 수가 틀림");
+
+        // 다 읽은 뒤 넣은 항목은 손실 없이 나온다
+        _ring->Push(777);
+        Check(true == _ring->Pop(_value, _sequence) && _value == 777 && _sequence == Size + Size / 2, "이어서 넣은 항목이 틀림");
+        Check(_ring->GetLostCount() == Size / 2, "손실이 아닌데 손실 수가 늘어남");
+    }
+
+    // Snapshot은 최근 N개를 오래된 것부터 복사하고 소비하지 않는다.
+    void TestSnapshotLastEntries()
+    {
+        constexpr size_t Size = 8;
+        auto _ring = std::make_unique<OverwriteRing<TraceEvent, Size>>();
+        std::array<TraceEvent, Size * 2> _items{};
+
+        Check(_ring->Snapshot(_items.data(), _items.size()) == 0, "빈 링의 Snapshot이 항목을 돌려줌");
+
+        for (std::uint64_t i = 0; i < 3; ++i)
+        {
+            _ring->Push(MakeEvent(0, i));
+        }
+
+        Check(_ring->Snapshot(_items.data(), _items.size()) == 3 && _items[0]._index == 0 && _items[2]._index == 2, "채워지기 전 Snapshot이 틀림");
+
+        for (std::uint64_t i = 3; i < 20; ++i)
+        {
+            _ring->Push(MakeEvent(0, i));
+        }
+
+        Check(_ring->Snapshot(_items.data(), 5) == 5 && _items[0]._index == 15 && _items[4]._index == 19, "최근 5개가 틀림");
+
+        const size_t _copied = _ring->Snapshot(_items.data(), _items.size());
+        Check(_copied == Size && _items[0]._index == 20 - Size && _items[Size - 1]._index == 19, "최대 Snapshot이 용량만큼의 최근 항목이 아님");
+
+        TraceEvent _event{};
+        Check(true == _ring->Pop(_event) && _event._index == 20 - Size, "Snapshot이 항목을 소비함");
+    }
+
+    // 여러 생산자가 작은 링을 계속 덮어쓰는 동안 소비자와 Snapshot이 찢어진 항목을 보지 않고,
+    // 생산자별 순서가 유지되며, 받은 수와 손실 수의 합이 넣은 수와 같은지 확인한다.
+    void TestConcurrentOverwrite()
+    {
+        constexpr size_t Size = 64;
+        constexpr size_t ProducerCount = 4;
+        constexpr std::uint64_t EventsPerProducer = 200'000;
+
+        auto _ring = std::make_unique<OverwriteRing<TraceEvent, Size>>();
+        std::atomic<size_t> _finished_count{0};
+        std::vector<std::thread> _threads;
+
+        for (std::uint64_t _producer = 0; _producer < ProducerCount; ++_producer)
+        {
+            _threads.emplace_back([&_ring, &_finished_count, _producer]()
+            {
+                for (std::uint64_t i = 0; i < EventsPerProducer; ++i)
+                {
+                    _ring->Push(MakeEvent(_producer, i));
+
+                    // 코어가 적어도 소비자와 Snapshot이 중간에 끼어들게 한다
+                    if (i % 128 == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                _finished_count.fetch_add(1, std::memory_order_release);
+            });
+        }
+
+        std::atomic<bool> _snapshot_consistent{true};
+        std::atomic<size_t> _snapshot_count{0};
+        _threads.emplace_back([&]()
+        {
+            std::array<TraceEvent, 16> _items{};
+
+            while (_finished_count.load(std::memory_order_acquire) != ProducerCount)
+            {
+                const size_t _copied = _ring->Snapshot(_items.data(), _items.size());
+                for (size_t i = 0; i < _copied; ++i)
+                {
+                    if (false == IsConsistent(_items[i]))
+                    {
+                        _snapshot_consistent.store(false);
+                    }
+                }
+
+                _snapshot_count.fetch_add(1, std::memory_order_relaxed);
+                std::this_thread::yield();
+            }
+        });
+
+        std::array<std::uint64_t, ProducerCount> _next_index{};
+        bool _consistent = true;
+        bool _ordered = true;
+        std::uint64_t _last_sequence = 0;
+        std::uint64_t _received_count = 0;
+        TraceEvent _event{};
+        std::uint64_t _sequence = 0;
+
+        while (true)
+        {
+            const bool _finished = _finished_count.load(std::memory_order_acquire) == ProducerCount;
+
+            while (true == _ring->Pop(_event, _sequence))
+            {
+                _consistent = _consistent && IsConsistent(_event);
+                _ordered = _ordered && (_received_count == 0 || _sequence > _last_sequence) && _event._index >= _next_index[_event._producer];
+                _next_index[_event._producer] = _event._index + 1;
+                _last_sequence = _sequence;
+                ++_received_count;
+            }
+
+            if (true == _finished)
+            {
+                break;
+            }
+
+            std::this_thread::yield();
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        Check(true == _consistent, "Pop이 찢어진 항목을 돌려줌");
+        Check(true == _snapshot_consistent.load(), "Snapshot이 찢어진 항목을 돌려줌");
+        Check(true == _ordered, "sequence나 생산자별 순서가 거꾸로 감");
+        Check(_received_count + _ring->GetLostCount() == ProducerCount * EventsPerProducer, "받은 수와 손실 수의 합이 넣은 수와 다름");
+        Check(_ring->GetLostCount() > 0, "작은 링인데 덮어쓰기가 일어나지 않음");
+
+        std::cout << "       넣음=" << ProducerCount * EventsPerProducer
+                  << " | 받음=" << _received_count
+                  << " | 손실=" << _ring->GetLostCount()
+                  << " | Snapshot=" << _snapshot_count.load() << '\n';
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 3;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "OverwriteRing 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("오래된 항목 덮어쓰기", "크기=16 | 24개 Push | 손실 수", TestOverwriteOldest);
+    _passed_test_count += RunTest("최근 항목 Snapshot", "크기=8 | 최근 5개 | 최대 용량", TestSnapshotLastEntries);
+    _passed_test_count += RunTest("동시 덮어쓰기", "생산자=4 | 크기=64 | 항목=40바이트 | Snapshot 스레드", TestConcurrentOverwrite);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
@@ -0,0 +1,263 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "partitioned_queue.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    struct KeyedItem
+    {
+        std::uint64_t _key;
+        std::uint64_t _sequence;
+    };
+
+    // 같은 파티션의 항목은 넣은 순서대로 나오고, _max_count보다 많이 남으면 파티션이 다시 준비되는지 확인한다.
+    void TestFifoAndRequeue()
+    {
+        constexpr size_t PartitionCount = 4;
+        auto _queue = std::make_unique<PartitionedQueue<KeyedItem, PartitionCount, 16>>();
+
+        // 같은 파티션으로 가는 두 키와 다른 파티션으로 가는 키를 찾는다
+        const size_t _first_partition = lfq::GetPartitionIndex(0, PartitionCount);
+        std::uint64_t _same_key = 1;
+        while (lfq::GetPartitionIndex(_same_key, PartitionCount) != _first_partition)
+        {
+            ++_same_key;
+        }
+
+        std::uint64_t _other_key = 1;
+        while (lfq::GetPartitionIndex(_other_key, PartitionCount) == _first_partition)
+        {
+            ++_other_key;
+        }
+
+        for (std::uint64_t i = 0; i < 5; ++i)
+        {
+            Check(true == _queue->Push(i % 2 == 0 ? 0 : _same_key, KeyedItem{i % 2 == 0 ? 0 : _same_key, i}), "Push 실패");
+        }
+
+        Check(true == _queue->Push(_other_key, KeyedItem{_other_key, 100}), "다른 파티션 Push 실패");
+        Check(_queue->GetReadyPartitionCount() == 2, "준비된 파티션 수가 틀림");
+        Check(_queue->GetPendingCount(_first_partition) == 5, "대기 항목 수가 틀림");
+
+        std::vector<std::uint64_t> _sequences;
+        const auto _collect = [&_sequences](KeyedItem& _item) { _sequences.push_back(_item._sequence); };
+
+        // 첫 파티션에서 3개만 처리하면 남은 2개 때문에 파티션이 링 뒤에 다시 들어간다
+        Check(_queue->Consume(_collect, 3) == 3, "첫 Consume이 _max_count만큼 처리하지 않음");
+        Check(_queue->Consume(_collect, 3) == 1, "다른 파티션을 처리하지 않음");
+        Check(_queue->Consume(_collect, 3) == 2, "남은 항목이 있는 파티션이 다시 준비되지 않음");
+        Check(_queue->Consume(_collect, 3) == 0 && true == _queue->IsEmpty(), "빈 큐에서 처리함");
+
+        Check(_sequences == std::vector<std::uint64_t>{0, 1, 2, 100, 3, 4}, "처리 순서가 틀림");
+        Check(_queue->GetPendingCount(_first_partition) == 0, "처리 후 대기 항목 수가 0이 아님");
+
+        // 비워진 파티션은 다음 Push에서 다시 준비된다
+        Check(true == _queue->Push(0, KeyedItem{0, 5}) && _queue->GetReadyPartitionCount() == 1, "비워진 파티션이 다시 준비되지 않음");
+    }
+
+    // 파티션이 가득 차면 Push가 실패하고, 다른 파티션에는 영향이 없는지 확인한다.
+    void TestPartitionFull()
+    {
+        constexpr size_t PartitionCount = 2;
+        constexpr size_t PartitionSize = 8;
+        auto _queue = std::make_unique<PartitionedQueue<std::uint64_t, PartitionCount, PartitionSize>>();
+
+        const size_t _full_partition = lfq::GetPartitionIndex(0, PartitionCount);
+        std::uint64_t _other_key = 1;
+        while (lfq::GetPartitionIndex(_other_key, PartitionCount) == _full_partition)
+        {
+            ++_other_key;
+        }
+
+        for (std::uint64_t i = 0; i < PartitionSize; ++i)
+        {
+            Check(true == _queue->Push(0, i), "가득 차기 전에 Push 실패");
+        }
+
+        Check(false == _queue->Push(0, PartitionSize), "가득 찬 파티션에 Push 성공");
+        Check(true == _queue->Push(_other_key, 0), "다른 파티션 Push 실패");
+        Check(_queue->GetPendingCount(_full_partition) == PartitionSize, "실패한 Push가 대기 항목 수를 늘림");
+
+        size_t _total_count = 0;
+        while (const size_t _count = _queue->Consume([](std::uint64_t&) {}, 64))
+        {
+            _total_count += _count;
+        }
+
+        Check(_total_count == PartitionSize + 1, "처리한 항목 수가 틀림");
+    }
+
+    // 여러 생산자와 소비자가 뜨거운 키에 몰려도 같은 키는 동시에 처리되지 않고 생산자별 순서를 지키는지 확인한다.
+    void TestConcurrentPerKeyOrdering()
+    {
+        constexpr size_t ProducerCount = 3;
+        constexpr size_t ConsumerCount = 4;
+        constexpr size_t KeyCount = 32;
+        constexpr std::uint64_t ItemsPerProducer = 100'000;
+        constexpr std::uint64_t TotalCount = ProducerCount * ItemsPerProducer;
+
+        // 키 = 생산자 * KeyCount + 키 번호 로 만들어 키마다 생산자가 하나다
+        struct Item
+        {
+            std::uint32_t _key;
+            std::uint32_t _sequence;
+        };
+
+        auto _queue = std::make_unique<PartitionedQueue<Item, 16, 1024>>();
+        auto _busy_flags = std::make_unique<std::array<std::atomic<bool>, ProducerCount * KeyCount>>();
+        auto _last_sequences = std::make_unique<std::array<std::int64_t, ProducerCount * KeyCount>>();
+        _last_sequences->fill(-1);
+
+        std::atomic<std::uint64_t> _processed_count{0};
+        std::atomic<bool> _overlapped{false};
+        std::atomic<bool> _reordered{false};
+        std::vector<std::thread> _threads;
+
+        for (size_t _producer_index = 0; _producer_index < ProducerCount; ++_producer_index)
+        {
+            _threads.emplace_back([&_queue, _producer_index]()
+            {
+                for (std::uint32_t _sequence = 0; _sequence < ItemsPerProducer; ++_sequence)
+                {
+                    // 키 0이 절반을 차지하는 치우친 분포
+                    const std::uint32_t _key_number = _sequence % 2 == 0 ? 0 : _sequence % KeyCount;
+                    const std::uint32_t _key = static_cast<std::uint32_t>(_producer_index * KeyCount + _key_number);
+
+                    while (false == _queue->Push(_key, Item{_key, _sequence}))
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    if (_sequence % 64 == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (size_t _consumer_index = 0; _consumer_index < ConsumerCount; ++_consumer_index)
+        {
+            _threads.emplace_back([&]()
+            {
+                const auto _handler = [&](Item& _item)
+                {
+                    if (true == (*_busy_flags)[_item._key].exchange(true, std::memory_order_acquire))
+                    {
+                        _overlapped.store(true, std::memory_order_relaxed);
+                    }
+
+                    // 소유권이 넘어갈 때의 순서 보장만으로 안전한 일반 메모리 접근
+                    std::int64_t& _last_sequence = (*_last_sequences)[_item._key];
+                    if (static_cast<std::int64_t>(_item._sequence) <= _last_sequence)
+                    {
+                        _reordered.store(true, std::memory_order_relaxed);
+                    }
+
+                    _last_sequence = _item._sequence;
+                    (*_busy_flags)[_item._key].store(false, std::memory_order_release);
+                };
+
+                while (_processed_count.load(std::memory_order_relaxed) < TotalCount)
+                {
+                    const size_t _count = _queue->Consume(_handler, 32);
+                    if (_count == 0)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    _processed_count.fetch_add(_count, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        Check(_processed_count.load() == TotalCount, "처리한 항목 수가 틀림");
+        Check(false == _overlapped.load(), "같은 키를 두 소비자가 동시에 처리함");
+        Check(false == _reordered.load(), "같은 키의 처리 순서가 바뀜");
+        Check(true == _queue->IsEmpty(), "처리 후 준비된 파티션이 남음");
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 3;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "PartitionedQueue 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("FIFO와 재준비", "파티션=4 | _max_count=3 | 같은 파티션 두 키", TestFifoAndRequeue);
+    _passed_test_count += RunTest("파티션 가득 참", "파티션=2 | 파티션 크기=8", TestPartitionFull);
+    _passed_test_count += RunTest("동시 키별 순서", "생산자=3 | 소비자=4 | 파티션=16 | 키 0에 절반 몰림", TestConcurrentPerKeyOrdering);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
@@ -0,0 +1,222 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <poll.h>
+#include <sys/epoll.h>
+
+#include "queue_notifier.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    bool IsReadable(int _fd)
+    {
+        pollfd _poll_fd{_fd, POLLIN, 0};
+        return poll(&_poll_fd, 1, 0) == 1;
+    }
+
+    // 소비자가 대기를 알리지 않았으면 Push 경로에서 eventfd에 쓰지 않는지 확인한다.
+    // 대기를 알린 뒤에는 첫 Push만 한 번 쓰는지 검증한다.
+    void TestNotifyOnlyWhenWaiting()
+    {
+        QueueNotifier _notifier;
+        MPMCQueue<int, 8> _queue;
+
+        Check(true == PushAndNotify(_queue, _notifier, 1), "첫 번째 Push 실패");
+        Check(true == PushAndNotify(_queue, _notifier, 2), "두 번째 Push 실패");
+        Check(_notifier.GetWriteCount() == 0, "대기 중인 소비자가 없는데 eventfd에 씀");
+        Check(false == IsReadable(_notifier.GetFd()), "대기 중인 소비자가 없는데 fd가 읽기 가능함");
+
+        _notifier.PrepareWait();
+        Check(true == PushAndNotify(_queue, _notifier, 3), "세 번째 Push 실패");
+        Check(true == PushAndNotify(_queue, _notifier, 4), "네 번째 Push 실패");
+        Check(_notifier.GetWriteCount() == 1, "대기 알림 후 eventfd 쓰기 횟수가 1이 아님");
+        Check(true == IsReadable(_notifier.GetFd()), "대기 알림 후 Push했는데 fd가 읽기 가능하지 않음");
+    }
+
+    // DrainQueue가 큐를 모두 비우고 대기 상태로 재무장하는지 확인한다.
+    // 처리 한도에 걸리면 fd를 읽기 가능 상태로 남기는지 검증한다.
+    void TestDrainRearm()
+    {
+        QueueNotifier _notifier;
+        MPMCQueue<int, 16> _queue;
+        std::vector<int> _received;
+
+        for (int i = 0; i < 10; ++i)
+        {
+            _queue.Push(i);
+        }
+
+        const size_t _limited_count = DrainQueue(_queue, _notifier, [&_received](int _value) { _received.push_back(_value); }, 4);
+        Check(_limited_count == 4, "처리 한도만큼 처리하지 않음");
+        Check(true == IsReadable(_notifier.GetFd()), "처리 한도에 걸렸는데 fd가 읽기 가능하지 않음");
+
+        const size_t _rest_count = DrainQueue(_queue, _notifier, [&_received](int _value) { _received.push_back(_value); });
+        Check(_rest_count == 6, "남은 항목을 모두 처리하지 않음");
+        Check(false == IsReadable(_notifier.GetFd()), "큐를 비운 뒤에도 fd가 읽기 가능함");
+
+        for (int i = 0; i < static_cast<int>(_received.size()); ++i)
+        {
+            Check(_received[i] == i, "DrainQueue 처리 순서가 틀림");
+        }
+
+        // 재무장되었으므로 다음 Push는 fd를 깨워야 함
+        PushAndNotify(_queue, _notifier, 10);
+        Check(true == IsReadable(_notifier.GetFd()), "재무장 후 Push가 fd를 깨우지 않음");
+    }
+
+    // 생산자가 불규칙하게 쉬면서 Push할 때 epoll 소비자가 시간 초과 없이 모든 값을 순서대로 받는지 확인한다.
+    template <typename QueueType>
+    void RunEpollDeliveryCase(const char* _queue_name)
+    {
+        constexpr std::int64_t ItemCount = 20'000;
+        QueueType _queue(7);
+        QueueNotifier _notifier;
+
+        const int _epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        epoll_event _event{};
+        _event.events = EPOLLIN;
+        epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _notifier.GetFd(), &_event);
+
+        std::thread _producer([&_queue, &_notifier]()
+        {
+            for (std::int64_t _value = 0; _value < ItemCount; ++_value)
+            {
+                while (false == PushAndNotify(_queue, _notifier, _value))
+                {
+                    std::this_thread::yield();
+                }
+
+                // 소비자가 자주 잠들도록 주기적으로 쉼
+                if ((_value % 97) == 0)
+                {
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+            }
+        });
+
+        std::int64_t _expected = 0;
+        size_t _timeout_count = 0;
+        size_t _order_error_count = 0;
+
+        while (_expected < ItemCount)
+        {
+            DrainQueue(_queue, _notifier, [&_expected, &_order_error_count](std::int64_t _value)
+            {
+                if (_value != _expected)
+                {
+                    ++_order_error_count;
+                }
+                _expected = _value + 1;
+            });
+
+            if (_expected >= ItemCount)
+            {
+                break;
+            }
+
+            epoll_event _ready{};
+            if (epoll_wait(_epoll_fd, &_ready, 1, 2000) == 0)
+            {
+                ++_timeout_count;
+            }
+        }
+
+        _producer.join();
+        close(_epoll_fd);
+
+        Check(_timeout_count == 0, "항목이 남아 있는데 epoll_wait가 시간 초과됨 (깨우기 손실)");
+        Check(_order_error_count == 0, "epoll 소비자의 수신 순서가 틀림");
+        Check(_expected == ItemCount, "모든 항목을 받지 못함");
+
+        std::cout << "       " << _queue_name
+                  << " | 항목=" << ItemCount
+                  << " | eventfd write=" << _notifier.GetWriteCount()
+                  << " | read=" << _notifier.GetReadCount()
+                  << " | 시간 초과=" << _timeout_count << '\n';
+    }
+
+    // SPSC_Q와 크기를 맞춘 MPMCQueue 래퍼 (생성자 인자만 받아 무시)
+    struct SmallMpmcQueue : MPMCQueue<std::int64_t, 8>
+    {
+        explicit SmallMpmcQueue(size_t) {}
+    };
+
+    void TestEpollDelivery()
+    {
+        RunEpollDeliveryCase<SPSC_Q>("SPSC_Q");
+        RunEpollDeliveryCase<SmallMpmcQueue>("MPMCQueue");
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+// SmallMpmcQueue는 MPMCQueue를 상속하므로 같은 어댑터를 사용한다.
+template <>
+struct lfq::NotifierQueueTraits<SmallMpmcQueue> : lfq::NotifierQueueTraits<MPMCQueue<std::int64_t, 8>>
+{
+};
+
+int main()
+{
+    constexpr int TestCount = 3;
+    int _passed_test_count = 0;
+
+    std::cout << "QueueNotifier 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("대기 중일 때만 알림", "대기 전 Push 시스템 호출 없음 | 대기 후 첫 Push만 write", TestNotifyOnlyWhenWaiting);
+    _passed_test_count += RunTest("DrainQueue 재무장", "처리 한도 | 큐 비운 뒤 재무장 | 처리 순서", TestDrainRearm);
+    _passed_test_count += RunTest("epoll 소비자 전달", "SPSC_Q, MPMCQueue | 항목=20000개 | 깨우기 손실 검사", TestEpollDelivery);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
@@ -0,0 +1,236 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mpmc_queue.h"
+#include "mutex_queue.h"
+#include "queue_telemetry.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    bool Contains(const std::string& _text, const std::string& _line)
+    {
+        return _text.find(_line + '\n') != std::string::npos;
+    }
+
+    // 깊이를 바꿔 가며 직접 샘플링하고 최고 수위, 빈/가득 찬 샘플과 이벤트, 히스토그램 버킷을 확인한다.
+    void TestSampleStatistics()
+    {
+        auto _queue = std::make_unique<MPMCQueue<std::uint32_t, 16>>();
+        QueueTelemetry _telemetry;
+        _telemetry.Register("jobs", *_queue);
+
+        const auto _fill_to = [&_queue](size_t _depth)
+        {
+            std::uint32_t _value = 0;
+            while (_queue->GetSize() > _depth && true == _queue->Pop(_value))
+            {
+            }
+            while (_queue->GetSize() < _depth && true == _queue->Push(0))
+            {
+            }
+        };
+
+        // 깊이 0 → 4 → 16 → 16 → 8 → 0
+        for (const size_t _depth : {0, 4, 16, 16, 8, 0})
+        {
+            _fill_to(_depth);
+            _telemetry.SampleOnce();
+        }
+
+        const auto _snapshots = _telemetry.GetSnapshot();
+        Check(_snapshots.size() == 1, "등록한 큐가 스냅샷에 없음");
+
+        const auto& _snapshot = _snapshots[0];
+        Check(_snapshot._capacity == 16 && _snapshot._depth == 0 && _snapshot._high_water_mark == 16, "용량, 깊이, 최고 수위가 틀림");
+        Check(_snapshot._sample_count == 6 && _snapshot._empty_sample_count == 2 && _snapshot._full_sample_count == 2, "샘플 수가 틀림");
+
+        // 첫 샘플은 이전 상태가 없으므로 이벤트가 아님
+        Check(_snapshot._empty_event_count == 1 && _snapshot._full_event_count == 1, "빈/가득 찬 이벤트 수가 틀림");
+
+        // 버킷 상한: 0, 1/16, 1/8, 1/4, 1/2, 3/4, 0.9, 1
+        const std::array<std::uint64_t, QueueTelemetry::HISTOGRAM_BUCKET_COUNT> _expected_buckets = {2, 0, 0, 1, 1, 0, 0, 2};
+        Check(_snapshot._bucket_counts == _expected_buckets, "히스토그램 버킷이 틀림");
+        Check(_snapshot._occupancy_sum == 0.25 + 1.0 + 1.0 + 0.5, "점유율 합계가 틀림");
+    }
+
+    // 텍스트 형식의 주요 줄, 누적 버킷, 레이블 이스케이프, 등록 해제를 확인한다.
+    void TestExportFormat()
+    {
+        auto _lock_free_queue = std::make_unique<MPMCQueue<std::uint32_t, 8>>();
+        auto _mutex_queue = std::make_unique<MutexQueue<std::uint32_t, 4>>();
+        QueueTelemetry _telemetry;
+
+        const auto _lock_free_id = _telemetry.Register("jobs", *_lock_free_queue);
+        _telemetry.Register("log \"main\"", *_mutex_queue);
+
+        for (std::uint32_t i = 0; i < 4; ++i)
+        {
+            _mutex_queue->Push(i);
+        }
+        _lock_free_queue->Push(1);
+        _telemetry.SampleOnce();
+
+        std::string _text = _telemetry.ExportText();
+        Check(Contains(_text, "# TYPE lfq_queue_depth gauge"), "TYPE 줄이 없음");
+        Check(Contains(_text, "lfq_queue_capacity{queue=\"jobs\"} 8"), "용량 줄이 틀림");
+        Check(Contains(_text, "lfq_queue_depth{queue=\"jobs\"} 1"), "깊이 줄이 틀림");
+        Check(Contains(_text, "lfq_queue_depth_high_water{queue=\"log \\\"main\\\"\"} 4"), "레이블 이스케이프나 최고 수위가 틀림");
+        Check(Contains(_text, "lfq_queue_full_samples_total{queue=\"log \\\"main\\\"\"} 1"), "가득 찬 샘플 수가 틀림");
+        Check(Contains(_text, "lfq_queue_occupancy_bucket{queue=\"jobs\",le=\"0.0625\"} 0"), "버킷 줄이 틀림");
+        Check(Contains(_text, "lfq_queue_occupancy_bucket{queue=\"jobs\",le=\"0.125\"} 1"), "누적 버킷이 틀림");
+        Check(Contains(_text, "lfq_queue_occupancy_bucket{queue=\"jobs\",le=\"+Inf\"} 1"), "+Inf 버킷이 틀림");
+        Check(Contains(_text, "lfq_queue_occupancy_count{queue=\"jobs\"} 1"), "히스토그램 count가 틀림");
+
+        _telemetry.Unregister(_lock_free_id);
+        _text = _telemetry.ExportText();
+        Check(_text.find("queue=\"jobs\"") == std::string::npos, "등록 해제한 큐가 남아 있음");
+        Check(_text.find("queue=\"log") != std::string::npos, "다른 큐까지 사라짐");
+    }
+
+    // 샘플러 스레드가 생산/소비 중인 큐를 주기적으로 읽고, 파일과 콜백으로 내보내는지 확인한다.
+    void TestSamplerThreadAndExport()
+    {
+        auto _queue = std::make_unique<MPMCQueue<std::uint32_t, 1024>>();
+        const std::filesystem::path _path = std::filesystem::temp_directory_path() / "lfq_queue_telemetry_test.prom";
+        std::filesystem::remove(_path);
+
+        std::atomic<size_t> _export_count{0};
+        QueueTelemetry _telemetry;
+        _telemetry.Register("work", *_queue);
+        _telemetry.SetExportFile(_path.string());
+        _telemetry.SetExportCallback([&_export_count](const std::string& _text)
+        {
+            if (_text.find("lfq_queue_samples_total{queue=\"work\"}") != std::string::npos)
+            {
+                _export_count.fetch_add(1);
+            }
+        });
+
+        _telemetry.Start(std::chrono::microseconds(500), std::chrono::milliseconds(10));
+
+        std::atomic<bool> _running{true};
+        std::thread _producer([&_queue, &_running]()
+        {
+            while (true == _running.load(std::memory_order_relaxed))
+            {
+                if (false == _queue->Push(1))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        std::uint32_t _value = 0;
+        const auto _end_time = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+        while (std::chrono::steady_clock::now() < _end_time)
+        {
+            // 소비 속도를 늦춰 큐가 차고 비는 구간이 모두 생기게 한다
+            for (int i = 0; i < 2000 && true == _queue->Pop(_value); ++i)
+            {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+
+        _running.store(false);
+        _producer.join();
+        _telemetry.Stop();
+
+        const auto _snapshots = _telemetry.GetSnapshot();
+        std::ifstream _file(_path);
+        const std::string _file_text((std::istreambuf_iterator<char>(_file)), std::istreambuf_iterator<char>());
+
+        Check(_snapshots.size() == 1 && _snapshots[0]._sample_count >= 10, "샘플러 스레드가 충분히 샘플링하지 않음");
+        Check(_snapshots[0]._high_water_mark == 1024, "가득 찬 상태를 관측하지 못함");
+        Check(_export_count.load() >= 2, "콜백으로 주기적으로 내보내지 않음");
+        Check(_file_text.find("lfq_queue_samples_total{queue=\"work\"}") != std::string::npos, "파일로 내보내지 않음");
+
+        std::filesystem::remove(_path);
+
+        std::cout << "       샘플=" << _snapshots[0]._sample_count
+                  << " | 최고 수위=" << _snapshots[0]._high_water_mark
+                  << " | 가득 찬 이벤트=" << _snapshots[0]._full_event_count
+                  << " | 빈 이벤트=" << _snapshots[0]._empty_event_count
+                  << " | 내보내기=" << _export_count.load() << '\n';
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 3;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "QueueTelemetry 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("샘플 통계", "최고 수위 | 빈/가득 찬 이벤트 | 히스토그램", TestSampleStatistics);
+    _passed_test_count += RunTest("텍스트 내보내기", "Prometheus 형식 | 레이블 이스케이프 | 등록 해제", TestExportFormat);
+    _passed_test_count += RunTest("샘플러 스레드", "주기=0.5ms | 파일/콜백 내보내기", TestSamplerThreadAndExport);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
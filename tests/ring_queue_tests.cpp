@@ -0,0 +1,230 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "ring_queue.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    // 한 스레드에서 여러 바퀴 동안 가득 참/비어 있음 경계와 FIFO 순서를 확인한다.
+    template <typename QueueType>
+    void CheckCapacityAndOrder()
+    {
+        auto _queue = std::make_unique<QueueType>();
+        std::uint64_t _next_push = 0;
+        std::uint64_t _next_pop = 0;
+        bool _order_valid = true;
+
+        for (size_t _round = 0; _round < 5; ++_round)
+        {
+            while (true == _queue->Push(_next_push))
+            {
+                ++_next_push;
+            }
+
+            Check(_queue->GetSize() == _queue->GetCapacity(), "가득 찼는데 크기가 용량과 다름");
+
+            std::uint64_t _value = 0;
+            while (true == _queue->Pop(_value))
+            {
+                _order_valid &= _value == _next_pop;
+                ++_next_pop;
+            }
+
+            Check(true == _queue->IsEmpty(), "모두 꺼냈는데 비어 있지 않음");
+        }
+
+        Check(_next_push == 5 * _queue->GetCapacity(), "용량만큼 넣지 못했거나 용량보다 많이 넣음");
+        Check(_next_pop == _next_push && true == _order_valid, "넣은 순서대로 꺼내지 않음");
+    }
+
+    void TestCapacityAndOrder()
+    {
+        CheckCapacityAndOrder<SPSCRingQueue<std::uint64_t, 16>>();
+        CheckCapacityAndOrder<MPSCRingQueue<std::uint64_t, 16>>();
+        CheckCapacityAndOrder<SPMCRingQueue<std::uint64_t, 16>>();
+        CheckCapacityAndOrder<MPMCRingQueue<std::uint64_t, 16>>();
+    }
+
+    template <typename QueueType>
+    void CheckMoveOnly()
+    {
+        auto _queue = std::make_unique<QueueType>();
+
+        Check(true == _queue->Push(std::make_unique<int>(7)), "이동 전용 타입 Push 실패");
+
+        std::unique_ptr<int> _item;
+        Check(true == _queue->Pop(_item) && nullptr != _item && *_item == 7, "이동 전용 타입의 값이 전달되지 않음");
+    }
+
+    // 복사할 수 없는 타입도 Push(T&&)/Pop으로 옮길 수 있는지 확인한다.
+    void TestMoveOnly()
+    {
+        CheckMoveOnly<SPSCRingQueue<std::unique_ptr<int>, 4>>();
+        CheckMoveOnly<MPSCRingQueue<std::unique_ptr<int>, 4>>();
+        CheckMoveOnly<SPMCRingQueue<std::unique_ptr<int>, 4>>();
+        CheckMoveOnly<MPMCRingQueue<std::unique_ptr<int>, 4>>();
+    }
+
+    // 지정한 수의 생산자/소비자 스레드로 모든 항목이 정확히 한 번 전달되고,
+    // 각 소비자가 한 생산자의 항목을 넣은 순서대로 받는지 확인한다.
+    template <typename QueueType, size_t ProducerCount, size_t ConsumerCount>
+    void TestConcurrent()
+    {
+        constexpr std::uint64_t ItemsPerProducer = 200'000;
+        constexpr std::uint64_t TotalCount = ProducerCount * ItemsPerProducer;
+
+        auto _queue = std::make_unique<QueueType>();
+        std::vector<std::atomic<std::uint8_t>> _received(TotalCount);
+        std::atomic<std::uint64_t> _received_count{0};
+        std::atomic<size_t> _error_count{0};
+
+        std::vector<std::thread> _threads;
+
+        for (size_t _producer = 0; _producer < ProducerCount; ++_producer)
+        {
+            _threads.emplace_back([&_queue, _producer]()
+            {
+                for (std::uint64_t _sequence = 0; _sequence < ItemsPerProducer; ++_sequence)
+                {
+                    while (false == _queue->Push((static_cast<std::uint64_t>(_producer) << 32) | _sequence))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (size_t _consumer = 0; _consumer < ConsumerCount; ++_consumer)
+        {
+            _threads.emplace_back([&]()
+            {
+                std::vector<std::int64_t> _last_sequence(ProducerCount, -1);
+                size_t _local_error_count = 0;
+                std::uint64_t _value = 0;
+
+                while (_received_count.load(std::memory_order_relaxed) < TotalCount)
+                {
+                    if (false == _queue->Pop(_value))
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    const size_t _producer = static_cast<size_t>(_value >> 32);
+                    const std::int64_t _sequence = static_cast<std::int64_t>(_value & 0xffffffffu);
+
+                    if (_producer >= ProducerCount || _sequence <= _last_sequence[_producer] ||
+                        _received[_producer * ItemsPerProducer + static_cast<std::uint64_t>(_sequence)].exchange(1) != 0)
+                    {
+                        ++_local_error_count;
+                    }
+                    else
+                    {
+                        _last_sequence[_producer] = _sequence;
+                    }
+
+                    _received_count.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                _error_count.fetch_add(_local_error_count);
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        Check(_received_count.load() == TotalCount, "받은 항목 수가 보낸 수와 다름");
+        Check(_error_count.load() == 0, "항목이 중복되었거나 순서가 바뀜");
+        Check(true == _queue->IsEmpty(), "모두 받았는데 비어 있지 않음");
+
+        std::cout << "       생산자=" << ProducerCount
+                  << " | 소비자=" << ConsumerCount
+                  << " | 항목=" << TotalCount
+                  << " | 오류=" << _error_count.load() << '\n';
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 6;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "RingQueue 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("용량과 순서", "4가지 조합 | 용량=16 | 5바퀴", TestCapacityAndOrder);
+    _passed_test_count += RunTest("이동 전용 타입", "4가지 조합 | unique_ptr", TestMoveOnly);
+    _passed_test_count += RunTest("SPSC 동시 전달", "생산자=1 | 소비자=1 | 누락/중복/순서 검사",
+        TestConcurrent<SPSCRingQueue<std::uint64_t, 64>, 1, 1>);
+    _passed_test_count += RunTest("MPSC 동시 전달", "생산자=4 | 소비자=1 | 누락/중복/순서 검사",
+        TestConcurrent<MPSCRingQueue<std::uint64_t, 64>, 4, 1>);
+    _passed_test_count += RunTest("SPMC 동시 전달", "생산자=1 | 소비자=4 | 누락/중복/순서 검사",
+        TestConcurrent<SPMCRingQueue<std::uint64_t, 64>, 1, 4>);
+    _passed_test_count += RunTest("MPMC 동시 전달", "생산자=4 | 소비자=4 | 누락/중복/순서 검사",
+        TestConcurrent<MPMCRingQueue<std::uint64_t, 64>, 4, 4>);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
@@ -0,0 +1,262 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "sojourn_queue.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    // 테스트가 직접 시각을 정하는 시계
+    struct ManualClock
+    {
+        static inline std::atomic<std::uint64_t> s_now{0};
+
+        static std::uint64_t Now() noexcept { return s_now.load(std::memory_order_relaxed); }
+        static void Set(std::uint64_t _now) { s_now.store(_now, std::memory_order_relaxed); }
+    };
+
+    using ManualQueue = SojournQueue<std::uint32_t, 64, ManualClock>;
+
+    // 넣은 시각과 꺼낸 시각의 차이가 체류 시간으로 나오고, 큐 통계에 더해지는지 확인한다.
+    void TestSojournStats()
+    {
+        auto _queue = std::make_unique<ManualQueue>();
+
+        ManualClock::Set(1000);
+        _queue->Push(1);
+        ManualClock::Set(1500);
+        _queue->Push(2);
+
+        std::uint32_t _value = 0;
+        std::uint64_t _sojourn_ns = 0;
+
+        ManualClock::Set(4000);
+        Check(true == _queue->Pop(_value, _sojourn_ns) && _value == 1 && _sojourn_ns == 3000, "첫 항목의 체류 시간이 틀림");
+        ManualClock::Set(4100);
+        Check(true == _queue->Pop(_value, _sojourn_ns) && _value == 2 && _sojourn_ns == 2600, "두 번째 항목의 체류 시간이 틀림");
+        Check(false == _queue->Pop(_value, _sojourn_ns), "빈 큐에서 Pop이 성공함");
+
+        const lfq::SojournStats _stats = _queue->GetStats();
+        Check(_stats._pop_count == 2 && _stats._total_sojourn_ns == 5600 && _stats._max_sojourn_ns == 3000, "통계가 틀림");
+        Check(_stats._dropped_count == 0 && false == _stats._overloaded && false == _queue->IsOverloaded(), "CoDel이 꺼져 있는데 과부하로 판단함");
+    }
+
+    // Signal 모드: 체류 시간이 interval 동안 target을 넘으면 과부하가 되고, target 아래로 내려가면 풀린다.
+    void TestCoDelSignal()
+    {
+        auto _queue = std::make_unique<ManualQueue>();
+        _queue->SetCoDelPolicy(lfq::CoDelPolicy{lfq::CoDelMode::Signal, 100, 1000});
+
+        ManualClock::Set(0);
+        for (std::uint32_t i = 0; i < 10; ++i)
+        {
+            _queue->Push(i);
+        }
+
+        std::uint32_t _value = 0;
+
+        ManualClock::Set(200);
+        _queue->Pop(_value);
+        Check(false == _queue->IsOverloaded(), "target을 처음 넘자마자 과부하로 판단함");
+
+        ManualClock::Set(1100);
+        _queue->Pop(_value);
+        Check(false == _queue->IsOverloaded(), "interval이 지나기 전에 과부하로 판단함");
+
+        ManualClock::Set(1200);
+        _queue->Pop(_value);
+        Check(true == _queue->IsOverloaded(), "interval 동안 target을 넘었는데 과부하가 아님");
+
+        size_t _pop_count = 3;
+        while (true == _queue->Pop(_value))
+        {
+            ++_pop_count;
+        }
+        Check(_pop_count == 10 && _queue->GetStats()._dropped_count == 0, "Signal 모드에서 항목을 버림");
+
+        // 새 항목이 바로 꺼내지면 과부하가 풀린다
+        _queue->Push(99);
+        Check(true == _queue->Pop(_value) && _value == 99 && false == _queue->IsOverloaded(), "체류 시간이 내려갔는데 과부하가 풀리지 않음");
+    }
+
+    // Drop 모드: 과부하에 들어가면 하나를 버리고, 이후 interval / sqrt(n) 간격으로 버린다.
+    void TestCoDelDrop()
+    {
+        auto _queue = std::make_unique<ManualQueue>();
+        _queue->SetCoDelPolicy(lfq::CoDelPolicy{lfq::CoDelMode::Drop, 100, 1000});
+
+        ManualClock::Set(0);
+        for (std::uint32_t i = 0; i < 20; ++i)
+        {
+            _queue->Push(i);
+        }
+
+        std::uint32_t _value = 0;
+
+        ManualClock::Set(200);
+        Check(true == _queue->Pop(_value) && _value == 0, "과부하 전에 항목을 버림");
+
+        // 과부하 진입: 1을 버리고 2를 반환, 다음 버림은 1200 + 1000
+        ManualClock::Set(1200);
+        Check(true == _queue->Pop(_value) && _value == 2, "과부하 진입 시 하나를 버리지 않음");
+
+        ManualClock::Set(2199);
+        Check(true == _queue->Pop(_value) && _value == 3, "간격 전에 버림");
+
+        // 두 번째 버림: 4를 버리고 5를 반환, 다음 버림은 2200 + 1000 / sqrt(2) = 2907
+        ManualClock::Set(2200);
+        Check(true == _queue->Pop(_value) && _value == 5, "첫 간격 뒤에 버리지 않음");
+
+        ManualClock::Set(2906);
+        Check(true == _queue->Pop(_value) && _value == 6, "sqrt 간격 전에 버림");
+
+        ManualClock::Set(2907);
+        Check(true == _queue->Pop(_value) && _value == 8, "sqrt 간격 뒤에 버리지 않음");
+
+        const lfq::SojournStats _stats = _queue->GetStats();
+        Check(_stats._dropped_count == 3 && true == _stats._overloaded, "버린 수나 과부하 상태가 틀림");
+    }
+
+    // 실제 시계로 여러 생산자/소비자가 동시에 사용해도 모든 항목이 한 번씩 나오고 통계 수가 맞는지 확인한다.
+    void TestConcurrentPushPop()
+    {
+        constexpr size_t ThreadPairCount = 4;
+        constexpr std::uint64_t ItemsPerProducer = 100'000;
+        constexpr std::uint64_t TotalCount = ThreadPairCount * ItemsPerProducer;
+
+        auto _queue = std::make_unique<SojournQueue<std::uint64_t, 1024>>();
+        std::atomic<std::uint64_t> _remaining_count{TotalCount};
+        std::atomic<std::uint64_t> _checksum{0};
+        std::atomic<std::uint64_t> _sojourn_sum{0};
+        std::vector<std::thread> _threads;
+
+        for (size_t _thread_index = 0; _thread_index < ThreadPairCount; ++_thread_index)
+        {
+            _threads.emplace_back([&_queue, _thread_index]()
+            {
+                const std::uint64_t _first_value = _thread_index * ItemsPerProducer;
+                for (std::uint64_t _value = _first_value; _value < _first_value + ItemsPerProducer; ++_value)
+                {
+                    while (false == _queue->Push(_value))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+            _threads.emplace_back([&]()
+            {
+                std::uint64_t _local_checksum = 0;
+                std::uint64_t _local_sojourn_sum = 0;
+                std::uint64_t _value = 0;
+                std::uint64_t _sojourn_ns = 0;
+
+                while (_remaining_count.load(std::memory_order_relaxed) != 0)
+                {
+                    if (true == _queue->Pop(_value, _sojourn_ns))
+                    {
+                        _remaining_count.fetch_sub(1, std::memory_order_relaxed);
+                        _local_checksum += _value;
+                        _local_sojourn_sum += _sojourn_ns;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                _checksum.fetch_add(_local_checksum, std::memory_order_relaxed);
+                _sojourn_sum.fetch_add(_local_sojourn_sum, std::memory_order_relaxed);
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const lfq::SojournStats _stats = _queue->GetStats();
+        Check(_checksum.load() == TotalCount * (TotalCount - 1) / 2, "체크섬이 틀림");
+        Check(_stats._pop_count == TotalCount && _stats._total_sojourn_ns == _sojourn_sum.load(), "통계가 Pop 결과와 다름");
+        Check(_stats._max_sojourn_ns * TotalCount >= _stats._total_sojourn_ns, "최대 체류 시간이 평균보다 작음");
+
+        std::cout << "       평균 체류=" << _stats._total_sojourn_ns / TotalCount
+                  << " ns | 최대 체류=" << _stats._max_sojourn_ns << " ns\n";
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 4;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "SojournQueue 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("체류 시간 통계", "수동 시계 | 항목별 체류 시간 | 합계/최대", TestSojournStats);
+    _passed_test_count += RunTest("CoDel 알림", "target=100 | interval=1000 | 과부하 진입/해제", TestCoDelSignal);
+    _passed_test_count += RunTest("CoDel 버림", "target=100 | interval=1000 | interval/sqrt(n) 간격", TestCoDelDrop);
+    _passed_test_count += RunTest("동시 Push/Pop", "4P / 4C | 항목=400000 | 실제 시계", TestConcurrentPushPop);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
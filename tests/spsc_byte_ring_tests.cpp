@@ -0,0 +1,293 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "spsc_byte_ring.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    // 레코드 번호로 결정되는 바이트 패턴
+    std::uint8_t GetPatternByte(std::uint64_t _sequence, std::size_t _offset)
+    {
+        return static_cast<std::uint8_t>((_sequence * 131) + _offset);
+    }
+
+    void FillRecord(void* _destination, std::uint64_t _sequence, std::size_t _size)
+    {
+        auto* _bytes = static_cast<std::uint8_t*>(_destination);
+        for (std::size_t i = 0; i < _size; ++i)
+        {
+            _bytes[i] = GetPatternByte(_sequence, i);
+        }
+    }
+
+    bool VerifyRecord(const void* _data, std::uint64_t _sequence, std::size_t _size)
+    {
+        const auto* _bytes = static_cast<const std::uint8_t*>(_data);
+        for (std::size_t i = 0; i < _size; ++i)
+        {
+            if (_bytes[i] != GetPatternByte(_sequence, i))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void TestCapacityValidation()
+    {
+        for (const std::size_t _capacity : {std::size_t{0}, std::size_t{32}, std::size_t{100}})
+        {
+            bool _rejected = false;
+
+            try
+            {
+                SPSC_ByteRing _ring(_capacity);
+            }
+            catch (const std::invalid_argument&)
+            {
+                _rejected = true;
+            }
+
+            Check(true == _rejected, "잘못된 버퍼 크기를 거부하지 않음");
+        }
+
+        SPSC_ByteRing _ring(256);
+        Check(_ring.capacity() == 256 && _ring.max_record_size() == 120, "버퍼 크기나 최대 레코드 크기가 틀림");
+    }
+
+    // 예약 위치의 정렬, 크기를 줄인 commit, 가득 참과 최대 크기 초과, FIFO 순서를 확인한다.
+    void TestReserveCommitConsume()
+    {
+        SPSC_ByteRing _ring(256);
+
+        Check(nullptr == _ring.reserve(_ring.max_record_size() + 1), "최대 크기를 넘는 예약이 성공함");
+
+        void* _first = _ring.reserve(20);
+        Check(nullptr != _first && reinterpret_cast<std::uintptr_t>(_first) % SPSC_ByteRing::RECORD_ALIGNMENT == 0, "예약 위치가 정렬되지 않음");
+        FillRecord(_first, 1, 12);
+        _ring.commit(12);
+
+        Check(true == _ring.push("hello", 5), "push 실패");
+
+        // 24 + 16 = 40바이트 사용 중, 남은 216바이트에 128바이트 레코드는 하나만 들어감
+        void* _large = _ring.reserve(120);
+        Check(nullptr != _large, "공간이 충분한데 예약 실패");
+        FillRecord(_large, 3, 120);
+        _ring.commit();
+        Check(nullptr == _ring.reserve(120), "공간이 부족한데 예약이 성공함");
+
+        std::vector<std::size_t> _sizes;
+        bool _content_valid = true;
+
+        const std::size_t _count = _ring.consume([&](const void* _data, std::size_t _size)
+        {
+            if (_sizes.empty())
+            {
+                _content_valid &= VerifyRecord(_data, 1, _size);
+            }
+            else if (_sizes.size() == 1)
+            {
+                _content_valid &= std::memcmp(_data, "hello", 5) == 0;
+            }
+            else
+            {
+                _content_valid &= VerifyRecord(_data, 3, _size);
+            }
+
+            _sizes.push_back(_size);
+        });
+
+        Check(_count == 3 && _sizes == std::vector<std::size_t>({12, 5, 120}), "레코드 순서나 크기가 틀림");
+        Check(true == _content_valid, "레코드 내용이 틀림");
+        Check(true == _ring.is_empty(), "모두 읽었는데 비어 있지 않음");
+        Check(nullptr != _ring.reserve(120), "반납 후에도 공간이 없음");
+    }
+
+    // 버퍼 끝을 넘는 레코드는 패딩 뒤 버퍼 앞에서 시작하며, 패딩은 consumer에게 보이지 않는지 확인한다.
+    // _max_record_count로 일부만 읽고 나머지를 다음 호출에서 읽을 수 있는지도 확인한다.
+    void TestWraparoundPadding()
+    {
+        SPSC_ByteRing _ring(256);
+        std::uint64_t _next_write = 0;
+        std::uint64_t _next_read = 0;
+        std::size_t _wrap_count = 0;
+        std::uint8_t* _previous_destination = nullptr;
+        bool _content_valid = true;
+
+        for (std::size_t _round = 0; _round < 200; ++_round)
+        {
+            const std::size_t _size = 8 + (_round * 37) % 100;
+
+            void* _destination = _ring.reserve(_size);
+            if (nullptr == _destination)
+            {
+                _ring.consume([&](const void* _data, std::size_t _record_size)
+                {
+                    _content_valid &= VerifyRecord(_data, _next_read++, _record_size);
+                }, 1);
+                continue;
+            }
+
+            // 예약 위치가 이전보다 앞이면 버퍼 앞으로 돌아간 것
+            _wrap_count += static_cast<std::uint8_t*>(_destination) < _previous_destination ? 1 : 0;
+            _previous_destination = static_cast<std::uint8_t*>(_destination);
+
+            FillRecord(_destination, _next_write++, _size);
+            _ring.commit();
+        }
+
+        _ring.consume([&](const void* _data, std::size_t _record_size)
+        {
+            _content_valid &= VerifyRecord(_data, _next_read++, _record_size);
+        });
+
+        Check(_wrap_count > 0, "버퍼 끝을 넘는 경우가 없었음");
+        Check(_next_read == _next_write, "쓴 레코드를 모두 읽지 못함");
+        Check(true == _content_valid, "버퍼 끝을 넘은 레코드의 내용이 틀림");
+        Check(true == _ring.is_empty(), "모두 읽었는데 비어 있지 않음");
+
+        std::cout << "       레코드=" << _next_write << " | 버퍼 앞으로 돌아감=" << _wrap_count << '\n';
+    }
+
+    // provider와 consumer 스레드가 임의 크기의 레코드를 주고받을 때 순서와 내용이 유지되는지 확인한다.
+    void TestConcurrentRandomSizes()
+    {
+        constexpr std::uint64_t RecordCount = 500'000;
+
+        SPSC_ByteRing _ring(4096);
+        const std::size_t _max_size = _ring.max_record_size();
+
+        std::thread _provider([&_ring, _max_size]()
+        {
+            std::mt19937 _random(11);
+            std::uniform_int_distribution<std::size_t> _size_distribution(0, _max_size);
+
+            for (std::uint64_t _sequence = 0; _sequence < RecordCount; ++_sequence)
+            {
+                const std::size_t _size = _size_distribution(_random);
+                void* _destination;
+
+                while (nullptr == (_destination = _ring.reserve(_size)))
+                {
+                    std::this_thread::yield();
+                }
+
+                FillRecord(_destination, _sequence, _size);
+                _ring.commit();
+            }
+        });
+
+        std::mt19937 _random(11);
+        std::uniform_int_distribution<std::size_t> _size_distribution(0, _max_size);
+        std::uint64_t _next_read = 0;
+        std::size_t _error_count = 0;
+        std::size_t _consume_call_count = 0;
+
+        while (_next_read < RecordCount)
+        {
+            const std::size_t _count = _ring.consume([&](const void* _data, std::size_t _size)
+            {
+                if (_size != _size_distribution(_random) || false == VerifyRecord(_data, _next_read, _size))
+                {
+                    ++_error_count;
+                }
+                ++_next_read;
+            });
+
+            ++_consume_call_count;
+
+            if (_count == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        _provider.join();
+
+        Check(_error_count == 0, "레코드 크기나 내용이 틀림");
+        Check(true == _ring.is_empty(), "모두 읽었는데 비어 있지 않음");
+
+        std::cout << "       레코드=" << RecordCount
+                  << " | consume 호출=" << _consume_call_count
+                  << " | 오류=" << _error_count << '\n';
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 4;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "SPSC_ByteRing 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("버퍼 크기 검증", "2의 거듭제곱 | 64바이트 이상", TestCapacityValidation);
+    _passed_test_count += RunTest("예약과 공개", "정렬 | 크기 줄인 commit | 가득 참 | 순서", TestReserveCommitConsume);
+    _passed_test_count += RunTest("버퍼 끝 패딩", "버퍼=256바이트 | 일부만 읽기 | 내용 검사", TestWraparoundPadding);
+    _passed_test_count += RunTest("동시 임의 크기", "버퍼=4KiB | 레코드=500000개 | 순서/내용 검사", TestConcurrentRandomSizes);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
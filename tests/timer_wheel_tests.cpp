@@ -0,0 +1,276 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "timer_wheel.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::milliseconds;
+
+    // 테스트는 시작 시각을 고정하고 AdvanceTo로 시간을 직접 진행한다.
+    const Clock::time_point g_start_time = Clock::time_point() + std::chrono::hours(1);
+
+    template <typename WheelType>
+    std::vector<std::uint32_t> PopAll(WheelType& _wheel)
+    {
+        std::vector<std::uint32_t> _jobs;
+        std::uint32_t _job = 0;
+
+        while (true == _wheel.PopExpired(_job))
+        {
+            _jobs.push_back(_job);
+        }
+
+        return _jobs;
+    }
+
+    // 단계 경계 앞뒤의 마감 시각과 휠 범위를 넘는 마감 시각이 정확히 그 틱에 만료되는지 확인한다.
+    void TestDeadlineAcrossLevels()
+    {
+        using WheelType = TimerWheel<std::uint32_t, 64>;
+        auto _wheel = std::make_unique<WheelType>(Milliseconds(1), g_start_time);
+
+        const std::vector<std::uint64_t> _deadlines = {1, 5, 63, 64, 65, 4095, 4096, 5000, 262143, 262144, 300000, (1u << 24) + 100};
+
+        for (size_t i = 0; i < _deadlines.size(); ++i)
+        {
+            const auto _handle = _wheel->Schedule(g_start_time + Milliseconds(_deadlines[i]), static_cast<std::uint32_t>(i));
+            Check(_handle != WheelType::INVALID_TIMER, "Schedule 실패");
+        }
+
+        for (size_t i = 0; i < _deadlines.size(); ++i)
+        {
+            _wheel->AdvanceTo(g_start_time + Milliseconds(_deadlines[i] - 1));
+            Check(true == PopAll(*_wheel).empty(), "마감 시각 전에 만료됨");
+
+            _wheel->AdvanceTo(g_start_time + Milliseconds(_deadlines[i]));
+            const auto _fired = PopAll(*_wheel);
+            Check(_fired.size() == 1 && _fired[0] == i, "마감 시각에 정확히 만료되지 않음");
+        }
+
+        Check(_wheel->GetWheelCount() == 0, "모두 만료됐는데 휠에 타이머가 남음");
+    }
+
+    // 취소된 타이머는 만료되지 않고, 만료 후나 노드 재사용 후의 오래된 핸들로는 취소할 수 없는지 확인한다.
+    void TestCancel()
+    {
+        using WheelType = TimerWheel<std::uint32_t, 4>;
+        auto _wheel = std::make_unique<WheelType>(Milliseconds(1), g_start_time);
+
+        const auto _first = _wheel->Schedule(g_start_time + Milliseconds(10), 1);
+        const auto _second = _wheel->Schedule(g_start_time + Milliseconds(20), 2);
+        _wheel->AdvanceTo(g_start_time);
+        Check(_wheel->GetWheelCount() == 2, "예약한 타이머가 휠에 연결되지 않음");
+
+        Check(true == _wheel->Cancel(_first), "대기 중인 타이머 취소 실패");
+        Check(false == _wheel->Cancel(_first), "이미 취소한 타이머를 다시 취소함");
+
+        _wheel->AdvanceTo(g_start_time + Milliseconds(1));
+        Check(_wheel->GetWheelCount() == 1, "취소한 타이머가 휠에서 떼어지지 않음");
+
+        // 반납된 노드를 다시 사용해도 오래된 핸들로는 취소할 수 없어야 함
+        const auto _third = _wheel->Schedule(g_start_time + Milliseconds(15), 3);
+        Check(static_cast<std::uint32_t>(_third) == static_cast<std::uint32_t>(_first), "반납된 노드가 재사용되지 않음");
+        Check(false == _wheel->Cancel(_first), "오래된 핸들로 재사용된 노드를 취소함");
+
+        _wheel->AdvanceTo(g_start_time + Milliseconds(30));
+        const auto _fired = PopAll(*_wheel);
+        Check(_fired.size() == 2 && _fired[0] == 3 && _fired[1] == 2, "취소하지 않은 타이머만 순서대로 만료되지 않음");
+        Check(false == _wheel->Cancel(_second), "만료된 타이머를 취소함");
+
+        Check(WheelType::INVALID_TIMER != _wheel->Schedule(g_start_time, 4), "노드가 모두 반납되지 않음");
+    }
+
+    // 이미 지난 마감 시각은 다음 AdvanceTo에서 바로 만료되고,
+    // 출력 큐가 가득 차면 보류했다가 만료 순서대로 내보내는지 확인한다.
+    void TestPastDeadlineAndFullOutput()
+    {
+        using WheelType = TimerWheel<std::uint32_t, 16, 16, 2>;
+        auto _wheel = std::make_unique<WheelType>(Milliseconds(1), g_start_time);
+
+        _wheel->AdvanceTo(g_start_time + Milliseconds(100));
+        _wheel->Schedule(g_start_time + Milliseconds(50), 0);
+        Check(_wheel->AdvanceTo(g_start_time + Milliseconds(100)) == 1, "지난 마감 시각이 바로 만료되지 않음");
+        Check(PopAll(*_wheel).size() == 1, "지난 마감 시각의 작업을 꺼내지 못함");
+
+        for (std::uint32_t i = 0; i < 5; ++i)
+        {
+            _wheel->Schedule(g_start_time + Milliseconds(110), i);
+        }
+
+        std::vector<std::uint32_t> _fired;
+        Check(_wheel->AdvanceTo(g_start_time + Milliseconds(110)) == 2, "출력 큐 용량만큼 내보내지 않음");
+
+        for (size_t _round = 0; _round < 3; ++_round)
+        {
+            const auto _jobs = PopAll(*_wheel);
+            _fired.insert(_fired.end(), _jobs.begin(), _jobs.end());
+            _wheel->AdvanceTo(g_start_time + Milliseconds(110));
+        }
+
+        Check(_fired == std::vector<std::uint32_t>({0, 1, 2, 3, 4}), "보류한 작업을 순서대로 내보내지 않음");
+    }
+
+    // 내부 타이머 스레드를 켠 상태로 여러 스레드가 예약과 취소를 섞을 때
+    // 취소에 성공한 타이머는 만료되지 않고 나머지는 정확히 한 번 만료되는지 확인한다.
+    void TestConcurrentScheduleCancel()
+    {
+        constexpr size_t ThreadCount = 4;
+        constexpr std::uint32_t TimersPerThread = 50'000;
+
+        using WheelType = TimerWheel<std::uint32_t, 1u << 18>;
+        auto _wheel = std::make_unique<WheelType>(Milliseconds(1));
+        _wheel->Start();
+
+        std::vector<std::uint8_t> _cancelled(ThreadCount * TimersPerThread, 0);
+        std::atomic<size_t> _cancelled_count{0};
+
+        std::vector<std::thread> _threads;
+        for (size_t _thread_index = 0; _thread_index < ThreadCount; ++_thread_index)
+        {
+            _threads.emplace_back([&, _thread_index]()
+            {
+                for (std::uint32_t _offset = 0; _offset < TimersPerThread; ++_offset)
+                {
+                    const std::uint32_t _job = static_cast<std::uint32_t>(_thread_index * TimersPerThread + _offset);
+                    const auto _deadline = Clock::now() + Milliseconds(_offset % 50);
+
+                    WheelType::TimerHandle _handle;
+                    while ((_handle = _wheel->Schedule(_deadline, _job)) == WheelType::INVALID_TIMER)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    if ((_offset % 3) == 0 && true == _wheel->Cancel(_handle))
+                    {
+                        _cancelled[_job] = 1;
+                        _cancelled_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        std::vector<std::uint8_t> _fired(ThreadCount * TimersPerThread, 0);
+        size_t _fired_count = 0;
+        size_t _error_count = 0;
+        const size_t _expected_count = ThreadCount * TimersPerThread - _cancelled_count.load();
+        const auto _give_up_time = Clock::now() + std::chrono::seconds(10);
+
+        std::uint32_t _job = 0;
+        while (_fired_count < _expected_count && Clock::now() < _give_up_time)
+        {
+            if (false == _wheel->PopExpired(_job))
+            {
+                std::this_thread::sleep_for(Milliseconds(1));
+                continue;
+            }
+
+            if (_fired[_job] != 0 || _cancelled[_job] != 0)
+            {
+                ++_error_count;
+            }
+
+            _fired[_job] = 1;
+            ++_fired_count;
+        }
+
+        // 늦게 만료되는 항목이 더 없는지 잠시 확인
+        std::this_thread::sleep_for(Milliseconds(60));
+        _wheel->Stop();
+        Check(false == _wheel->PopExpired(_job), "예상보다 많이 만료됨");
+
+        Check(_fired_count == _expected_count, "만료된 타이머 수가 예상과 다름");
+        Check(_error_count == 0, "취소된 타이머가 만료되었거나 두 번 만료됨");
+        Check(_wheel->GetWheelCount() == 0, "모두 처리됐는데 휠에 타이머가 남음");
+
+        std::cout << "       스레드=" << ThreadCount
+                  << " | 예약=" << ThreadCount * TimersPerThread
+                  << " | 취소=" << _cancelled_count.load()
+                  << " | 만료=" << _fired_count
+                  << " | 오류=" << _error_count << '\n';
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 4;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "TimerWheel 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("단계별 마감 시각", "단계 경계 | 휠 범위 초과 | 정확한 만료 틱", TestDeadlineAcrossLevels);
+    _passed_test_count += RunTest("취소", "취소 후 만료 없음 | 오래된 핸들 | 만료 후 취소", TestCancel);
+    _passed_test_count += RunTest("지난 마감 시각과 가득 찬 출력 큐", "즉시 만료 | 출력 큐 용량=2 | 순서 유지", TestPastDeadlineAndFullOutput);
+    _passed_test_count += RunTest("동시 예약과 취소", "스레드=4 | 타이머=200000개 | 누락/중복 검사", TestConcurrentScheduleCancel);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
@@ -0,0 +1,305 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "mapped_file.h"
+#include "mpmc_queue.h"
+#include "trace_capture.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    // 길이를 따로 가진 가변 길이 메시지
+    struct Message
+    {
+        std::uint32_t _length;
+    };
+
+    std::string GetTempPath(const char* _name)
+    {
+        return (std::filesystem::temp_directory_path() / _name).string();
+    }
+
+    void RemoveFiles(const std::vector<std::string>& _paths)
+    {
+        std::error_code _error;
+        for (const std::string& _path : _paths)
+        {
+            std::filesystem::remove(_path, _error);
+        }
+    }
+}
+
+template <>
+struct lfq::TracePayloadSize<Message>
+{
+    static std::uint32_t Get(const Message& _message) noexcept { return _message._length; }
+};
+
+namespace
+{
+    // 만든 파일에 쓴 내용이 다시 열었을 때 보이고, ReadWrite가 파일을 늘리며, 없는 파일은 열지 못하는지 확인한다.
+    void TestMappedFile()
+    {
+        const std::string _path = GetTempPath("lfq_mapped_file_test.bin");
+
+        {
+            MappedFile _file;
+            Check(true == _file.Open(_path, lfq::MappedFileMode::Create, 4096) && _file.GetSize() == 4096, "파일을 만들지 못함");
+            std::memcpy(_file.GetData(), "journal", 8);
+            Check(true == _file.Flush(), "Flush 실패");
+
+            MappedFile _moved(std::move(_file));
+            Check(false == _file.IsOpen() && true == _moved.IsOpen(), "이동 후 원본이 닫히지 않음");
+        }
+
+        {
+            MappedFile _file;
+            Check(true == _file.Open(_path, lfq::MappedFileMode::ReadOnly) && _file.GetSize() == 4096, "읽기 전용으로 열지 못함");
+            Check(std::memcmp(_file.GetData(), "journal", 8) == 0, "쓴 내용이 파일에 남지 않음");
+        }
+
+        {
+            MappedFile _file;
+            Check(true == _file.Open(_path, lfq::MappedFileMode::ReadWrite, 8192) && _file.GetSize() == 8192, "ReadWrite가 파일을 늘리지 않음");
+            Check(std::memcmp(_file.GetData(), "journal", 8) == 0 && _file.GetData()[8000] == 0, "늘린 파일의 내용이 틀림");
+        }
+
+        MappedFile _missing;
+        Check(false == _missing.Open(GetTempPath("lfq_missing_file_test.bin"), lfq::MappedFileMode::ReadOnly) && false == _missing.IsOpen(), "없는 파일을 열었음");
+
+        RemoveFiles({_path});
+    }
+
+    // 여러 생산자와 소비자가 CapturingQueue로 주고받은 작업이 스레드별 파일에 시간순으로 모두 기록되는지 확인한다.
+    void TestCaptureRoundTrip()
+    {
+        constexpr size_t ProducerCount = 2;
+        constexpr std::uint64_t ItemsPerProducer = 20'000;
+        constexpr std::uint64_t TotalCount = ProducerCount * ItemsPerProducer;
+
+        auto _queue = std::make_unique<MPMCQueue<std::uint64_t, 1024>>();
+        TraceCapture _capture(GetTempPath("lfq_capture_test"), 100'000);
+        CapturingQueue<MPMCQueue<std::uint64_t, 1024>> _capturing_queue(*_queue, _capture);
+
+        std::vector<std::thread> _threads;
+        for (size_t _producer_index = 0; _producer_index < ProducerCount; ++_producer_index)
+        {
+            _threads.emplace_back([&_capturing_queue]()
+            {
+                for (std::uint64_t i = 0; i < ItemsPerProducer; ++i)
+                {
+                    while (false == _capturing_queue.Push(i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        _threads.emplace_back([&_capturing_queue]()
+        {
+            std::uint64_t _value = 0;
+            for (std::uint64_t _popped_count = 0; _popped_count < TotalCount;)
+            {
+                if (true == _capturing_queue.Pop(_value))
+                {
+                    ++_popped_count;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        const std::vector<std::string> _paths = _capture.Finish();
+        Check(_paths.size() == ProducerCount + 1, "스레드별 파일 수가 틀림");
+        Check(_capture.GetDroppedCount() == 0, "버려진 레코드가 있음");
+        Check(true == _capture.Finish().empty(), "두 번째 Finish가 파일을 반환함");
+
+        std::uint64_t _push_count = 0;
+        std::uint64_t _pop_count = 0;
+        bool _ordered = true;
+        bool _same_thread = true;
+
+        for (const std::string& _path : _paths)
+        {
+            std::vector<lfq::TraceRecord> _records;
+            Check(true == lfq::LoadTraceFile(_path, _records), "트레이스 파일을 읽지 못함");
+
+            for (size_t i = 0; i < _records.size(); ++i)
+            {
+                _push_count += _records[i]._operation == lfq::TraceOperation::Push ? 1 : 0;
+                _pop_count += _records[i]._operation == lfq::TraceOperation::Pop ? 1 : 0;
+                _ordered = _ordered && _records[i]._payload_size == sizeof(std::uint64_t) && (i == 0 || _records[i - 1]._timestamp_ns <= _records[i]._timestamp_ns);
+                _same_thread = _same_thread && _records[i]._thread_id == _records[0]._thread_id;
+            }
+        }
+
+        Check(_push_count == TotalCount && _pop_count == TotalCount, "기록된 Push/Pop 수가 틀림");
+        Check(true == _ordered, "파일 안의 시간 순서나 항목 크기가 틀림");
+        Check(true == _same_thread, "한 파일에 다른 스레드의 레코드가 섞임");
+
+        RemoveFiles(_paths);
+    }
+
+    // 앞 스레드가 끝난 뒤 시작한 스레드도 새 번호와 새 파일을 받아, 순서대로 산 생산자들이 한 스레드로 합쳐지지 않는지 확인한다.
+    void TestSequentialThreadsGetDistinctIds()
+    {
+        constexpr size_t ThreadCount = 3;
+        constexpr std::uint64_t ItemsPerThread = 10;
+
+        auto _queue = std::make_unique<MPMCQueue<std::uint64_t, 64>>();
+        TraceCapture _capture(GetTempPath("lfq_sequential_capture_test"), 100);
+        CapturingQueue<MPMCQueue<std::uint64_t, 64>> _capturing_queue(*_queue, _capture);
+
+        for (size_t _thread_index = 0; _thread_index < ThreadCount; ++_thread_index)
+        {
+            std::thread _thread([&_capturing_queue]()
+            {
+                for (std::uint64_t i = 0; i < ItemsPerThread; ++i)
+                {
+                    _capturing_queue.Push(i);
+                }
+            });
+
+            _thread.join();
+        }
+
+        const std::vector<std::string> _paths = _capture.Finish();
+        Check(_paths.size() == ThreadCount, "순서대로 산 스레드가 파일을 나눠 쓰지 않음");
+
+        std::vector<bool> _seen_ids(ThreadCount, false);
+        for (const std::string& _path : _paths)
+        {
+            std::vector<lfq::TraceRecord> _records;
+            Check(true == lfq::LoadTraceFile(_path, _records) && _records.size() == ItemsPerThread, "스레드별 레코드 수가 틀림");
+
+            for (const lfq::TraceRecord& _record : _records)
+            {
+                Check(_record._thread_id < ThreadCount && _record._thread_id == _records[0]._thread_id, "스레드 번호가 틀림");
+            }
+
+            if (false == _records.empty() && _records[0]._thread_id < ThreadCount)
+            {
+                Check(false == _seen_ids[_records[0]._thread_id], "두 스레드가 같은 번호를 받음");
+                _seen_ids[_records[0]._thread_id] = true;
+            }
+        }
+
+        RemoveFiles(_paths);
+    }
+
+    // 스레드 버퍼가 가득 차면 레코드를 버리고 수를 세며, 특수화한 항목 크기가 기록되는지 확인한다.
+    void TestCapacityAndPayloadSize()
+    {
+        constexpr size_t Capacity = 10;
+
+        auto _queue = std::make_unique<MPMCQueue<Message, 32>>();
+        TraceCapture _capture(GetTempPath("lfq_capacity_test"), Capacity);
+        CapturingQueue<MPMCQueue<Message, 32>> _capturing_queue(*_queue, _capture);
+
+        for (std::uint32_t i = 0; i < 15; ++i)
+        {
+            _capturing_queue.Push(Message{100 + i});
+        }
+
+        Check(_capture.GetDroppedCount() == 5, "버려진 레코드 수가 틀림");
+
+        const std::vector<std::string> _paths = _capture.Finish();
+        std::vector<lfq::TraceRecord> _records;
+        Check(_paths.size() == 1 && true == lfq::LoadTraceFile(_paths[0], _records), "트레이스 파일을 읽지 못함");
+        Check(_records.size() == Capacity, "버퍼 크기보다 많이 기록됨");
+        Check(false == _records.empty() && _records.front()._payload_size == 100 && _records.back()._payload_size == 109, "특수화한 항목 크기가 기록되지 않음");
+
+        std::vector<lfq::TraceRecord> _invalid_records;
+        Check(false == lfq::LoadTraceFile(GetTempPath("lfq_missing_trace_test.trace"), _invalid_records), "없는 트레이스 파일을 읽었음");
+
+        RemoveFiles(_paths);
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 4;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "TraceCapture 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("매핑 파일", "Create | ReadOnly | ReadWrite 확장 | 없는 파일", TestMappedFile);
+    _passed_test_count += RunTest("캡처 왕복", "2P / 1C | 항목=40000 | 스레드별 파일", TestCaptureRoundTrip);
+    _passed_test_count += RunTest("순서대로 산 스레드", "스레드=3 (하나씩 join) | 번호 재사용 없음 | 스레드별 파일", TestSequentialThreadsGetDistinctIds);
+    _passed_test_count += RunTest("버퍼 가득 참과 항목 크기", "버퍼=10 | Push=15 | TracePayloadSize 특수화", TestCapacityAndPayloadSize);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}
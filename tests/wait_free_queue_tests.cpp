@@ -0,0 +1,296 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "wait_free_queue.h"
+
+namespace
+{
+    int g_failure_count = 0;
+
+    void Check(bool _condition, const char* _message)
+    {
+        if (true == _condition)
+        {
+            return;
+        }
+
+        ++g_failure_count;
+
+        std::cerr << "  실패: " << _message << '\n';
+    }
+
+    struct SmallItem
+    {
+        std::uint16_t _kind;
+        std::uint16_t _sequence;
+    };
+
+    // 빠른 경로만 쓰는 경우와 느린 경로만 쓰는 경우 모두 FIFO, 가득 참, 빈 큐, 바퀴 넘김이 맞는지 확인한다.
+    template <size_t FastPathAttemptCount>
+    void CheckSingleThread()
+    {
+        constexpr size_t Capacity = 8;
+        auto _queue = std::make_unique<WaitFreeQueue<SmallItem, Capacity>>(FastPathAttemptCount);
+        SmallItem _item{};
+
+        Check(true == _queue->IsEmpty() && false == _queue->Pop(_item), "빈 큐에서 꺼냄");
+
+        std::uint16_t _next_push = 0;
+        std::uint16_t _next_pop = 0;
+        bool _in_order = true;
+
+        for (int _lap = 0; _lap < 5; ++_lap)
+        {
+            while (true == _queue->Push(SmallItem{7, _next_push}))
+            {
+                ++_next_push;
+            }
+
+            Check(_queue->GetSize() == Capacity, "가득 찬 크기가 용량과 다름");
+
+            // 절반만 꺼내 다음 바퀴가 슬롯 경계를 넘게 한다
+            for (size_t i = 0; i < Capacity / 2 + static_cast<size_t>(_lap % 2); ++i)
+            {
+                _in_order = _in_order && true == _queue->Pop(_item) && _item._kind == 7 && _item._sequence == _next_pop;
+                ++_next_pop;
+            }
+        }
+
+        while (true == _queue->Pop(_item))
+        {
+            _in_order = _in_order && _item._kind == 7 && _item._sequence == _next_pop;
+            ++_next_pop;
+        }
+
+        Check(true == _in_order, "순서가 틀리거나 값이 깨짐");
+        Check(_next_pop == _next_push && true == _queue->IsEmpty(), "넣은 수와 꺼낸 수가 다름");
+        Check((FastPathAttemptCount == 0) == (_queue->GetSlowPathCount() != 0), "느린 경로 사용 여부가 틀림");
+    }
+
+    void TestSingleThread()
+    {
+        CheckSingleThread<lfq::WAIT_FREE_FAST_PATH_ATTEMPT_COUNT>();
+        CheckSingleThread<0>();
+    }
+
+    // 여러 생산자/소비자에서 모든 항목이 정확히 한 번씩 나오고 생산자별 순서가 유지되는지 확인한다.
+    void CheckConcurrent(size_t _fast_path_attempt_count)
+    {
+        constexpr size_t ProducerCount = 4;
+        constexpr size_t ConsumerCount = 4;
+        constexpr std::uint32_t ItemsPerProducer = 20'000;
+
+        auto _queue = std::make_unique<WaitFreeQueue<std::uint32_t, 64>>(_fast_path_attempt_count);
+        std::vector<std::vector<std::uint32_t>> _popped(ConsumerCount);
+        std::atomic<size_t> _consumed_count{0};
+        std::vector<std::thread> _threads;
+
+        for (size_t _producer_index = 0; _producer_index < ProducerCount; ++_producer_index)
+        {
+            _threads.emplace_back([&_queue, _producer_index]()
+            {
+                for (std::uint32_t i = 0; i < ItemsPerProducer; ++i)
+                {
+                    while (false == _queue->Push(static_cast<std::uint32_t>(_producer_index << 24) | i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (size_t _consumer_index = 0; _consumer_index < ConsumerCount; ++_consumer_index)
+        {
+            _threads.emplace_back([&_queue, &_popped, &_consumed_count, _consumer_index]()
+            {
+                std::vector<std::uint32_t>& _local_popped = _popped[_consumer_index];
+                std::uint32_t _item = 0;
+
+                while (_consumed_count.load(std::memory_order_relaxed) < ProducerCount * ItemsPerProducer)
+                {
+                    if (true == _queue->Pop(_item))
+                    {
+                        _local_popped.push_back(_item);
+                        _consumed_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (auto& _thread : _threads)
+        {
+            _thread.join();
+        }
+
+        std::vector<int> _seen_counts(ProducerCount * ItemsPerProducer, 0);
+        bool _in_order = true;
+
+        for (const auto& _local_popped : _popped)
+        {
+            std::vector<std::int64_t> _last_sequences(ProducerCount, -1);
+            for (const std::uint32_t _item : _local_popped)
+            {
+                const size_t _producer_index = _item >> 24;
+                const std::uint32_t _sequence = _item & 0xFFFFFF;
+
+                _in_order = _in_order && _last_sequences[_producer_index] < static_cast<std::int64_t>(_sequence);
+                _last_sequences[_producer_index] = _sequence;
+                ++_seen_counts[_producer_index * ItemsPerProducer + _sequence];
+            }
+        }
+
+        Check(std::all_of(_seen_counts.begin(), _seen_counts.end(), [](int _count) { return _count == 1; }), "항목이 빠지거나 두 번 나옴");
+        Check(true == _in_order, "한 소비자가 본 생산자별 순서가 틀림");
+        Check(true == _queue->IsEmpty(), "끝난 뒤 큐가 비어 있지 않음");
+
+        std::cout << "  빠른 경로 시도=" << _fast_path_attempt_count << " | 느린 경로 호출=" << _queue->GetSlowPathCount() << '\n';
+    }
+
+    void TestConcurrentFastPath()
+    {
+        CheckConcurrent(lfq::WAIT_FREE_FAST_PATH_ATTEMPT_COUNT);
+        CheckConcurrent(1);
+    }
+
+    // 모든 호출이 공고 후 도움을 받아 끝나는 경우에도 결과가 같은지 확인한다.
+    void TestConcurrentSlowPath()
+    {
+        CheckConcurrent(0);
+    }
+
+    // ThreadRegistry 번호가 모두 쓰이면 TryPush/TryPop이 가득 참/빈 큐가 아닌 NoThreadIndex를 돌려주는지 확인한다.
+    void TestNoThreadIndex()
+    {
+        auto _queue = std::make_unique<WaitFreeQueue<std::uint32_t, 8>>();
+        std::atomic<size_t> _ready_count{0};
+        std::atomic<bool> _release{false};
+        std::vector<std::thread> _holders;
+
+        // 메인 스레드가 이미 번호를 가졌을 수 있으므로 일부 스레드는 번호를 못 받아도 된다
+        for (size_t i = 0; i < lfq::MAX_REGISTERED_THREAD_COUNT; ++i)
+        {
+            _holders.emplace_back([&_ready_count, &_release]()
+            {
+                ThreadRegistry::GetThreadIndex();
+                _ready_count.fetch_add(1, std::memory_order_release);
+
+                while (false == _release.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+            });
+        }
+
+        while (_ready_count.load(std::memory_order_acquire) < lfq::MAX_REGISTERED_THREAD_COUNT)
+        {
+            std::this_thread::yield();
+        }
+
+        Check(ThreadRegistry::GetRegisteredCount() == lfq::MAX_REGISTERED_THREAD_COUNT, "번호가 모두 쓰이지 않음");
+
+        lfq::WaitFreeStatus _push_status = lfq::WaitFreeStatus::Ok;
+        lfq::WaitFreeStatus _pop_status = lfq::WaitFreeStatus::Ok;
+        std::thread([&_queue, &_push_status, &_pop_status]()
+        {
+            std::uint32_t _item = 0;
+            _push_status = _queue->TryPush(1);
+            _pop_status = _queue->TryPop(_item);
+        }).join();
+
+        Check(_push_status == lfq::WaitFreeStatus::NoThreadIndex, "번호 없는 스레드의 TryPush가 NoThreadIndex가 아님");
+        Check(_pop_status == lfq::WaitFreeStatus::NoThreadIndex, "번호 없는 스레드의 TryPop이 NoThreadIndex가 아님");
+        Check(true == _queue->IsEmpty(), "번호 없는 스레드의 TryPush가 큐를 바꿈");
+
+        _release.store(true, std::memory_order_release);
+        for (auto& _holder : _holders)
+        {
+            _holder.join();
+        }
+
+        // 번호가 반납된 뒤에는 Full/Empty가 원래대로 구별되어야 한다
+        std::thread([&_queue, &_push_status, &_pop_status]()
+        {
+            std::uint32_t _item = 0;
+            for (size_t i = 0; i < _queue->GetCapacity(); ++i)
+            {
+                _queue->TryPush(static_cast<std::uint32_t>(i));
+            }
+            _push_status = _queue->TryPush(99);
+            while (lfq::WaitFreeStatus::Ok == _queue->TryPop(_item))
+            {
+            }
+            _pop_status = _queue->TryPop(_item);
+        }).join();
+
+        Check(_push_status == lfq::WaitFreeStatus::Full, "가득 찬 큐의 TryPush가 Full이 아님");
+        Check(_pop_status == lfq::WaitFreeStatus::Empty, "빈 큐의 TryPop이 Empty가 아님");
+    }
+
+    using TestFunction = void (*)();
+
+    bool RunTest(const char* _name, const char* _description, TestFunction _test)
+    {
+        const int _failure_count_before = g_failure_count;
+        const auto _start_time = std::chrono::steady_clock::now();
+
+        std::cout << "\n[테스트] " << _name << '\n';
+        std::cout << "       " << _description << '\n';
+        _test();
+
+        const auto _elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - _start_time);
+
+        if (_failure_count_before == g_failure_count)
+        {
+            std::cout << "[통과] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+            return true;
+        }
+
+        std::cout << "[실패] " << _name << " (" << _elapsed_time.count() << " ms)\n";
+        return false;
+    }
+}
+
+int main()
+{
+    constexpr int TestCount = 4;
+    int _passed_test_count = 0;
+
+#ifdef _WIN32
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    std::cout << "WaitFreeQueue 정확성 테스트\n";
+    std::cout << "============================================================\n";
+
+    _passed_test_count += RunTest("단일 스레드", "용량=8 | 5바퀴 | 빠른 경로 / 느린 경로만", TestSingleThread);
+    _passed_test_count += RunTest("동시 Push/Pop (빠른 경로)", "4P/4C | 항목=80000 | 용량=64 | 시도 8회, 1회", TestConcurrentFastPath);
+    _passed_test_count += RunTest("동시 Push/Pop (느린 경로)", "4P/4C | 항목=80000 | 용량=64 | 모든 호출 공고", TestConcurrentSlowPath);
+    _passed_test_count += RunTest("ThreadRegistry 번호 없음", "128개 번호 점유 | 번호 없는 스레드의 TryPush/TryPop", TestNoThreadIndex);
+
+    std::cout << "\n============================================================\n";
+
+    if (g_failure_count != 0)
+    {
+        std::cerr << "결과: 실패 | 통과한 테스트=" << _passed_test_count << '/' << TestCount
+                  << " | 실패한 검증=" << g_failure_count << '\n';
+        return 1;
+    }
+
+    std::cout << "결과: 통과 | 통과한 테스트=" << _passed_test_count << '/' << TestCount << '\n';
+    return 0;
+}